@@ -101,6 +101,10 @@ bool PluginCore::reset(ResetInfo& resetInfo)
     {
 	    envFollower.reset(resetInfo.sampleRate);
     }
+
+	// --- the block processor meters every output sample
+	vuMeterAccumulator = getMeterAccumulator(controlID::vuMeter);
+
     // --- other reset inits
     return PluginBase::reset(resetInfo);
 }
@@ -288,7 +292,7 @@ bool PluginCore::preProcessAudioBlock(IMidiEventQueue* midiEventQueue)
 	//     for the DSP algorithm at hand
 	//     NOTE: updating (cooking) only once per block usually SAVES CPU cycles
 	//           updating (cooking) once per sample period usually EATS CPU cycles, potentially unnecessarily
-	// updateParameters();
+	updateParameters();
 
 	return true;
 }
@@ -348,7 +352,48 @@ bool PluginCore::processAudioBlock(ProcessBlockInfo& processBlockInfo)
 
 	// --- or FX
 	else if (getPluginType() == kFXPlugin)
-		renderFXPassThrough(processBlockInfo);
+	{
+		vuMeter = 0.f;
+
+		if (fx_On)
+		{
+			// --- each follower runs on its channel directly in the host buffers; a mono input feeds
+			//     both channels, so go in reverse order to overwrite an in-place channel 0 last
+			const uint32_t start = processBlockInfo.blockStartIndex;
+			for (unsigned int i = NUM_CHANNELS; i-- > 0;)
+			{
+				if (i >= processBlockInfo.numAudioOutChannels)
+					continue;
+
+				const uint32_t inputChannel = i < processBlockInfo.numAudioInChannels ? i : 0;
+				if (processBlockInfo.outputs64)
+				{
+					// --- 64-bit host: stay in double precision end-to-end
+					envFollowers[i].processAudioBlock(&processBlockInfo.inputs64[inputChannel][start],
+													  &processBlockInfo.outputs64[i][start],
+													  processBlockInfo.blockSize);
+				}
+				else
+				{
+					envFollowers[i].processAudioBlock(&processBlockInfo.inputs[inputChannel][start],
+													  &processBlockInfo.outputs[i][start],
+													  processBlockInfo.blockSize);
+				}
+			}
+
+			// --- meter every sample of the block, all channels
+			const uint32_t meterChannels = std::min(processBlockInfo.numAudioOutChannels, (uint32_t)NUM_CHANNELS);
+			if (vuMeterAccumulator && processBlockInfo.outputs64)
+				vuMeterAccumulator->accumulateBlock(processBlockInfo.outputs64, meterChannels, start, processBlockInfo.blockSize);
+			else if (vuMeterAccumulator)
+				vuMeterAccumulator->accumulateBlock(processBlockInfo.outputs, meterChannels, start, processBlockInfo.blockSize);
+		}
+		else
+		{
+			// --- Bypass
+			renderFXPassThrough(processBlockInfo);
+		}
+	}
 
 	return true;
 }
@@ -389,7 +434,10 @@ bool PluginCore::renderSynthSilence(ProcessBlockInfo& blockInfo)
 		for (uint32_t channel = 0; channel < blockInfo.numAudioOutChannels; channel++)
 		{
 			// --- silence (or, your synthesized block of samples)
-			blockInfo.outputs[channel][sample] = 0.0;
+			if (blockInfo.outputs64)
+				blockInfo.outputs64[channel][sample] = 0.0;
+			else
+				blockInfo.outputs[channel][sample] = 0.0;
 		}
 	}
 	return true;
@@ -416,8 +464,14 @@ bool PluginCore::renderFXPassThrough(ProcessBlockInfo& blockInfo)
 		// --- handles multiple channels, but up to you for bookkeeping
 		for (uint32_t channel = 0; channel < blockInfo.numAudioOutChannels; channel++)
 		{
+			// --- a mono input feeds all of the output channels
+			const uint32_t inputChannel = channel < blockInfo.numAudioInChannels ? channel : 0;
+
 			// --- pass through code, or your processed FX version
-			blockInfo.outputs[channel][sample] = blockInfo.inputs[channel][sample];
+			if (blockInfo.outputs64)
+				blockInfo.outputs64[channel][sample] = blockInfo.inputs64[inputChannel][sample];
+			else
+				blockInfo.outputs[channel][sample] = blockInfo.inputs[inputChannel][sample];
 		}
 	}
 	return true;
@@ -982,6 +1036,10 @@ bool PluginCore::initPluginDescriptors()
 	//     false: process audio blocks --- most efficient, but somewhat more complex code
 	pluginDescriptor.processFrames = kProcessFrames;
 
+	// --- kProcessDoublePrecision: accept 64-bit buffers from hosts that offer them (VST3 only);
+	//     processAudioBlock( ) must then handle the inputs64/outputs64 pointers
+	pluginDescriptor.processDoublePrecision = kProcessDoublePrecision;
+
 	// --- for block processing (if pluginDescriptor.processFrame == false),
 	//     this is the block size
 	processBlockInfo.blockSize = kBlockSize;
@@ -140,6 +140,7 @@ public:
 
 protected:
 	AutoQEnvelopeFollower envFollowers[NUM_CHANNELS];
+	MeterAccumulator* vuMeterAccumulator = nullptr; ///< fed with whole blocks in processAudioBlock( )
     int const FILTER_ENUM_OFFSET = 3;
     void updateParameters();
 
@@ -62,8 +62,9 @@ const char* kVendorURL = "github.com/DoomyDwyer";
 const char* kVendorEmail = "doomy@puscii.nl";
 
 // --- Plugin Options
-const bool kProcessFrames = true;
-const uint32_t kBlockSize = DEFAULT_AUDIO_BLOCK_SIZE;
+const bool kProcessFrames = false;
+const bool kProcessDoublePrecision = true;
+const uint32_t kBlockSize = 16;
 const bool kWantSidechain = true;
 const uint32_t kLatencyInSamples = 0;
 const double kTailTimeMsec = 0.000;
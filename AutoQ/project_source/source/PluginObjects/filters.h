@@ -1,8093 +0,0 @@
-// -----------------------------------------------------------------------------
-//    ASPiK FX Objects File:  filters.h
-//
-/**
-    \file   filters.h
-    \author Will Pirkle
-    \date   17-September-2018
-    \brief  hard-coded arrays of FIR filter coefficients for the sample rate
-    		conversion objects (Interpolator and Decimator)
-
-    		- http://www.aspikplugins.com
-			- http://www.willpirkle.com
-
-*/
-// -----------------------------------------------------------------------------
-
-#pragma once
-
-#ifndef __filters_h__
-#define  __filters_h__
-
-
-// -------------------------------------------------------------- //
-//
-// ----------- 128 POINT FIR LPF h[n] arrays -------------------- //
-//
-// -------------------------------------------------------------- //
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 88200 Hz
-
-	* 0 Hz - 20000 Hz
-	gain = 1
-	desired ripple = 0.1 dB
-	actual ripple = 0.4398351975248113 dB
-
-	* 22000 Hz - 44100 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -80.48916687834947 dB
-
-*/
-
-#define FILTER_TAP_128 128
-
-static double LPF128_882[FILTER_TAP_128] = {
-	0.00012024986120403753,
-	-0.00041598786406509203,
-	-0.0024064729634507035,
-	-0.005018087550467915,
-	-0.005431276749842713,
-	-0.002152073752549883,
-	0.001940246252242638,
-	0.002395032917651927,
-	-0.000659309981389897,
-	-0.0022888892556412205,
-	-0.00003256426705732894,
-	0.0022151438657597535,
-	0.0005665893486310846,
-	-0.002172489875015203,
-	-0.0010980135236684577,
-	0.002103103384802221,
-	0.001678722621594584,
-	-0.0019450822006069563,
-	-0.002309031997596689,
-	0.0016467876175448976,
-	0.0029586334625113105,
-	-0.0011763621368762482,
-	-0.003586344161161704,
-	0.0005173054166093583,
-	0.004150244197564707,
-	0.0003444966673852963,
-	-0.004596253094071619,
-	-0.001412373529179711,
-	0.00485539289695875,
-	0.0026593598972319394,
-	-0.004873207709408339,
-	-0.0040510909258555435,
-	0.004604772428316333,
-	0.0055639153228764955,
-	-0.003970559437276605,
-	-0.007113728740081288,
-	0.0029478541407598996,
-	0.008656404590926979,
-	-0.0014698245557513087,
-	-0.010091521384234442,
-	-0.0004891637415687574,
-	0.011331322604721935,
-	0.0029652622733312792,
-	-0.01226665251455692,
-	-0.0059887498859519306,
-	0.012774907606200495,
-	0.009596125024225848,
-	-0.012710795599953483,
-	-0.013840897404147552,
-	0.011893964750719944,
-	0.01882007929602108,
-	-0.010077972978660478,
-	-0.024725920861240074,
-	0.0068775965519342185,
-	0.03195679102946024,
-	-0.0015979539721411179,
-	-0.04140771391073218,
-	-0.007260858350669157,
-	0.055393382567821094,
-	0.02383303726666058,
-	-0.08170740973657127,
-	-0.06548094559144804,
-	0.17015291679983868,
-	0.42764916934830044,
-	0.42764916934830044,
-	0.17015291679983868,
-	-0.06548094559144804,
-	-0.08170740973657127,
-	0.02383303726666058,
-	0.055393382567821094,
-	-0.007260858350669157,
-	-0.04140771391073218,
-	-0.0015979539721411179,
-	0.03195679102946024,
-	0.0068775965519342185,
-	-0.024725920861240074,
-	-0.010077972978660478,
-	0.01882007929602108,
-	0.011893964750719944,
-	-0.013840897404147552,
-	-0.012710795599953483,
-	0.009596125024225848,
-	0.012774907606200495,
-	-0.0059887498859519306,
-	-0.01226665251455692,
-	0.0029652622733312792,
-	0.011331322604721935,
-	-0.0004891637415687574,
-	-0.010091521384234442,
-	-0.0014698245557513087,
-	0.008656404590926979,
-	0.0029478541407598996,
-	-0.007113728740081288,
-	-0.003970559437276605,
-	0.0055639153228764955,
-	0.004604772428316333,
-	-0.0040510909258555435,
-	-0.004873207709408339,
-	0.0026593598972319394,
-	0.00485539289695875,
-	-0.001412373529179711,
-	-0.004596253094071619,
-	0.0003444966673852963,
-	0.004150244197564707,
-	0.0005173054166093583,
-	-0.003586344161161704,
-	-0.0011763621368762482,
-	0.0029586334625113105,
-	0.0016467876175448976,
-	-0.002309031997596689,
-	-0.0019450822006069563,
-	0.001678722621594584,
-	0.002103103384802221,
-	-0.0010980135236684577,
-	-0.002172489875015203,
-	0.0005665893486310846,
-	0.0022151438657597535,
-	-0.00003256426705732894,
-	-0.0022888892556412205,
-	-0.000659309981389897,
-	0.002395032917651927,
-	0.001940246252242638,
-	-0.002152073752549883,
-	-0.005431276749842713,
-	-0.005018087550467915,
-	-0.0024064729634507035,
-	-0.00041598786406509203,
-	0.00012024986120403753
-};
-
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 176400 Hz
-
-	* 0 Hz - 20000 Hz
-	gain = 1
-	desired ripple = 1 dB
-	actual ripple = 2.3502989325721977 dB
-
-	* 22000 Hz - 88200 Hz
-	gain = 0
-	desired attenuation = -60 dB
-	actual attenuation = -50.149608858658695 dB
-
-*/
-
-static double LPF128_1764[FILTER_TAP_128] = {
-	-0.002175662435547232,
-	-0.006858518933159237,
-	-0.009752381344892615,
-	-0.014138222268797226,
-	-0.015773464464344095,
-	-0.01511939669317604,
-	-0.01116972109576238,
-	-0.005200738261182446,
-	0.0012395101820104806,
-	0.005994501000819527,
-	0.007604741194878367,
-	0.0057242807391387,
-	0.0014408167105611088,
-	-0.003197278913125525,
-	-0.006033015371588022,
-	-0.005782229911347182,
-	-0.002629249800867599,
-	0.0018357422528087052,
-	0.005368218290769121,
-	0.0061567517824860285,
-	0.0037403575093402403,
-	-0.0007164021063775948,
-	-0.004958216237456119,
-	-0.00675044257010488,
-	-0.005035850678708287,
-	-0.000545915029353793,
-	0.004492058581951597,
-	0.007428173108399192,
-	0.006571945023197714,
-	0.0021304657693493488,
-	-0.003765193678518094,
-	-0.008063502954421736,
-	-0.00834419735425321,
-	-0.004149380076629707,
-	0.00262063999906454,
-	0.008534416705260284,
-	0.010337571417784285,
-	0.00669978082768265,
-	-0.0009041256438835939,
-	-0.008735832822929583,
-	-0.012583081060517361,
-	-0.009963852334924632,
-	-0.0016280049416074185,
-	0.008514254499459943,
-	0.01515311988198953,
-	0.014264255383962298,
-	0.005411427765579305,
-	-0.00759206156978899,
-	-0.018191455310938007,
-	-0.020225717349635262,
-	-0.011266763840090085,
-	0.005536864140935095,
-	0.022270511414918752,
-	0.02963508300547073,
-	0.02157314145397513,
-	-0.0009675163480230595,
-	-0.029077707166324566,
-	-0.048551204386489244,
-	-0.045389884907673574,
-	-0.011994969740532713,
-	0.04862273931548844,
-	0.12261303466652133,
-	0.18944689432572856,
-	0.2290325679090546,
-	0.2290325679090546,
-	0.18944689432572856,
-	0.12261303466652133,
-	0.04862273931548844,
-	-0.011994969740532713,
-	-0.045389884907673574,
-	-0.048551204386489244,
-	-0.029077707166324566,
-	-0.0009675163480230595,
-	0.02157314145397513,
-	0.02963508300547073,
-	0.022270511414918752,
-	0.005536864140935095,
-	-0.011266763840090085,
-	-0.020225717349635262,
-	-0.018191455310938007,
-	-0.00759206156978899,
-	0.005411427765579305,
-	0.014264255383962298,
-	0.01515311988198953,
-	0.008514254499459943,
-	-0.0016280049416074185,
-	-0.009963852334924632,
-	-0.012583081060517361,
-	-0.008735832822929583,
-	-0.0009041256438835939,
-	0.00669978082768265,
-	0.010337571417784285,
-	0.008534416705260284,
-	0.00262063999906454,
-	-0.004149380076629707,
-	-0.00834419735425321,
-	-0.008063502954421736,
-	-0.003765193678518094,
-	0.0021304657693493488,
-	0.006571945023197714,
-	0.007428173108399192,
-	0.004492058581951597,
-	-0.000545915029353793,
-	-0.005035850678708287,
-	-0.00675044257010488,
-	-0.004958216237456119,
-	-0.0007164021063775948,
-	0.0037403575093402403,
-	0.0061567517824860285,
-	0.005368218290769121,
-	0.0018357422528087052,
-	-0.002629249800867599,
-	-0.005782229911347182,
-	-0.006033015371588022,
-	-0.003197278913125525,
-	0.0014408167105611088,
-	0.0057242807391387,
-	0.007604741194878367,
-	0.005994501000819527,
-	0.0012395101820104806,
-	-0.005200738261182446,
-	-0.01116972109576238,
-	-0.01511939669317604,
-	-0.015773464464344095,
-	-0.014138222268797226,
-	-0.009752381344892615,
-	-0.006858518933159237,
-	-0.002175662435547232
-};
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-sampling frequency: 96000 Hz
-
-	* 0 Hz - 20000 Hz
-	gain = 1
-	desired ripple = 0.1 dB
-	actual ripple = 0.618308828743376 dB
-
-	* 22000 Hz - 48000 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -77.53266858200129 dB
-
-*/
-
-static double LPF128_96[FILTER_TAP_128] = {
-	-0.0007206787440354049,
-	-0.00297491496154281,
-	-0.00593359240335764,
-	-0.007159412240511658,
-	-0.004468920371969045,
-	0.0005905634921195081,
-	0.0035932377691658786,
-	0.001850120256455803,
-	-0.0018914114146610925,
-	-0.00265532995754146,
-	0.00039447211769814934,
-	0.0027430497917520654,
-	0.0009285647318930798,
-	-0.002360464597561603,
-	-0.0020746973364432694,
-	0.0015267097389175084,
-	0.002943197664719215,
-	-0.000271786275631612,
-	-0.003337203896024264,
-	-0.0012730967633506412,
-	0.0030740600572981055,
-	0.0028518576605431403,
-	-0.0020611493511924653,
-	-0.004134407396742443,
-	0.0003417580070256949,
-	0.004754683924990473,
-	0.0018531085229402174,
-	-0.004423058583662926,
-	-0.0041386386248203405,
-	0.002988655903593804,
-	0.006012241796238224,
-	-0.0005214819251205882,
-	-0.00695217917140762,
-	-0.0026633057126738587,
-	0.006524933871538482,
-	0.0060204874350524235,
-	-0.004494631584892723,
-	-0.008835023127320311,
-	0.0009286377544106858,
-	0.010352754364358169,
-	0.0037691662887745143,
-	-0.009916866119575422,
-	-0.008871991497847122,
-	0.007104855933293723,
-	0.013392520729659364,
-	-0.0018543099444084468,
-	-0.016201158476673642,
-	-0.005451878872712355,
-	0.01617953274610696,
-	0.01395895521202477,
-	-0.012378928041386784,
-	-0.0223752403059382,
-	0.004142785257933808,
-	0.029078608270698872,
-	0.00897031964685647,
-	-0.032034170388720674,
-	-0.027343626633911527,
-	0.02859807399366758,
-	0.05236723111019177,
-	-0.013778811176181729,
-	-0.09052417268739903,
-	-0.03012034607950883,
-	0.19019813562912175,
-	0.39837475758572166,
-	0.39837475758572166,
-	0.19019813562912175,
-	-0.03012034607950883,
-	-0.09052417268739903,
-	-0.013778811176181729,
-	0.05236723111019177,
-	0.02859807399366758,
-	-0.027343626633911527,
-	-0.032034170388720674,
-	0.00897031964685647,
-	0.029078608270698872,
-	0.004142785257933808,
-	-0.0223752403059382,
-	-0.012378928041386784,
-	0.01395895521202477,
-	0.01617953274610696,
-	-0.005451878872712355,
-	-0.016201158476673642,
-	-0.0018543099444084468,
-	0.013392520729659364,
-	0.007104855933293723,
-	-0.008871991497847122,
-	-0.009916866119575422,
-	0.0037691662887745143,
-	0.010352754364358169,
-	0.0009286377544106858,
-	-0.008835023127320311,
-	-0.004494631584892723,
-	0.0060204874350524235,
-	0.006524933871538482,
-	-0.0026633057126738587,
-	-0.00695217917140762,
-	-0.0005214819251205882,
-	0.006012241796238224,
-	0.002988655903593804,
-	-0.0041386386248203405,
-	-0.004423058583662926,
-	0.0018531085229402174,
-	0.004754683924990473,
-	0.0003417580070256949,
-	-0.004134407396742443,
-	-0.0020611493511924653,
-	0.0028518576605431403,
-	0.0030740600572981055,
-	-0.0012730967633506412,
-	-0.003337203896024264,
-	-0.000271786275631612,
-	0.002943197664719215,
-	0.0015267097389175084,
-	-0.0020746973364432694,
-	-0.002360464597561603,
-	0.0009285647318930798,
-	0.0027430497917520654,
-	0.00039447211769814934,
-	-0.00265532995754146,
-	-0.0018914114146610925,
-	0.001850120256455803,
-	0.0035932377691658786,
-	0.0005905634921195081,
-	-0.004468920371969045,
-	-0.007159412240511658,
-	-0.00593359240335764,
-	-0.00297491496154281,
-	-0.0007206787440354049
-};
-
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 192000 Hz
-
-	* 0 Hz - 20000 Hz
-	gain = 1
-	desired ripple = 1 dB
-	actual ripple = 2.9319067508075913 dB
-
-	* 22000 Hz - 96000 Hz
-	gain = 0
-	desired attenuation = -60 dB
-	actual attenuation = -48.258224000499524 dB
-
-*/
-
-static double LPF128_192[FILTER_TAP_128] = {
-	0.004024616819676441,
-	0.0052376828706952065,
-	0.006879185383977035,
-	0.007122153014461529,
-	0.00526063336942594,
-	0.0011129697325733474,
-	-0.004773016670782165,
-	-0.011156284715139237,
-	-0.016416602054349604,
-	-0.019063608704015023,
-	-0.018272462866612743,
-	-0.0142407461950991,
-	-0.008203591689121681,
-	-0.0020607553730438667,
-	0.0022693395504621663,
-	0.003546538863856691,
-	0.001678248601892756,
-	-0.002233574441248467,
-	-0.00631079825879505,
-	-0.008644955567869098,
-	-0.00807215211394342,
-	-0.004672675980128931,
-	0.00023765804888272978,
-	0.00463575954810573,
-	0.00664310007716612,
-	0.005348640055234384,
-	0.0012491985578107255,
-	-0.0039007781839502697,
-	-0.007797704400215279,
-	-0.008578203886734602,
-	-0.005675976159612197,
-	-0.0001462432603704731,
-	0.00569946496800254,
-	0.009251881203982957,
-	0.008745955809819976,
-	0.004119704500272581,
-	-0.0028277300577011634,
-	-0.009104988134163211,
-	-0.011779116692236209,
-	-0.00930305261946106,
-	-0.0023305327411863607,
-	0.006376964711162604,
-	0.012996616243638627,
-	0.01427288455809857,
-	0.009043622502285855,
-	-0.0010214622172334922,
-	-0.011849254098090675,
-	-0.018524179864032077,
-	-0.01740663786980417,
-	-0.007908242996663178,
-	0.006805517734483395,
-	0.020719763969558925,
-	0.027188886625382575,
-	0.021776892449588393,
-	0.004568524909324283,
-	-0.01903223815088038,
-	-0.039523166148868145,
-	-0.04629355863306152,
-	-0.03142678534826223,
-	0.007032471478415514,
-	0.06359982169306669,
-	0.12633376376935368,
-	0.18009785022906943,
-	0.21107992604594752,
-	0.21107992604594752,
-	0.18009785022906943,
-	0.12633376376935368,
-	0.06359982169306669,
-	0.007032471478415514,
-	-0.03142678534826223,
-	-0.04629355863306152,
-	-0.039523166148868145,
-	-0.01903223815088038,
-	0.004568524909324283,
-	0.021776892449588393,
-	0.027188886625382575,
-	0.020719763969558925,
-	0.006805517734483395,
-	-0.007908242996663178,
-	-0.01740663786980417,
-	-0.018524179864032077,
-	-0.011849254098090675,
-	-0.0010214622172334922,
-	0.009043622502285855,
-	0.01427288455809857,
-	0.012996616243638627,
-	0.006376964711162604,
-	-0.0023305327411863607,
-	-0.00930305261946106,
-	-0.011779116692236209,
-	-0.009104988134163211,
-	-0.0028277300577011634,
-	0.004119704500272581,
-	0.008745955809819976,
-	0.009251881203982957,
-	0.00569946496800254,
-	-0.0001462432603704731,
-	-0.005675976159612197,
-	-0.008578203886734602,
-	-0.007797704400215279,
-	-0.0039007781839502697,
-	0.0012491985578107255,
-	0.005348640055234384,
-	0.00664310007716612,
-	0.00463575954810573,
-	0.00023765804888272978,
-	-0.004672675980128931,
-	-0.00807215211394342,
-	-0.008644955567869098,
-	-0.00631079825879505,
-	-0.002233574441248467,
-	0.001678248601892756,
-	0.003546538863856691,
-	0.0022693395504621663,
-	-0.0020607553730438667,
-	-0.008203591689121681,
-	-0.0142407461950991,
-	-0.018272462866612743,
-	-0.019063608704015023,
-	-0.016416602054349604,
-	-0.011156284715139237,
-	-0.004773016670782165,
-	0.0011129697325733474,
-	0.00526063336942594,
-	0.007122153014461529,
-	0.006879185383977035,
-	0.0052376828706952065,
-	0.004024616819676441
-};
-
-
-// -------------------------------------------------------------- //
-//
-// ----------- 256 POINT FIR LPF h[n] arrays -------------------- //
-//
-// -------------------------------------------------------------- //
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 88200 Hz
-
-	* 0 Hz - 20000 Hz
-	gain = 1
-	desired ripple = 0.1 dB
-	actual ripple = 0.004155001042074633 dB
-
-	* 22000 Hz - 44100 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -87.5773925743401 dB
-
-*/
-
-#define FILTER_TAP_256 256
-
-static double LPF256_882[FILTER_TAP_256] = {
-	-1.3532644015638956e-7,
-	-4.778481367601246e-7,
-	-4.489483718602042e-7,
-	4.5529479277548965e-7,
-	8.646112456274629e-7,
-	-9.089369826295025e-7,
-	-0.0000024705887838880236,
-	2.443544490556851e-7,
-	0.000003913631205340619,
-	4.42314815926701e-7,
-	-0.000006601811383004037,
-	-0.0000030878542587921503,
-	0.000008716605779285542,
-	0.000006486846965473418,
-	-0.000011458940930416692,
-	-0.000012621563059281724,
-	0.000012562985430968719,
-	0.00002003560472459619,
-	-0.000012937669510748606,
-	-0.000030459524691940314,
-	0.000009956503165111653,
-	0.00004196447646456422,
-	-0.000004317672658257961,
-	-0.00005573195574129031,
-	-0.000006722208690099998,
-	0.00006915688366163113,
-	0.00002238745436570749,
-	-0.00008270559982587437,
-	-0.00004515560895300436,
-	0.0000930547272775857,
-	0.00007379796172805357,
-	-0.00009995274636987168,
-	-0.00011008061590365805,
-	0.00009947753864450962,
-	0.00015185789422943226,
-	-0.000090919145929301,
-	-0.00019975364738926898,
-	0.00007014015935361462,
-	0.0002503355136309377,
-	-0.00003646364679427579,
-	-0.000302784434393394,
-	-0.000013843680854998197,
-	0.0003522170219500604,
-	0.0000807375714259726,
-	-0.00039633211555845327,
-	-0.0001667836451875273,
-	0.000428924856565385,
-	0.000270415916542105,
-	-0.0004465327659466903,
-	-0.00039224304187122466,
-	0.00044214200568939586,
-	0.0005284337237985741,
-	-0.00041183779425154856,
-	-0.0006769801167172676,
-	0.0003487108901487438,
-	0.0008312733554744141,
-	-0.0002494864869108733,
-	-0.0009863739889987154,
-	0.00010858611800668753,
-	0.001132793023752549,
-	0.00007527166936974,
-	-0.0012628405003114983,
-	-0.0003049358178693702,
-	0.0013646073989668783,
-	0.0005782758515825706,
-	-0.0014284359675415818,
-	-0.0008940542378506149,
-	0.0014410980959808394,
-	0.0012454943521659476,
-	-0.001392382437715597,
-	-0.0016262298965392479,
-	0.001269452356337554,
-	0.0020240697627921136,
-	-0.0010634911548838256,
-	-0.0024270692491421535,
-	0.0007641900551661004,
-	0.0028175364444512135,
-	-0.00036639131494531726,
-	-0.0031782569326488175,
-	-0.0001353451479385886,
-	0.003486810156559653,
-	0.0007402500113571831,
-	-0.0037218805582184948,
-	-0.0014467338985943378,
-	0.0038578910741600696,
-	0.0022461392630200717,
-	-0.003871363927021166,
-	-0.0031281859124582373,
-	0.0037357721605444046,
-	0.004075014710177782,
-	-0.003427846246776341,
-	-0.005066720619015387,
-	0.002922513868732491,
-	0.006075687070422893,
-	-0.002199006944866883,
-	-0.007072202348903971,
-	0.001235642682687503,
-	0.008018946226692785,
-	-0.000015511843854309205,
-	-0.008876543717995868,
-	-0.0014792660141275307,
-	0.00959786388458411,
-	0.0032626798295654646,
-	-0.010133069460104144,
-	-0.005351794050631381,
-	0.010422897373753676,
-	0.007763712482207026,
-	-0.010401857229536172,
-	-0.010525421545781621,
-	0.009988224032865563,
-	0.01367569121945997,
-	-0.009081042137776812,
-	-0.017283709241056593,
-	0.007538226210571958,
-	0.02146815803394855,
-	-0.0051489604455709215,
-	-0.026452407775092904,
-	0.0015563342120252846,
-	0.0326708045356388,
-	0.003911824719707784,
-	-0.04106308816008584,
-	-0.012746148674673476,
-	0.05398670707232886,
-	0.02907697204443692,
-	-0.07928221410451805,
-	-0.07027426789892402,
-	0.1668000592090343,
-	0.431806206721082,
-	0.431806206721082,
-	0.1668000592090343,
-	-0.07027426789892402,
-	-0.07928221410451805,
-	0.02907697204443692,
-	0.05398670707232886,
-	-0.012746148674673476,
-	-0.04106308816008584,
-	0.003911824719707784,
-	0.0326708045356388,
-	0.0015563342120252846,
-	-0.026452407775092904,
-	-0.0051489604455709215,
-	0.02146815803394855,
-	0.007538226210571958,
-	-0.017283709241056593,
-	-0.009081042137776812,
-	0.01367569121945997,
-	0.009988224032865563,
-	-0.010525421545781621,
-	-0.010401857229536172,
-	0.007763712482207026,
-	0.010422897373753676,
-	-0.005351794050631381,
-	-0.010133069460104144,
-	0.0032626798295654646,
-	0.00959786388458411,
-	-0.0014792660141275307,
-	-0.008876543717995868,
-	-0.000015511843854309205,
-	0.008018946226692785,
-	0.001235642682687503,
-	-0.007072202348903971,
-	-0.002199006944866883,
-	0.006075687070422893,
-	0.002922513868732491,
-	-0.005066720619015387,
-	-0.003427846246776341,
-	0.004075014710177782,
-	0.0037357721605444046,
-	-0.0031281859124582373,
-	-0.003871363927021166,
-	0.0022461392630200717,
-	0.0038578910741600696,
-	-0.0014467338985943378,
-	-0.0037218805582184948,
-	0.0007402500113571831,
-	0.003486810156559653,
-	-0.0001353451479385886,
-	-0.0031782569326488175,
-	-0.00036639131494531726,
-	0.0028175364444512135,
-	0.0007641900551661004,
-	-0.0024270692491421535,
-	-0.0010634911548838256,
-	0.0020240697627921136,
-	0.001269452356337554,
-	-0.0016262298965392479,
-	-0.001392382437715597,
-	0.0012454943521659476,
-	0.0014410980959808394,
-	-0.0008940542378506149,
-	-0.0014284359675415818,
-	0.0005782758515825706,
-	0.0013646073989668783,
-	-0.0003049358178693702,
-	-0.0012628405003114983,
-	0.00007527166936974,
-	0.001132793023752549,
-	0.00010858611800668753,
-	-0.0009863739889987154,
-	-0.0002494864869108733,
-	0.0008312733554744141,
-	0.0003487108901487438,
-	-0.0006769801167172676,
-	-0.00041183779425154856,
-	0.0005284337237985741,
-	0.00044214200568939586,
-	-0.00039224304187122466,
-	-0.0004465327659466903,
-	0.000270415916542105,
-	0.000428924856565385,
-	-0.0001667836451875273,
-	-0.00039633211555845327,
-	0.0000807375714259726,
-	0.0003522170219500604,
-	-0.000013843680854998197,
-	-0.000302784434393394,
-	-0.00003646364679427579,
-	0.0002503355136309377,
-	0.00007014015935361462,
-	-0.00019975364738926898,
-	-0.000090919145929301,
-	0.00015185789422943226,
-	0.00009947753864450962,
-	-0.00011008061590365805,
-	-0.00009995274636987168,
-	0.00007379796172805357,
-	0.0000930547272775857,
-	-0.00004515560895300436,
-	-0.00008270559982587437,
-	0.00002238745436570749,
-	0.00006915688366163113,
-	-0.000006722208690099998,
-	-0.00005573195574129031,
-	-0.000004317672658257961,
-	0.00004196447646456422,
-	0.000009956503165111653,
-	-0.000030459524691940314,
-	-0.000012937669510748606,
-	0.00002003560472459619,
-	0.000012562985430968719,
-	-0.000012621563059281724,
-	-0.000011458940930416692,
-	0.000006486846965473418,
-	0.000008716605779285542,
-	-0.0000030878542587921503,
-	-0.000006601811383004037,
-	4.42314815926701e-7,
-	0.000003913631205340619,
-	2.443544490556851e-7,
-	-0.0000024705887838880236,
-	-9.089369826295025e-7,
-	8.646112456274629e-7,
-	4.5529479277548965e-7,
-	-4.489483718602042e-7,
-	-4.778481367601246e-7,
-	-1.3532644015638956e-7
-};
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 176400 Hz
-
-	* 0 Hz - 20000 Hz
-	gain = 1
-	desired ripple = 0.1 dB
-	actual ripple = 0.4397945862807162 dB
-
-	* 22000 Hz - 88200 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -80.48996856582946 dB
-
-*/
-
-static double LPF256_1764[FILTER_TAP_256] = {
-	0.00008519033090792867,
-	0.000055071219150668846,
-	-0.00006170705201899551,
-	-0.00035842912492277786,
-	-0.0008627875385443189,
-	-0.0015269165162795468,
-	-0.002214059828508227,
-	-0.0027233302907583522,
-	-0.0028529577988915798,
-	-0.0024828386040230983,
-	-0.0016426213642379449,
-	-0.0005302449866934919,
-	0.0005379990447708736,
-	0.0012360277740973435,
-	0.0013558940018564753,
-	0.0009003993748685194,
-	0.00009443967894176847,
-	-0.000698975928831897,
-	-0.0011290073650185842,
-	-0.0010103568442006432,
-	-0.0004092050176530516,
-	0.00038285885058831915,
-	0.000981345502757301,
-	0.0010905896648712957,
-	0.0006496134323851824,
-	-0.00013086153132404232,
-	-0.0008639751599773103,
-	-0.0011741998752184866,
-	-0.0008875272524536839,
-	-0.0001285335407353599,
-	0.0007298689685610131,
-	0.0012463469269862041,
-	0.0011355807325968475,
-	0.0004240645470397816,
-	-0.0005471710125198164,
-	-0.001283121863901997,
-	-0.0013847394507074309,
-	-0.0007631591597413879,
-	0.0002958892682132586,
-	0.0012601654145374416,
-	0.0016161124099234121,
-	0.0011402020920832426,
-	0.00003405374686932656,
-	-0.0011561279840057045,
-	-0.0018068186648622113,
-	-0.0015416331810458716,
-	-0.00044525971333811274,
-	0.0009529967710907075,
-	0.001931845193925759,
-	0.0019477513522486382,
-	0.0009336124207489755,
-	-0.0006363828133875369,
-	-0.0019645814644117083,
-	-0.0023325587989280485,
-	-0.0014868470820079463,
-	0.00019818921596513074,
-	0.001880164547742121,
-	0.0026668718561456933,
-	0.002086474665607893,
-	0.00036375890536112325,
-	-0.0016564214228576345,
-	-0.0029197210535117303,
-	-0.0027092660899822253,
-	-0.0010471373159875283,
-	0.0012720854081721094,
-	0.0030561987835527053,
-	0.0033244705576725548,
-	0.0018418437893956343,
-	-0.0007103263378260695,
-	-0.0030402225692501388,
-	-0.0038949112581760695,
-	-0.00272908008431711,
-	-0.00003881455303468366,
-	0.002837907501041027,
-	0.004380942062900921,
-	0.0036855595240295486,
-	0.000982407881660968,
-	-0.002414035722147609,
-	-0.004737087283895212,
-	-0.004680081549981107,
-	-0.0021215684519387255,
-	0.0017342298378318537,
-	0.004913643133656148,
-	0.005675330276755671,
-	0.0034535667630623545,
-	-0.0007627235928184202,
-	-0.0048539727663124855,
-	-0.006624476300895618,
-	-0.004968274805444369,
-	-0.0005337342765352638,
-	0.0045007253315102955,
-	0.007481839162663078,
-	0.00666409581800762,
-	0.0022070285825385285,
-	-0.0037705706214211715,
-	-0.008176358486581712,
-	-0.008522819811216218,
-	-0.004303308251833182,
-	0.002581702588889898,
-	0.00864722491385848,
-	0.010557003046331295,
-	0.00692076850316838,
-	-0.0007950292637050243,
-	-0.00879850495356995,
-	-0.01279030918874689,
-	-0.010216678385537014,
-	-0.0018053745329341734,
-	0.008495362425424716,
-	0.01529568450266845,
-	0.014492924072183729,
-	0.005611089097546734,
-	-0.007518950104372401,
-	-0.018276709099188316,
-	-0.02042511814807365,
-	-0.011486527015164533,
-	0.0053973202073596075,
-	0.022268086626605444,
-	0.029759902215111135,
-	0.021758915822771813,
-	-0.0008112095782098994,
-	-0.02902292317513846,
-	-0.048620434271106294,
-	-0.045549855197030704,
-	-0.012173421098463444,
-	0.048504224096034214,
-	0.12260514413249571,
-	0.189554028140841,
-	0.22921265865333088,
-	0.22921265865333088,
-	0.189554028140841,
-	0.12260514413249571,
-	0.048504224096034214,
-	-0.012173421098463444,
-	-0.045549855197030704,
-	-0.048620434271106294,
-	-0.02902292317513846,
-	-0.0008112095782098994,
-	0.021758915822771813,
-	0.029759902215111135,
-	0.022268086626605444,
-	0.0053973202073596075,
-	-0.011486527015164533,
-	-0.02042511814807365,
-	-0.018276709099188316,
-	-0.007518950104372401,
-	0.005611089097546734,
-	0.014492924072183729,
-	0.01529568450266845,
-	0.008495362425424716,
-	-0.0018053745329341734,
-	-0.010216678385537014,
-	-0.01279030918874689,
-	-0.00879850495356995,
-	-0.0007950292637050243,
-	0.00692076850316838,
-	0.010557003046331295,
-	0.00864722491385848,
-	0.002581702588889898,
-	-0.004303308251833182,
-	-0.008522819811216218,
-	-0.008176358486581712,
-	-0.0037705706214211715,
-	0.0022070285825385285,
-	0.00666409581800762,
-	0.007481839162663078,
-	0.0045007253315102955,
-	-0.0005337342765352638,
-	-0.004968274805444369,
-	-0.006624476300895618,
-	-0.0048539727663124855,
-	-0.0007627235928184202,
-	0.0034535667630623545,
-	0.005675330276755671,
-	0.004913643133656148,
-	0.0017342298378318537,
-	-0.0021215684519387255,
-	-0.004680081549981107,
-	-0.004737087283895212,
-	-0.002414035722147609,
-	0.000982407881660968,
-	0.0036855595240295486,
-	0.004380942062900921,
-	0.002837907501041027,
-	-0.00003881455303468366,
-	-0.00272908008431711,
-	-0.0038949112581760695,
-	-0.0030402225692501388,
-	-0.0007103263378260695,
-	0.0018418437893956343,
-	0.0033244705576725548,
-	0.0030561987835527053,
-	0.0012720854081721094,
-	-0.0010471373159875283,
-	-0.0027092660899822253,
-	-0.0029197210535117303,
-	-0.0016564214228576345,
-	0.00036375890536112325,
-	0.002086474665607893,
-	0.0026668718561456933,
-	0.001880164547742121,
-	0.00019818921596513074,
-	-0.0014868470820079463,
-	-0.0023325587989280485,
-	-0.0019645814644117083,
-	-0.0006363828133875369,
-	0.0009336124207489755,
-	0.0019477513522486382,
-	0.001931845193925759,
-	0.0009529967710907075,
-	-0.00044525971333811274,
-	-0.0015416331810458716,
-	-0.0018068186648622113,
-	-0.0011561279840057045,
-	0.00003405374686932656,
-	0.0011402020920832426,
-	0.0016161124099234121,
-	0.0012601654145374416,
-	0.0002958892682132586,
-	-0.0007631591597413879,
-	-0.0013847394507074309,
-	-0.001283121863901997,
-	-0.0005471710125198164,
-	0.0004240645470397816,
-	0.0011355807325968475,
-	0.0012463469269862041,
-	0.0007298689685610131,
-	-0.0001285335407353599,
-	-0.0008875272524536839,
-	-0.0011741998752184866,
-	-0.0008639751599773103,
-	-0.00013086153132404232,
-	0.0006496134323851824,
-	0.0010905896648712957,
-	0.000981345502757301,
-	0.00038285885058831915,
-	-0.0004092050176530516,
-	-0.0010103568442006432,
-	-0.0011290073650185842,
-	-0.000698975928831897,
-	0.00009443967894176847,
-	0.0009003993748685194,
-	0.0013558940018564753,
-	0.0012360277740973435,
-	0.0005379990447708736,
-	-0.0005302449866934919,
-	-0.0016426213642379449,
-	-0.0024828386040230983,
-	-0.0028529577988915798,
-	-0.0027233302907583522,
-	-0.002214059828508227,
-	-0.0015269165162795468,
-	-0.0008627875385443189,
-	-0.00035842912492277786,
-	-0.00006170705201899551,
-	0.000055071219150668846,
-	0.00008519033090792867
-};
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 96000 Hz
-
-	* 0 Hz - 20000 Hz
-	gain = 1
-	desired ripple = 0.1 dB
-	actual ripple = 0.007636057437196765 dB
-
-	* 22000 Hz - 48000 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -115.69572757026249 dB
-
-*/
-
-static double LPF256_96[FILTER_TAP_256] = {
-	-0.000012689021037411505,
-	-0.000047323138261825614,
-	-0.0000874192671730249,
-	-0.00009071112030150734,
-	-0.00003410425937912534,
-	0.000038510773644612534,
-	0.00005185070978377565,
-	-0.000006894044470855798,
-	-0.00005547182694777294,
-	-0.000021110525355429637,
-	0.00005092426837046646,
-	0.00004977161497062657,
-	-0.00003343778865994385,
-	-0.00007530368000516144,
-	9.546014439822503e-7,
-	0.00008898850425250284,
-	0.000044038997864431615,
-	-0.00008271622332045887,
-	-0.00009327914889840165,
-	0.000050593469395910536,
-	0.00013479916001735918,
-	0.000007403909211413365,
-	-0.0001539394159889607,
-	-0.000084245365131983,
-	0.0001381461360388064,
-	0.00016491342703339233,
-	-0.00008034537606546195,
-	-0.000229492198592949,
-	-0.00001717074097615562,
-	0.0002561951544092152,
-	0.0001416263217586933,
-	-0.00022700231934275555,
-	-0.0002693974948042789,
-	0.00013276744551780646,
-	0.0003698001555543045,
-	0.000021583389604728636,
-	-0.00041053652434333435,
-	-0.00021534497384266668,
-	0.0003656416647401332,
-	0.0004127329514220484,
-	-0.00022289033365969907,
-	-0.0005682412048638928,
-	-0.000009545616686792609,
-	0.0006349100866025744,
-	0.0003006828067001068,
-	-0.0005753493510404451,
-	-0.0005985183524860086,
-	0.00037219363171048746,
-	0.0008375230524842533,
-	-0.00003681340589973283,
-	-0.0009503567860942413,
-	-0.0003871760915475935,
-	0.0008829883382891256,
-	0.0008266687871369797,
-	-0.0006094114371587188,
-	-0.0011893838591478703,
-	0.0001433718608481412,
-	0.0013800832753230203,
-	0.00045667449034123806,
-	-0.0013209617720553917,
-	-0.001091179855171699,
-	0.0009718600791530667,
-	0.0016330483056804443,
-	-0.0003463346818955142,
-	-0.0019493432107859608,
-	-0.0004810056481466861,
-	0.0019284464049877206,
-	0.0013785442875499658,
-	-0.0015075057927648563,
-	-0.002174686910586513,
-	0.0006947187746861772,
-	0.002686135156565485,
-	0.00041945037847127204,
-	-0.0027536430856887526,
-	-0.0016659111073459066,
-	0.0022788873691456466,
-	0.002817409665720864,
-	-0.001255371679019216,
-	-0.0036241889352349797,
-	-0.00021412069188861844,
-	0.003860246253163704,
-	0.001918937378125474,
-	-0.003372442624526207,
-	-0.00356363043269839,
-	0.0021234398488430657,
-	0.004811396892702651,
-	-0.00021896643342964674,
-	-0.005342709314249121,
-	-0.0020881074451197575,
-	0.00491997455143087,
-	0.004421176441766121,
-	-0.003447024920470682,
-	-0.00633024361992595,
-	0.001011556646553184,
-	0.007363878727402991,
-	0.002099575192838172,
-	-0.007152623594816701,
-	-0.005418737971295051,
-	0.005490585275261198,
-	0.00835064049687984,
-	-0.0024007637794515413,
-	-0.010255430651703689,
-	-0.001828849474318023,
-	0.010551256638240719,
-	0.00664759711746187,
-	-0.008821573466098593,
-	-0.011285974024192437,
-	0.004910539508306661,
-	0.014836877413118779,
-	0.0010088546926278919,
-	-0.01636273004936045,
-	-0.008404929039785923,
-	0.015010062001955314,
-	0.016398640734885426,
-	-0.010106649497469,
-	-0.023806546033813998,
-	0.0012081579753989327,
-	0.029184620580214805,
-	0.011958946012230054,
-	-0.03079377358342052,
-	-0.02978422017116759,
-	0.02624628583496391,
-	0.05374380752953855,
-	-0.010806304558240094,
-	-0.09056284641345487,
-	-0.033114585139106346,
-	0.18888562639465095,
-	0.4007822335690454,
-	0.4007822335690454,
-	0.18888562639465095,
-	-0.033114585139106346,
-	-0.09056284641345487,
-	-0.010806304558240094,
-	0.05374380752953855,
-	0.02624628583496391,
-	-0.02978422017116759,
-	-0.03079377358342052,
-	0.011958946012230054,
-	0.029184620580214805,
-	0.0012081579753989327,
-	-0.023806546033813998,
-	-0.010106649497469,
-	0.016398640734885426,
-	0.015010062001955314,
-	-0.008404929039785923,
-	-0.01636273004936045,
-	0.0010088546926278919,
-	0.014836877413118779,
-	0.004910539508306661,
-	-0.011285974024192437,
-	-0.008821573466098593,
-	0.00664759711746187,
-	0.010551256638240719,
-	-0.001828849474318023,
-	-0.010255430651703689,
-	-0.0024007637794515413,
-	0.00835064049687984,
-	0.005490585275261198,
-	-0.005418737971295051,
-	-0.007152623594816701,
-	0.002099575192838172,
-	0.007363878727402991,
-	0.001011556646553184,
-	-0.00633024361992595,
-	-0.003447024920470682,
-	0.004421176441766121,
-	0.00491997455143087,
-	-0.0020881074451197575,
-	-0.005342709314249121,
-	-0.00021896643342964674,
-	0.004811396892702651,
-	0.0021234398488430657,
-	-0.00356363043269839,
-	-0.003372442624526207,
-	0.001918937378125474,
-	0.003860246253163704,
-	-0.00021412069188861844,
-	-0.0036241889352349797,
-	-0.001255371679019216,
-	0.002817409665720864,
-	0.0022788873691456466,
-	-0.0016659111073459066,
-	-0.0027536430856887526,
-	0.00041945037847127204,
-	0.002686135156565485,
-	0.0006947187746861772,
-	-0.002174686910586513,
-	-0.0015075057927648563,
-	0.0013785442875499658,
-	0.0019284464049877206,
-	-0.0004810056481466861,
-	-0.0019493432107859608,
-	-0.0003463346818955142,
-	0.0016330483056804443,
-	0.0009718600791530667,
-	-0.001091179855171699,
-	-0.0013209617720553917,
-	0.00045667449034123806,
-	0.0013800832753230203,
-	0.0001433718608481412,
-	-0.0011893838591478703,
-	-0.0006094114371587188,
-	0.0008266687871369797,
-	0.0008829883382891256,
-	-0.0003871760915475935,
-	-0.0009503567860942413,
-	-0.00003681340589973283,
-	0.0008375230524842533,
-	0.00037219363171048746,
-	-0.0005985183524860086,
-	-0.0005753493510404451,
-	0.0003006828067001068,
-	0.0006349100866025744,
-	-0.000009545616686792609,
-	-0.0005682412048638928,
-	-0.00022289033365969907,
-	0.0004127329514220484,
-	0.0003656416647401332,
-	-0.00021534497384266668,
-	-0.00041053652434333435,
-	0.000021583389604728636,
-	0.0003698001555543045,
-	0.00013276744551780646,
-	-0.0002693974948042789,
-	-0.00022700231934275555,
-	0.0001416263217586933,
-	0.0002561951544092152,
-	-0.00001717074097615562,
-	-0.000229492198592949,
-	-0.00008034537606546195,
-	0.00016491342703339233,
-	0.0001381461360388064,
-	-0.000084245365131983,
-	-0.0001539394159889607,
-	0.000007403909211413365,
-	0.00013479916001735918,
-	0.000050593469395910536,
-	-0.00009327914889840165,
-	-0.00008271622332045887,
-	0.000044038997864431615,
-	0.00008898850425250284,
-	9.546014439822503e-7,
-	-0.00007530368000516144,
-	-0.00003343778865994385,
-	0.00004977161497062657,
-	0.00005092426837046646,
-	-0.000021110525355429637,
-	-0.00005547182694777294,
-	-0.000006894044470855798,
-	0.00005185070978377565,
-	0.000038510773644612534,
-	-0.00003410425937912534,
-	-0.00009071112030150734,
-	-0.0000874192671730249,
-	-0.000047323138261825614,
-	-0.000012689021037411505
-};
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 192000 Hz
-
-	* 0 Hz - 20000 Hz
-	gain = 1
-	desired ripple = 0.1 dB
-	actual ripple = 0.6145534582243266 dB
-
-	* 22000 Hz - 96000 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -77.58553980653744 dB
-
-*/
-
-static double LPF256_192[FILTER_TAP_256] = {
-	-0.00020550950977696016,
-	-0.0005782291659135532,
-	-0.0010983932516403473,
-	-0.0018437115212335642,
-	-0.002588460321745651,
-	-0.0032510295020445395,
-	-0.003560065932867868,
-	-0.003424828469518149,
-	-0.0027433333446253505,
-	-0.0016504372952480038,
-	-0.0003409354608796032,
-	0.0008433142416708619,
-	0.0016226231807938165,
-	0.0017846718161288518,
-	0.001336560339070561,
-	0.00045370439585035757,
-	-0.0005232111270540358,
-	-0.0012441589539073105,
-	-0.0014427351510568104,
-	-0.0010633948799983867,
-	-0.0002633112422429481,
-	0.0006273300294782066,
-	0.0012480415589991593,
-	0.0013400924004628295,
-	0.000864139658383905,
-	0.000013227404467096469,
-	-0.0008549445288520884,
-	-0.0013694955071465538,
-	-0.0012988159655092145,
-	-0.0006579273430960248,
-	0.0002922483221796136,
-	0.0011458284801105026,
-	0.0015246254110601331,
-	0.0012425264893252434,
-	0.0003968193431587274,
-	-0.000663072753845278,
-	-0.0014766653832796889,
-	-0.0016713252385457682,
-	-0.0011305516609580112,
-	-0.000058984252379771605,
-	0.0010927113501275497,
-	0.0018150165871310146,
-	0.001763646914842384,
-	0.0009212883196359108,
-	-0.0003770240157604198,
-	-0.001574876618808401,
-	-0.0021308891945313376,
-	-0.0017616372688833441,
-	-0.0005824679356298282,
-	0.0009222424693464977,
-	0.0020956085775786218,
-	0.002393094044518951,
-	0.0016328470476011348,
-	0.0000974174935351104,
-	-0.0015670554166828065,
-	-0.0026204951007699692,
-	-0.002555737882566063,
-	-0.0013394210376813868,
-	0.0005463613504420161,
-	0.002291589257564807,
-	0.0031039148305355975,
-	0.0025657093147136894,
-	0.0008431204760449887,
-	-0.0013556378773637457,
-	-0.003067944060217245,
-	-0.0034953798776595152,
-	-0.0023725265279428724,
-	-0.00011672850330655248,
-	0.0023205308306707313,
-	0.0038514459544942013,
-	0.0037336716651680327,
-	0.0019249961225050664,
-	-0.0008572186424916061,
-	-0.0034147728938534825,
-	-0.004580687927471812,
-	-0.003746688893392467,
-	-0.0011706997169091606,
-	0.002088006525001223,
-	0.004598562087501109,
-	0.0051815730500487074,
-	0.003456136744960588,
-	0.00006051759491688906,
-	-0.003573050467756683,
-	-0.005815821708505998,
-	-0.005565189354970123,
-	-0.002775621140299108,
-	0.0014532215400635223,
-	0.0052992906911675545,
-	0.0069941784110096605,
-	0.005625313491962671,
-	0.0016055342176236013,
-	-0.003423376227721785,
-	-0.007248544632981065,
-	-0.008046173285383217,
-	-0.0052337361169928895,
-	0.00017669323332825836,
-	0.005918843895189252,
-	0.009403195365811214,
-	0.008863379633396585,
-	0.004220061271706842,
-	-0.002747985754877498,
-	-0.009056086445438462,
-	-0.011762257284635437,
-	-0.009302364029877608,
-	-0.0023206125939999483,
-	0.006418631559607882,
-	0.013079379535990705,
-	0.014383389206074985,
-	0.009148328489635597,
-	-0.0009554592809820885,
-	-0.011843342478733506,
-	-0.018578671115925396,
-	-0.017491506994906498,
-	-0.007988305991328236,
-	0.006769634575631006,
-	0.020744218718498783,
-	0.027268025113487974,
-	0.02188268964820689,
-	0.0046631616848481485,
-	-0.018981425017961722,
-	-0.03953118047081118,
-	-0.046353358395405754,
-	-0.031513590415180974,
-	0.006951767317350385,
-	0.06355468525589227,
-	0.12634066338000405,
-	0.18015342152322267,
-	0.21116471178592394,
-	0.21116471178592394,
-	0.18015342152322267,
-	0.12634066338000405,
-	0.06355468525589227,
-	0.006951767317350385,
-	-0.031513590415180974,
-	-0.046353358395405754,
-	-0.03953118047081118,
-	-0.018981425017961722,
-	0.0046631616848481485,
-	0.02188268964820689,
-	0.027268025113487974,
-	0.020744218718498783,
-	0.006769634575631006,
-	-0.007988305991328236,
-	-0.017491506994906498,
-	-0.018578671115925396,
-	-0.011843342478733506,
-	-0.0009554592809820885,
-	0.009148328489635597,
-	0.014383389206074985,
-	0.013079379535990705,
-	0.006418631559607882,
-	-0.0023206125939999483,
-	-0.009302364029877608,
-	-0.011762257284635437,
-	-0.009056086445438462,
-	-0.002747985754877498,
-	0.004220061271706842,
-	0.008863379633396585,
-	0.009403195365811214,
-	0.005918843895189252,
-	0.00017669323332825836,
-	-0.0052337361169928895,
-	-0.008046173285383217,
-	-0.007248544632981065,
-	-0.003423376227721785,
-	0.0016055342176236013,
-	0.005625313491962671,
-	0.0069941784110096605,
-	0.0052992906911675545,
-	0.0014532215400635223,
-	-0.002775621140299108,
-	-0.005565189354970123,
-	-0.005815821708505998,
-	-0.003573050467756683,
-	0.00006051759491688906,
-	0.003456136744960588,
-	0.0051815730500487074,
-	0.004598562087501109,
-	0.002088006525001223,
-	-0.0011706997169091606,
-	-0.003746688893392467,
-	-0.004580687927471812,
-	-0.0034147728938534825,
-	-0.0008572186424916061,
-	0.0019249961225050664,
-	0.0037336716651680327,
-	0.0038514459544942013,
-	0.0023205308306707313,
-	-0.00011672850330655248,
-	-0.0023725265279428724,
-	-0.0034953798776595152,
-	-0.003067944060217245,
-	-0.0013556378773637457,
-	0.0008431204760449887,
-	0.0025657093147136894,
-	0.0031039148305355975,
-	0.002291589257564807,
-	0.0005463613504420161,
-	-0.0013394210376813868,
-	-0.002555737882566063,
-	-0.0026204951007699692,
-	-0.0015670554166828065,
-	0.0000974174935351104,
-	0.0016328470476011348,
-	0.002393094044518951,
-	0.0020956085775786218,
-	0.0009222424693464977,
-	-0.0005824679356298282,
-	-0.0017616372688833441,
-	-0.0021308891945313376,
-	-0.001574876618808401,
-	-0.0003770240157604198,
-	0.0009212883196359108,
-	0.001763646914842384,
-	0.0018150165871310146,
-	0.0010927113501275497,
-	-0.000058984252379771605,
-	-0.0011305516609580112,
-	-0.0016713252385457682,
-	-0.0014766653832796889,
-	-0.000663072753845278,
-	0.0003968193431587274,
-	0.0012425264893252434,
-	0.0015246254110601331,
-	0.0011458284801105026,
-	0.0002922483221796136,
-	-0.0006579273430960248,
-	-0.0012988159655092145,
-	-0.0013694955071465538,
-	-0.0008549445288520884,
-	0.000013227404467096469,
-	0.000864139658383905,
-	0.0013400924004628295,
-	0.0012480415589991593,
-	0.0006273300294782066,
-	-0.0002633112422429481,
-	-0.0010633948799983867,
-	-0.0014427351510568104,
-	-0.0012441589539073105,
-	-0.0005232111270540358,
-	0.00045370439585035757,
-	0.001336560339070561,
-	0.0017846718161288518,
-	0.0016226231807938165,
-	0.0008433142416708619,
-	-0.0003409354608796032,
-	-0.0016504372952480038,
-	-0.0027433333446253505,
-	-0.003424828469518149,
-	-0.003560065932867868,
-	-0.0032510295020445395,
-	-0.002588460321745651,
-	-0.0018437115212335642,
-	-0.0010983932516403473,
-	-0.0005782291659135532,
-	-0.00020550950977696016
-};
-
-
-// -------------------------------------------------------------- //
-//
-// ----------- 512 POINT FIR LPF h[n] arrays -------------------- //
-//
-// -------------------------------------------------------------- //
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 88200 Hz
-
-	* 0 Hz - 21000 Hz
-	gain = 1
-	desired ripple = 0.25 dB
-	actual ripple = 0.005199324540099375 dB
-
-	* 22000 Hz - 44100 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -127.02059767785704 dB
-
-*/
-
-#define FILTER_TAP_512 512
-
-static double LPF512_882[FILTER_TAP_512] = {
-	-0.000006195994840906792,
-	-0.000026377649358938194,
-	-0.000054043331302832245,
-	-0.0000625748223358342,
-	-0.00003223997205516153,
-	0.0000147452125473475,
-	0.00003077870383039477,
-	0.000003563124645343705,
-	-0.00002294830905505994,
-	-0.00001059090336854346,
-	0.00001696069103865903,
-	0.00001367098590270872,
-	-0.000012787633504849568,
-	-0.00001557165334969823,
-	0.00000978189736121662,
-	0.000017158631605142543,
-	-0.00000724683259158293,
-	-0.000018815943700143466,
-	0.000004848609767934331,
-	0.0000205209349075809,
-	-0.000002260411071003147,
-	-0.000022290321874231233,
-	-6.153071440435407e-7,
-	0.000023979883254519524,
-	0.0000039376739731325665,
-	-0.00002553369579698917,
-	-0.000007710844572775586,
-	0.000026786925855711306,
-	0.000012000457131654767,
-	-0.00002766556566174508,
-	-0.000016757864796973997,
-	0.000028013017736212978,
-	0.000021986832516158112,
-	-0.00002775905999987047,
-	-0.000027613883648684807,
-	0.0000267492975725187,
-	0.00003358350051510379,
-	-0.000024931547432790423,
-	-0.00003980918670229983,
-	0.000022146474047997208,
-	0.00004616259190094089,
-	-0.000018389023235252165,
-	-0.000052561849628021374,
-	0.000013496964412195529,
-	0.000058819354528564465,
-	-0.0000074972996309930436,
-	-0.0000648216892882776,
-	2.831657631886811e-7,
-	0.00007038555434723775,
-	0.000008139402590756875,
-	-0.0000753078976065919,
-	-0.0000177588068865946,
-	0.00007945255531665105,
-	0.000028585430657722077,
-	-0.00008256645633929745,
-	-0.00004055075473577912,
-	0.00008447148219486695,
-	0.00005356154544965725,
-	-0.00008497489620620158,
-	-0.00006755064510224186,
-	0.00008385356793586416,
-	0.00008234913986465876,
-	-0.00008091379329291462,
-	-0.00009779004588786714,
-	0.00007599898228994444,
-	0.00011369538424534495,
-	-0.00006890747740257258,
-	-0.00012982950287888245,
-	0.00005949080824638103,
-	0.00014591294212989167,
-	-0.0000476348892079392,
-	-0.00016168342291365687,
-	0.00003322703688888179,
-	0.0001768141274826108,
-	-0.000016191552066758442,
-	-0.00019096431675948668,
-	-0.000003497903858399426,
-	0.00020376463762218023,
-	0.00002582138148753163,
-	-0.00021486741566650955,
-	-0.000050754613833895865,
-	0.00022385260456034395,
-	0.00007818442201731317,
-	-0.00023033118598769854,
-	-0.00010795690404655534,
-	0.00023390218565491627,
-	0.00013986714844614495,
-	-0.00023418228672371447,
-	-0.00017366339446741891,
-	0.00023078594224958324,
-	0.00020904904716808966,
-	-0.00022332224011655606,
-	-0.0002456253476098567,
-	0.00021146487706599572,
-	0.0002829732727342393,
-	-0.000194909994798152,
-	-0.00032061905913575935,
-	0.00017337982458988445,
-	0.00035803113980319574,
-	-0.00014664940544076326,
-	-0.0003946269361630261,
-	0.00011453940928713978,
-	0.0004297657738603572,
-	-0.00007695534187841694,
-	-0.0004627797346210836,
-	0.00003387046185997395,
-	0.0004929883189746337,
-	0.000014694744907729421,
-	-0.0005196548703162037,
-	-0.00006862759446636825,
-	0.0005420198044531272,
-	0.0001277084361987752,
-	-0.0005593349874925304,
-	-0.00019164905885713876,
-	0.0005708333984914364,
-	0.0002600442086810777,
-	-0.0005757803149324551,
-	-0.0003324166629414899,
-	0.0005734445926282148,
-	0.0004081825910835836,
-	-0.0005631210542759525,
-	-0.00048664929060905236,
-	0.0005441536372368009,
-	0.0005670151704975847,
-	-0.0005159632349710595,
-	-0.0006484048126420486,
-	0.00047803293798918305,
-	0.0007298617795392799,
-	-0.00042990051679277046,
-	-0.000810313058585754,
-	0.00037122460101878674,
-	0.0008886277026454501,
-	-0.00030175028182920374,
-	-0.0009635883916922926,
-	0.00022135181645227184,
-	0.0010339237718414512,
-	-0.00013002750654988101,
-	-0.0010983195338453511,
-	0.00002789588222513265,
-	0.0011554042649981422,
-	0.0000847681758926698,
-	-0.0012037833128225879,
-	-0.0002075338538562616,
-	0.0012420563509013478,
-	0.00033981940187376473,
-	-0.0012688164295618187,
-	-0.0004808649365329396,
-	0.001282687465912096,
-	0.0006297455022753481,
-	-0.00128233909362963,
-	-0.0007853765456633203,
-	0.0012664887370605628,
-	0.0009464951114056573,
-	-0.0012339453139755918,
-	-0.0011116968793284726,
-	0.0011835830745581595,
-	0.0012793903316072012,
-	-0.0011144056249439438,
-	-0.0014478382511634994,
-	0.0010255427664766193,
-	0.0016151620239558432,
-	-0.0009162514968678062,
-	-0.0017793135768778697,
-	0.0007859814235022585,
-	0.0019381364554952396,
-	-0.0006343512373974523,
-	-0.0020893475393603065,
-	0.0004611871698484953,
-	0.0022305722085690922,
-	-0.00026651786859894334,
-	-0.0023593378409966985,
-	0.00005061893457424597,
-	0.0024731367124698916,
-	0.00018603470247653247,
-	-0.00256938556511823,
-	-0.00044271629008689315,
-	0.0026454580217906806,
-	0.0007184253470611115,
-	-0.0026987372024602774,
-	-0.0010119219413624479,
-	0.002726593668507558,
-	0.0013216867127299524,
-	-0.002726423178432009,
-	-0.0016459065267764887,
-	0.0026957099974689413,
-	0.0019825352073124677,
-	-0.0026319898314733996,
-	-0.0023292643890997903,
-	0.0025328681616170593,
-	0.0026835073657580557,
-	-0.0023960633420587038,
-	-0.0030424396766719312,
-	0.0022193615471316212,
-	0.003402918241008308,
-	-0.0020007260257193247,
-	-0.0037615632503386976,
-	0.0017382765141078318,
-	0.004114790090526431,
-	-0.001430235147074526,
-	-0.0044587523851526405,
-	0.0010749765891090533,
-	0.0047894045358327884,
-	-0.0006709260735849289,
-	-0.005102360220966174,
-	0.00021670921835698848,
-	0.0053930310992585054,
-	0.00028895894524041043,
-	-0.005656583191286625,
-	-0.000847289735836358,
-	0.0058879656276736025,
-	0.001459564365452713,
-	-0.006081766316045576,
-	-0.0021271183007668198,
-	0.006232171703997593,
-	0.0028513681324375878,
-	-0.006332978768785096,
-	-0.0036339636552196403,
-	0.00637754471273184,
-	0.004477064271420976,
-	-0.006358521512712422,
-	-0.005383505221694079,
-	0.0062675741738918754,
-	0.006356906796259971,
-	-0.0060952806528261905,
-	-0.00740217229833734,
-	0.005830761747808154,
-	0.008526237152037298,
-	-0.005460789059134222,
-	-0.009738601401579585,
-	0.004968985478002457,
-	0.01105234281612278,
-	-0.004334815949473813,
-	-0.012486296902834065,
-	0.0035310407624773795,
-	0.014067380271211155,
-	-0.0025204782593668063,
-	-0.015834601954936373,
-	0.001251135701176492,
-	0.01784712115071517,
-	0.00035431552697836916,
-	-0.020195788061326044,
-	-0.0024146478844802696,
-	0.02302820872756412,
-	0.0051248772614719326,
-	-0.026596964336714025,
-	-0.00882823752346657,
-	0.03137088715623443,
-	0.01419154431839523,
-	-0.03832292503103696,
-	-0.022703228904425193,
-	0.049846816742515954,
-	0.03850005064923437,
-	-0.07381609000828616,
-	-0.0789616351055538,
-	0.16011510901985537,
-	0.4395740755311103,
-	0.4395740755311103,
-	0.16011510901985537,
-	-0.0789616351055538,
-	-0.07381609000828616,
-	0.03850005064923437,
-	0.049846816742515954,
-	-0.022703228904425193,
-	-0.03832292503103696,
-	0.01419154431839523,
-	0.03137088715623443,
-	-0.00882823752346657,
-	-0.026596964336714025,
-	0.0051248772614719326,
-	0.02302820872756412,
-	-0.0024146478844802696,
-	-0.020195788061326044,
-	0.00035431552697836916,
-	0.01784712115071517,
-	0.001251135701176492,
-	-0.015834601954936373,
-	-0.0025204782593668063,
-	0.014067380271211155,
-	0.0035310407624773795,
-	-0.012486296902834065,
-	-0.004334815949473813,
-	0.01105234281612278,
-	0.004968985478002457,
-	-0.009738601401579585,
-	-0.005460789059134222,
-	0.008526237152037298,
-	0.005830761747808154,
-	-0.00740217229833734,
-	-0.0060952806528261905,
-	0.006356906796259971,
-	0.0062675741738918754,
-	-0.005383505221694079,
-	-0.006358521512712422,
-	0.004477064271420976,
-	0.00637754471273184,
-	-0.0036339636552196403,
-	-0.006332978768785096,
-	0.0028513681324375878,
-	0.006232171703997593,
-	-0.0021271183007668198,
-	-0.006081766316045576,
-	0.001459564365452713,
-	0.0058879656276736025,
-	-0.000847289735836358,
-	-0.005656583191286625,
-	0.00028895894524041043,
-	0.0053930310992585054,
-	0.00021670921835698848,
-	-0.005102360220966174,
-	-0.0006709260735849289,
-	0.0047894045358327884,
-	0.0010749765891090533,
-	-0.0044587523851526405,
-	-0.001430235147074526,
-	0.004114790090526431,
-	0.0017382765141078318,
-	-0.0037615632503386976,
-	-0.0020007260257193247,
-	0.003402918241008308,
-	0.0022193615471316212,
-	-0.0030424396766719312,
-	-0.0023960633420587038,
-	0.0026835073657580557,
-	0.0025328681616170593,
-	-0.0023292643890997903,
-	-0.0026319898314733996,
-	0.0019825352073124677,
-	0.0026957099974689413,
-	-0.0016459065267764887,
-	-0.002726423178432009,
-	0.0013216867127299524,
-	0.002726593668507558,
-	-0.0010119219413624479,
-	-0.0026987372024602774,
-	0.0007184253470611115,
-	0.0026454580217906806,
-	-0.00044271629008689315,
-	-0.00256938556511823,
-	0.00018603470247653247,
-	0.0024731367124698916,
-	0.00005061893457424597,
-	-0.0023593378409966985,
-	-0.00026651786859894334,
-	0.0022305722085690922,
-	0.0004611871698484953,
-	-0.0020893475393603065,
-	-0.0006343512373974523,
-	0.0019381364554952396,
-	0.0007859814235022585,
-	-0.0017793135768778697,
-	-0.0009162514968678062,
-	0.0016151620239558432,
-	0.0010255427664766193,
-	-0.0014478382511634994,
-	-0.0011144056249439438,
-	0.0012793903316072012,
-	0.0011835830745581595,
-	-0.0011116968793284726,
-	-0.0012339453139755918,
-	0.0009464951114056573,
-	0.0012664887370605628,
-	-0.0007853765456633203,
-	-0.00128233909362963,
-	0.0006297455022753481,
-	0.001282687465912096,
-	-0.0004808649365329396,
-	-0.0012688164295618187,
-	0.00033981940187376473,
-	0.0012420563509013478,
-	-0.0002075338538562616,
-	-0.0012037833128225879,
-	0.0000847681758926698,
-	0.0011554042649981422,
-	0.00002789588222513265,
-	-0.0010983195338453511,
-	-0.00013002750654988101,
-	0.0010339237718414512,
-	0.00022135181645227184,
-	-0.0009635883916922926,
-	-0.00030175028182920374,
-	0.0008886277026454501,
-	0.00037122460101878674,
-	-0.000810313058585754,
-	-0.00042990051679277046,
-	0.0007298617795392799,
-	0.00047803293798918305,
-	-0.0006484048126420486,
-	-0.0005159632349710595,
-	0.0005670151704975847,
-	0.0005441536372368009,
-	-0.00048664929060905236,
-	-0.0005631210542759525,
-	0.0004081825910835836,
-	0.0005734445926282148,
-	-0.0003324166629414899,
-	-0.0005757803149324551,
-	0.0002600442086810777,
-	0.0005708333984914364,
-	-0.00019164905885713876,
-	-0.0005593349874925304,
-	0.0001277084361987752,
-	0.0005420198044531272,
-	-0.00006862759446636825,
-	-0.0005196548703162037,
-	0.000014694744907729421,
-	0.0004929883189746337,
-	0.00003387046185997395,
-	-0.0004627797346210836,
-	-0.00007695534187841694,
-	0.0004297657738603572,
-	0.00011453940928713978,
-	-0.0003946269361630261,
-	-0.00014664940544076326,
-	0.00035803113980319574,
-	0.00017337982458988445,
-	-0.00032061905913575935,
-	-0.000194909994798152,
-	0.0002829732727342393,
-	0.00021146487706599572,
-	-0.0002456253476098567,
-	-0.00022332224011655606,
-	0.00020904904716808966,
-	0.00023078594224958324,
-	-0.00017366339446741891,
-	-0.00023418228672371447,
-	0.00013986714844614495,
-	0.00023390218565491627,
-	-0.00010795690404655534,
-	-0.00023033118598769854,
-	0.00007818442201731317,
-	0.00022385260456034395,
-	-0.000050754613833895865,
-	-0.00021486741566650955,
-	0.00002582138148753163,
-	0.00020376463762218023,
-	-0.000003497903858399426,
-	-0.00019096431675948668,
-	-0.000016191552066758442,
-	0.0001768141274826108,
-	0.00003322703688888179,
-	-0.00016168342291365687,
-	-0.0000476348892079392,
-	0.00014591294212989167,
-	0.00005949080824638103,
-	-0.00012982950287888245,
-	-0.00006890747740257258,
-	0.00011369538424534495,
-	0.00007599898228994444,
-	-0.00009779004588786714,
-	-0.00008091379329291462,
-	0.00008234913986465876,
-	0.00008385356793586416,
-	-0.00006755064510224186,
-	-0.00008497489620620158,
-	0.00005356154544965725,
-	0.00008447148219486695,
-	-0.00004055075473577912,
-	-0.00008256645633929745,
-	0.000028585430657722077,
-	0.00007945255531665105,
-	-0.0000177588068865946,
-	-0.0000753078976065919,
-	0.000008139402590756875,
-	0.00007038555434723775,
-	2.831657631886811e-7,
-	-0.0000648216892882776,
-	-0.0000074972996309930436,
-	0.000058819354528564465,
-	0.000013496964412195529,
-	-0.000052561849628021374,
-	-0.000018389023235252165,
-	0.00004616259190094089,
-	0.000022146474047997208,
-	-0.00003980918670229983,
-	-0.000024931547432790423,
-	0.00003358350051510379,
-	0.0000267492975725187,
-	-0.000027613883648684807,
-	-0.00002775905999987047,
-	0.000021986832516158112,
-	0.000028013017736212978,
-	-0.000016757864796973997,
-	-0.00002766556566174508,
-	0.000012000457131654767,
-	0.000026786925855711306,
-	-0.000007710844572775586,
-	-0.00002553369579698917,
-	0.0000039376739731325665,
-	0.000023979883254519524,
-	-6.153071440435407e-7,
-	-0.000022290321874231233,
-	-0.000002260411071003147,
-	0.0000205209349075809,
-	0.000004848609767934331,
-	-0.000018815943700143466,
-	-0.00000724683259158293,
-	0.000017158631605142543,
-	0.00000978189736121662,
-	-0.00001557165334969823,
-	-0.000012787633504849568,
-	0.00001367098590270872,
-	0.00001696069103865903,
-	-0.00001059090336854346,
-	-0.00002294830905505994,
-	0.000003563124645343705,
-	0.00003077870383039477,
-	0.0000147452125473475,
-	-0.00003223997205516153,
-	-0.0000625748223358342,
-	-0.000054043331302832245,
-	-0.000026377649358938194,
-	-0.000006195994840906792
-};
-
-
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 176400 Hz
-
-	* 0 Hz - 20000 Hz
-	gain = 1
-	desired ripple = 0.25 dB
-	actual ripple = 0.0056908532915910595 dB
-
-	* 22000 Hz - 88200 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -126.23598846958363 dB
-
-*/
-
-static double LPF512_1764[FILTER_TAP_512] = {
-	6.255501234250186e-7,
-	8.198578571906988e-7,
-	3.329281722470611e-7,
-	-0.0000018550878107492354,
-	-0.000006569495239147186,
-	-0.00001400609750095479,
-	-0.000023256072000604123,
-	-0.00003217804167232055,
-	-0.00003783475874529685,
-	-0.000037485636760785326,
-	-0.00002982705058900596,
-	-0.000015944549862418908,
-	5.680731073247018e-7,
-	0.000014593753316244607,
-	0.00002136702149720017,
-	0.000018535050304469538,
-	0.00000746329878747224,
-	-0.000006963310225127469,
-	-0.000018184727150842466,
-	-0.000020808613284943508,
-	-0.000013212328678446606,
-	0.0000013931335659331755,
-	0.000016141800594014494,
-	0.000023603550944259894,
-	0.00001945068876570262,
-	0.000004912030682659507,
-	-0.00001336070838552017,
-	-0.000026215139093850918,
-	-0.000026491976009062752,
-	-0.000012924915995176225,
-	0.000008643340079857745,
-	0.000027638279163655634,
-	0.00003384381361299466,
-	0.00002280538346483041,
-	-0.0000012699235853844166,
-	-0.00002689993934138208,
-	-0.000040695947165692655,
-	-0.000034264488197076185,
-	-0.000009130998515717974,
-	0.000023126346692494132,
-	0.000046072056737686423,
-	0.00004668846805357955,
-	0.000022616866616515344,
-	-0.000015597171542079424,
-	-0.00004892731594317174,
-	-0.00005922441459914256,
-	-0.000038969516020881094,
-	0.0000037562296338309105,
-	0.00004818346808676126,
-	0.00007080906344631242,
-	0.000057701998354870754,
-	0.000012782083790942892,
-	-0.00004272152568057984,
-	-0.00008012007101302588,
-	-0.00007796004315655036,
-	-0.00003410644040492462,
-	0.00003148838031103519,
-	0.00008560988142111643,
-	0.00009844945982677389,
-	0.00005983245676368031,
-	-0.000013735351984332199,
-	-0.00008574256032699821,
-	-0.00011760940804381603,
-	-0.00008917713610122308,
-	-0.000010957799212262864,
-	0.00007908870334843518,
-	0.00013374737474621085,
-	0.00012112172390833571,
-	0.000042893714473843516,
-	-0.00006402245295344059,
-	-0.00014459649501545767,
-	-0.00015380856494960014,
-	-0.0000815163909379155,
-	0.00003953493354324656,
-	0.0001481172904965725,
-	0.000185260290162801,
-	0.0001260187981007971,
-	-0.000004717531024485414,
-	-0.0001420170332886312,
-	-0.00021287938065315208,
-	-0.00017479917399017796,
-	-0.00004067580874566048,
-	0.00012426703778425143,
-	0.00023384955107229322,
-	0.00022570457269468862,
-	0.00009632601917339345,
-	-0.00009308852638571547,
-	-0.00024511888720901237,
-	-0.0002759437702019248,
-	-0.00016117564055812222,
-	0.00004716868745273417,
-	0.00024357924516081654,
-	0.0003221573404337598,
-	0.00023336437341273697,
-	0.000014180004697116246,
-	-0.0002262320334416849,
-	-0.0003604950436956103,
-	-0.0003101649182712429,
-	-0.00009083134628354153,
-	0.00019041947359585483,
-	0.00038678364792268715,
-	0.0003880094834880845,
-	0.00018172155767401,
-	-0.00013403250892950807,
-	-0.00039670963379626647,
-	-0.00046255120553760957,
-	-0.00028475745725090973,
-	0.00005570549948188805,
-	0.0003860087981188263,
-	0.0005287385761498803,
-	0.00039672181773125743,
-	0.00004495404418156107,
-	-0.00035072184467174094,
-	-0.0005809653060607175,
-	-0.0005132312445212187,
-	-0.00016713728241031335,
-	0.00028750989921982287,
-	0.000613329223161699,
-	0.0006288212770115352,
-	0.0003087151833650743,
-	-0.00019390390282780792,
-	-0.0006198720110294245,
-	-0.0007370421227695293,
-	-0.00046613342464253373,
-	0.00006855656186177763,
-	0.0005948363725136504,
-	0.000830562676403078,
-	0.0006342707114295322,
-	0.00008839529753681509,
-	-0.0005331158079507722,
-	-0.000901532075626963,
-	-0.0008065835466022636,
-	-0.0002752441035690012,
-	0.00043046368229219216,
-	0.0009417317798089862,
-	0.0009750453624106118,
-	0.0004883881428368929,
-	-0.00028398899821224197,
-	-0.0009430586942423698,
-	-0.0011304278938077453,
-	-0.0007223198629916587,
-	0.00009240953279147893,
-	0.0008978447173908743,
-	0.0012624805588079384,
-	0.0009695294820708687,
-	0.00014358855643976408,
-	-0.0007993241710010818,
-	-0.0013602835160160854,
-	-0.0012205744250009124,
-	-0.0004211101549071075,
-	0.0006420500382695926,
-	0.001412611680156885,
-	0.001464184691628184,
-	0.0007348211635524275,
-	-0.0004223608310515933,
-	-0.0014084106764867576,
-	-0.001687509012956958,
-	-0.001076842234739452,
-	0.0001387802354741074,
-	0.0013372787699572658,
-	0.0018764227781045222,
-	0.0014367126471675085,
-	0.0002076118407895264,
-	-0.00118998284668998,
-	-0.0020159170144811753,
-	-0.0018014444634837094,
-	-0.000612864866375655,
-	0.0009589829836472569,
-	0.002090561052748606,
-	0.002155676269755946,
-	0.001069913377465033,
-	-0.0006389533957194307,
-	-0.002085031906667102,
-	-0.0024819394866094258,
-	-0.0015684464234178256,
-	0.00022723719602784088,
-	0.0019846481732588173,
-	0.0027609812583960828,
-	0.002094842673157921,
-	0.0002757331343286583,
-	-0.001775926227529972,
-	-0.0029721653814051754,
-	-0.002632204555364904,
-	-0.0008660843799191434,
-	0.0014471329663950049,
-	0.0030939433576740523,
-	0.0031605195068453726,
-	0.0015362979135817658,
-	-0.0009887153622598907,
-	-0.0031042512809685515,
-	-0.003656793857676254,
-	-0.0022749995985606596,
-	0.0003937506606627825,
-	0.0029809813448948555,
-	0.004095333470099577,
-	0.0030669623100718544,
-	0.00034184042379861094,
-	-0.0027022434857328108,
-	-0.004447901055804358,
-	-0.0038930915953901916,
-	-0.001219158681890362,
-	0.002246530904300016,
-	0.004683846474606422,
-	0.004730538776537894,
-	0.002236473221962142,
-	-0.0015925223529825376,
-	-0.0047699507494077375,
-	-0.005552750732150601,
-	-0.0033895953780453494,
-	0.0007184673868876696,
-	0.004669900069870268,
-	0.006329476776264104,
-	0.004672686880589872,
-	0.00039923463969576825,
-	-0.004342959628086365,
-	-0.007026472426327842,
-	-0.006079584098495936,
-	-0.001788677054717504,
-	0.0037413364837852593,
-	0.0076046778883791626,
-	0.007606022351832437,
-	0.0034873074898985213,
-	-0.0028050501712497174,
-	-0.008018248085170217,
-	-0.009253346613054023,
-	-0.005550856641525483,
-	0.001452049974069874,
-	0.008210300989157055,
-	0.011035135803428832,
-	0.008070538399765601,
-	0.00044162535726229826,
-	-0.00810366496749832,
-	-0.012989989524595779,
-	-0.011208554456509192,
-	-0.00308441451545548,
-	0.00757985408164983,
-	0.01520923076993389,
-	0.015279423365703449,
-	0.006870737744573298,
-	-0.006426298947391551,
-	-0.0179062806136404,
-	-0.020965296192003314,
-	-0.012663356375645148,
-	0.004180873180821772,
-	0.02162902336698179,
-	0.030022126794167325,
-	0.02278906964443957,
-	0.00046414662473379873,
-	-0.028149116701222235,
-	-0.04859085116125247,
-	-0.04637871215039089,
-	-0.01343952932112351,
-	0.047443583827645276,
-	0.12228807608631778,
-	0.19014108221388587,
-	0.23040548893516538,
-	0.23040548893516538,
-	0.19014108221388587,
-	0.12228807608631778,
-	0.047443583827645276,
-	-0.01343952932112351,
-	-0.04637871215039089,
-	-0.04859085116125247,
-	-0.028149116701222235,
-	0.00046414662473379873,
-	0.02278906964443957,
-	0.030022126794167325,
-	0.02162902336698179,
-	0.004180873180821772,
-	-0.012663356375645148,
-	-0.020965296192003314,
-	-0.0179062806136404,
-	-0.006426298947391551,
-	0.006870737744573298,
-	0.015279423365703449,
-	0.01520923076993389,
-	0.00757985408164983,
-	-0.00308441451545548,
-	-0.011208554456509192,
-	-0.012989989524595779,
-	-0.00810366496749832,
-	0.00044162535726229826,
-	0.008070538399765601,
-	0.011035135803428832,
-	0.008210300989157055,
-	0.001452049974069874,
-	-0.005550856641525483,
-	-0.009253346613054023,
-	-0.008018248085170217,
-	-0.0028050501712497174,
-	0.0034873074898985213,
-	0.007606022351832437,
-	0.0076046778883791626,
-	0.0037413364837852593,
-	-0.001788677054717504,
-	-0.006079584098495936,
-	-0.007026472426327842,
-	-0.004342959628086365,
-	0.00039923463969576825,
-	0.004672686880589872,
-	0.006329476776264104,
-	0.004669900069870268,
-	0.0007184673868876696,
-	-0.0033895953780453494,
-	-0.005552750732150601,
-	-0.0047699507494077375,
-	-0.0015925223529825376,
-	0.002236473221962142,
-	0.004730538776537894,
-	0.004683846474606422,
-	0.002246530904300016,
-	-0.001219158681890362,
-	-0.0038930915953901916,
-	-0.004447901055804358,
-	-0.0027022434857328108,
-	0.00034184042379861094,
-	0.0030669623100718544,
-	0.004095333470099577,
-	0.0029809813448948555,
-	0.0003937506606627825,
-	-0.0022749995985606596,
-	-0.003656793857676254,
-	-0.0031042512809685515,
-	-0.0009887153622598907,
-	0.0015362979135817658,
-	0.0031605195068453726,
-	0.0030939433576740523,
-	0.0014471329663950049,
-	-0.0008660843799191434,
-	-0.002632204555364904,
-	-0.0029721653814051754,
-	-0.001775926227529972,
-	0.0002757331343286583,
-	0.002094842673157921,
-	0.0027609812583960828,
-	0.0019846481732588173,
-	0.00022723719602784088,
-	-0.0015684464234178256,
-	-0.0024819394866094258,
-	-0.002085031906667102,
-	-0.0006389533957194307,
-	0.001069913377465033,
-	0.002155676269755946,
-	0.002090561052748606,
-	0.0009589829836472569,
-	-0.000612864866375655,
-	-0.0018014444634837094,
-	-0.0020159170144811753,
-	-0.00118998284668998,
-	0.0002076118407895264,
-	0.0014367126471675085,
-	0.0018764227781045222,
-	0.0013372787699572658,
-	0.0001387802354741074,
-	-0.001076842234739452,
-	-0.001687509012956958,
-	-0.0014084106764867576,
-	-0.0004223608310515933,
-	0.0007348211635524275,
-	0.001464184691628184,
-	0.001412611680156885,
-	0.0006420500382695926,
-	-0.0004211101549071075,
-	-0.0012205744250009124,
-	-0.0013602835160160854,
-	-0.0007993241710010818,
-	0.00014358855643976408,
-	0.0009695294820708687,
-	0.0012624805588079384,
-	0.0008978447173908743,
-	0.00009240953279147893,
-	-0.0007223198629916587,
-	-0.0011304278938077453,
-	-0.0009430586942423698,
-	-0.00028398899821224197,
-	0.0004883881428368929,
-	0.0009750453624106118,
-	0.0009417317798089862,
-	0.00043046368229219216,
-	-0.0002752441035690012,
-	-0.0008065835466022636,
-	-0.000901532075626963,
-	-0.0005331158079507722,
-	0.00008839529753681509,
-	0.0006342707114295322,
-	0.000830562676403078,
-	0.0005948363725136504,
-	0.00006855656186177763,
-	-0.00046613342464253373,
-	-0.0007370421227695293,
-	-0.0006198720110294245,
-	-0.00019390390282780792,
-	0.0003087151833650743,
-	0.0006288212770115352,
-	0.000613329223161699,
-	0.00028750989921982287,
-	-0.00016713728241031335,
-	-0.0005132312445212187,
-	-0.0005809653060607175,
-	-0.00035072184467174094,
-	0.00004495404418156107,
-	0.00039672181773125743,
-	0.0005287385761498803,
-	0.0003860087981188263,
-	0.00005570549948188805,
-	-0.00028475745725090973,
-	-0.00046255120553760957,
-	-0.00039670963379626647,
-	-0.00013403250892950807,
-	0.00018172155767401,
-	0.0003880094834880845,
-	0.00038678364792268715,
-	0.00019041947359585483,
-	-0.00009083134628354153,
-	-0.0003101649182712429,
-	-0.0003604950436956103,
-	-0.0002262320334416849,
-	0.000014180004697116246,
-	0.00023336437341273697,
-	0.0003221573404337598,
-	0.00024357924516081654,
-	0.00004716868745273417,
-	-0.00016117564055812222,
-	-0.0002759437702019248,
-	-0.00024511888720901237,
-	-0.00009308852638571547,
-	0.00009632601917339345,
-	0.00022570457269468862,
-	0.00023384955107229322,
-	0.00012426703778425143,
-	-0.00004067580874566048,
-	-0.00017479917399017796,
-	-0.00021287938065315208,
-	-0.0001420170332886312,
-	-0.000004717531024485414,
-	0.0001260187981007971,
-	0.000185260290162801,
-	0.0001481172904965725,
-	0.00003953493354324656,
-	-0.0000815163909379155,
-	-0.00015380856494960014,
-	-0.00014459649501545767,
-	-0.00006402245295344059,
-	0.000042893714473843516,
-	0.00012112172390833571,
-	0.00013374737474621085,
-	0.00007908870334843518,
-	-0.000010957799212262864,
-	-0.00008917713610122308,
-	-0.00011760940804381603,
-	-0.00008574256032699821,
-	-0.000013735351984332199,
-	0.00005983245676368031,
-	0.00009844945982677389,
-	0.00008560988142111643,
-	0.00003148838031103519,
-	-0.00003410644040492462,
-	-0.00007796004315655036,
-	-0.00008012007101302588,
-	-0.00004272152568057984,
-	0.000012782083790942892,
-	0.000057701998354870754,
-	0.00007080906344631242,
-	0.00004818346808676126,
-	0.0000037562296338309105,
-	-0.000038969516020881094,
-	-0.00005922441459914256,
-	-0.00004892731594317174,
-	-0.000015597171542079424,
-	0.000022616866616515344,
-	0.00004668846805357955,
-	0.000046072056737686423,
-	0.000023126346692494132,
-	-0.000009130998515717974,
-	-0.000034264488197076185,
-	-0.000040695947165692655,
-	-0.00002689993934138208,
-	-0.0000012699235853844166,
-	0.00002280538346483041,
-	0.00003384381361299466,
-	0.000027638279163655634,
-	0.000008643340079857745,
-	-0.000012924915995176225,
-	-0.000026491976009062752,
-	-0.000026215139093850918,
-	-0.00001336070838552017,
-	0.000004912030682659507,
-	0.00001945068876570262,
-	0.000023603550944259894,
-	0.000016141800594014494,
-	0.0000013931335659331755,
-	-0.000013212328678446606,
-	-0.000020808613284943508,
-	-0.000018184727150842466,
-	-0.000006963310225127469,
-	0.00000746329878747224,
-	0.000018535050304469538,
-	0.00002136702149720017,
-	0.000014593753316244607,
-	5.680731073247018e-7,
-	-0.000015944549862418908,
-	-0.00002982705058900596,
-	-0.000037485636760785326,
-	-0.00003783475874529685,
-	-0.00003217804167232055,
-	-0.000023256072000604123,
-	-0.00001400609750095479,
-	-0.000006569495239147186,
-	-0.0000018550878107492354,
-	3.329281722470611e-7,
-	8.198578571906988e-7,
-	6.255501234250186e-7
-};
-
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 96000 Hz
-
-	* 0 Hz - 20500 Hz
-	gain = 1
-	desired ripple = 0.25 dB
-	actual ripple = 0.00044554881488090205 dB
-
-	* 22000 Hz - 48000 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -106.71065150051679 dB
-
-*/
-
-static double LPF512_96[FILTER_TAP_512] = {
-	1.2138155970611815e-10,
-	5.419283443575595e-10,
-	-4.609116073928297e-10,
-	-1.6057815852409051e-9,
-	1.585397317300865e-10,
-	2.7717381872645507e-9,
-	7.944397152207334e-10,
-	-4.0406250819100654e-9,
-	-2.830734113398273e-9,
-	4.955312284710744e-9,
-	6.223193567292987e-9,
-	-4.937936098146776e-9,
-	-1.149718433545192e-8,
-	2.3945149052476393e-9,
-	1.8242595866114528e-8,
-	4.571720061089191e-9,
-	-2.5090584302318893e-8,
-	-1.833525415942144e-8,
-	2.8353405098959672e-8,
-	3.9882872499113733e-8,
-	-2.2605046554938116e-8,
-	-6.794166637395703e-8,
-	6.919290866626263e-10,
-	9.654076871051592e-8,
-	4.352238221339384e-8,
-	-1.1475283380348681e-7,
-	-1.1282060101577335e-7,
-	1.063111338506801e-7,
-	2.0207957494919066e-7,
-	-5.298886678963443e-8,
-	-2.9575904337720857e-7,
-	-6.123630603357067e-8,
-	3.65552263293152e-7,
-	2.42352907189769e-7,
-	-3.7298388875184573e-7,
-	-4.794610478614625e-7,
-	2.74633471163643e-7,
-	7.37563605448485e-7,
-	-3.360777388342856e-8,
-	-9.56030307332502e-7,
-	-3.6730972899302717e-7,
-	0.0000010517115070353634,
-	9.09842575314164e-7,
-	-9.318896474507694e-7,
-	-0.0000015290820804498794,
-	5.135656050019221e-7,
-	0.000002107919814424774,
-	2.494594177906154e-7,
-	-0.0000024848027011032426,
-	-0.0000013397680338655847,
-	0.0000024739040596426665,
-	0.000002652650924758287,
-	-0.000001901327494748894,
-	-0.000003986641511519522,
-	6.502470118910284e-7,
-	0.000005051623833911364,
-	0.0000012887044747096768,
-	-0.000005502686629270356,
-	-0.0000037758440362054614,
-	0.000004996552360030545,
-	0.000006498199709707043,
-	-0.0000032690645644996672,
-	-0.000008977691120724447,
-	2.1913619639647286e-7,
-	0.000010616210442297035,
-	0.000004013413129164568,
-	-0.000010783028154459121,
-	-0.000008998804629755009,
-	0.000008934491572152434,
-	0.000014012134824555416,
-	-0.000004754003826496049,
-	-0.00001808979519437971,
-	-0.0000017150771381245663,
-	0.000020149274590521402,
-	0.000009969095771614776,
-	-0.000019169210416536448,
-	-0.00001900950000415538,
-	0.000014405676816491412,
-	0.000027394605391920655,
-	-0.000005614970297904382,
-	-0.000033393862485535225,
-	-0.000006763238037102976,
-	0.00003523669855807393,
-	0.000021504272877746304,
-	-0.000031435152764986824,
-	-0.000036621951602192004,
-	0.000021132637438300176,
-	0.00004953922513582121,
-	-0.000004422657675785303,
-	-0.00005741244502081729,
-	-0.000017433308242291467,
-	0.00005758051475907324,
-	0.000041948806463490524,
-	-0.00004808788595090281,
-	-0.00006556690126811114,
-	0.000028198038358981674,
-	0.00008404099236581953,
-	0.0000011944628912025806,
-	-0.00009302578279495699,
-	-0.00003735337473687363,
-	0.00008881310857290007,
-	0.00007576823509786806,
-	-0.00006911527994737682,
-	-0.00011054927349349643,
-	0.00003376314516492178,
-	0.0001351430268246861,
-	0.000014817452839094533,
-	-0.00014331106989801706,
-	-0.00007148172152916054,
-	0.0001302494748925311,
-	0.00012868097422549633,
-	-0.00009368625912653273,
-	-0.0001772501451382959,
-	0.00003476038341116181,
-	0.0002076181492919092,
-	0.000041504920059414846,
-	-0.00021131696632644122,
-	-0.00012629295300728167,
-	0.00018258480989676986,
-	0.0002077313972888846,
-	-0.00011981411842221575,
-	-0.00027227196458285064,
-	0.000026571143585100326,
-	0.00030659022318201,
-	0.0000880532091640322,
-	-0.00029978338560945753,
-	-0.0002099370928775393,
-	0.0002455500671644481,
-	0.0003213229883393806,
-	-0.00014399454673120644,
-	-0.0004030386477567628,
-	0.000002695385589951567,
-	0.00043731251616488403,
-	0.00016325080492189052,
-	-0.00041082570850422553,
-	-0.0003323843563917429,
-	0.0003175413780622776,
-	0.00047923473839667674,
-	-0.00016082537208473048,
-	-0.0005776812901450553,
-	-0.000045593724806287324,
-	0.0006049358363144935,
-	0.0002781503556800465,
-	-0.0005456106949551618,
-	-0.0005055954076732706,
-	0.00039523685044493527,
-	0.000692672988335132,
-	-0.00016260037822294062,
-	-0.0008049663639650834,
-	-0.00012964383986568772,
-	0.000814317265578408,
-	0.0004464188928925065,
-	-0.0007040565818171654,
-	-0.0007438003368452245,
-	0.0004732029577295833,
-	0.0009744549792782813,
-	-0.00013883972035955424,
-	-0.0010943610929329808,
-	-0.00026394794095907823,
-	0.001069944354293975,
-	0.0006848904058867232,
-	-0.0008845926241004107,
-	-0.0010640427271984818,
-	0.0005434678445997065,
-	0.001339494072165264,
-	-0.00007566285837172658,
-	-0.001456393168890985,
-	-0.00046696979998520966,
-	0.0013760872975030827,
-	0.001014560955109268,
-	-0.0010840123567844274,
-	-0.0014872782746148073,
-	0.0005949871537764677,
-	0.001805890544596317,
-	0.00004520057709217053,
-	-0.0019035753286925062,
-	-0.0007626118650423169,
-	0.0017373589669967653,
-	0.0014624911601725816,
-	-0.0012974489927840749,
-	-0.0020405782209838995,
-	0.0006128230111456374,
-	0.0023971991294713104,
-	0.00024819085987550334,
-	-0.0024523967451147034,
-	-0.0011830199606912496,
-	0.002160004398264151,
-	0.0020655544458048607,
-	-0.0015184915449051979,
-	-0.00276155044454092,
-	0.0005766320702106934,
-	0.003147035376393053,
-	0.0005674130715080964,
-	-0.0031274086576086875,
-	-0.0017742183015933726,
-	0.00265457480121703,
-	0.0028780690671078185,
-	-0.0017394471368732977,
-	-0.0037074313367540814,
-	0.0004575289153024575,
-	0.0041086283830177065,
-	0.0010539795481213491,
-	-0.00396975461940144,
-	-0.0026080785613953085,
-	0.0032415108078553477,
-	0.0039881979337965095,
-	-0.001951740296980824,
-	-0.00497487109926182,
-	0.000210983183645058,
-	0.005375892334482355,
-	0.0017926686470768726,
-	-0.005056238734957119,
-	-0.0038098593115647233,
-	0.003963708358707445,
-	0.005556388442953898,
-	-0.0021464241267960065,
-	-0.006747322792173467,
-	-0.00024093065156838604,
-	0.00713512967119237,
-	0.0029440794706771683,
-	-0.006547333585333546,
-	-0.00562972391888435,
-	0.004918887755805245,
-	0.007918412822481456,
-	-0.0023147636690071614,
-	-0.009426760922308243,
-	-0.0010608258042524774,
-	0.00981469314310415,
-	0.00487069225355118,
-	-0.008832509172382966,
-	-0.00866670619554336,
-	0.006362311680420789,
-	0.011925826508774221,
-	-0.0024488416131766316,
-	-0.014096319016855163,
-	-0.0026839699835650155,
-	0.014648493819733946,
-	0.008632359467974677,
-	-0.013122662919275113,
-	-0.014826705749091899,
-	0.009165352811580272,
-	0.020554627849737474,
-	-0.0025421315981719434,
-	-0.024980723285590662,
-	-0.006891415518320579,
-	0.02713540413159047,
-	0.019300358418,
-	-0.025802551550327686,
-	-0.03517894239296589,
-	0.019078414114991605,
-	0.0563065997971831,
-	-0.0025899851316930427,
-	-0.0898616235693177,
-	-0.04107178824493677,
-	0.1850164463566012,
-	0.4072084540318375,
-	0.4072084540318375,
-	0.1850164463566012,
-	-0.04107178824493677,
-	-0.0898616235693177,
-	-0.0025899851316930427,
-	0.0563065997971831,
-	0.019078414114991605,
-	-0.03517894239296589,
-	-0.025802551550327686,
-	0.019300358418,
-	0.02713540413159047,
-	-0.006891415518320579,
-	-0.024980723285590662,
-	-0.0025421315981719434,
-	0.020554627849737474,
-	0.009165352811580272,
-	-0.014826705749091899,
-	-0.013122662919275113,
-	0.008632359467974677,
-	0.014648493819733946,
-	-0.0026839699835650155,
-	-0.014096319016855163,
-	-0.0024488416131766316,
-	0.011925826508774221,
-	0.006362311680420789,
-	-0.00866670619554336,
-	-0.008832509172382966,
-	0.00487069225355118,
-	0.00981469314310415,
-	-0.0010608258042524774,
-	-0.009426760922308243,
-	-0.0023147636690071614,
-	0.007918412822481456,
-	0.004918887755805245,
-	-0.00562972391888435,
-	-0.006547333585333546,
-	0.0029440794706771683,
-	0.00713512967119237,
-	-0.00024093065156838604,
-	-0.006747322792173467,
-	-0.0021464241267960065,
-	0.005556388442953898,
-	0.003963708358707445,
-	-0.0038098593115647233,
-	-0.005056238734957119,
-	0.0017926686470768726,
-	0.005375892334482355,
-	0.000210983183645058,
-	-0.00497487109926182,
-	-0.001951740296980824,
-	0.0039881979337965095,
-	0.0032415108078553477,
-	-0.0026080785613953085,
-	-0.00396975461940144,
-	0.0010539795481213491,
-	0.0041086283830177065,
-	0.0004575289153024575,
-	-0.0037074313367540814,
-	-0.0017394471368732977,
-	0.0028780690671078185,
-	0.00265457480121703,
-	-0.0017742183015933726,
-	-0.0031274086576086875,
-	0.0005674130715080964,
-	0.003147035376393053,
-	0.0005766320702106934,
-	-0.00276155044454092,
-	-0.0015184915449051979,
-	0.0020655544458048607,
-	0.002160004398264151,
-	-0.0011830199606912496,
-	-0.0024523967451147034,
-	0.00024819085987550334,
-	0.0023971991294713104,
-	0.0006128230111456374,
-	-0.0020405782209838995,
-	-0.0012974489927840749,
-	0.0014624911601725816,
-	0.0017373589669967653,
-	-0.0007626118650423169,
-	-0.0019035753286925062,
-	0.00004520057709217053,
-	0.001805890544596317,
-	0.0005949871537764677,
-	-0.0014872782746148073,
-	-0.0010840123567844274,
-	0.001014560955109268,
-	0.0013760872975030827,
-	-0.00046696979998520966,
-	-0.001456393168890985,
-	-0.00007566285837172658,
-	0.001339494072165264,
-	0.0005434678445997065,
-	-0.0010640427271984818,
-	-0.0008845926241004107,
-	0.0006848904058867232,
-	0.001069944354293975,
-	-0.00026394794095907823,
-	-0.0010943610929329808,
-	-0.00013883972035955424,
-	0.0009744549792782813,
-	0.0004732029577295833,
-	-0.0007438003368452245,
-	-0.0007040565818171654,
-	0.0004464188928925065,
-	0.000814317265578408,
-	-0.00012964383986568772,
-	-0.0008049663639650834,
-	-0.00016260037822294062,
-	0.000692672988335132,
-	0.00039523685044493527,
-	-0.0005055954076732706,
-	-0.0005456106949551618,
-	0.0002781503556800465,
-	0.0006049358363144935,
-	-0.000045593724806287324,
-	-0.0005776812901450553,
-	-0.00016082537208473048,
-	0.00047923473839667674,
-	0.0003175413780622776,
-	-0.0003323843563917429,
-	-0.00041082570850422553,
-	0.00016325080492189052,
-	0.00043731251616488403,
-	0.000002695385589951567,
-	-0.0004030386477567628,
-	-0.00014399454673120644,
-	0.0003213229883393806,
-	0.0002455500671644481,
-	-0.0002099370928775393,
-	-0.00029978338560945753,
-	0.0000880532091640322,
-	0.00030659022318201,
-	0.000026571143585100326,
-	-0.00027227196458285064,
-	-0.00011981411842221575,
-	0.0002077313972888846,
-	0.00018258480989676986,
-	-0.00012629295300728167,
-	-0.00021131696632644122,
-	0.000041504920059414846,
-	0.0002076181492919092,
-	0.00003476038341116181,
-	-0.0001772501451382959,
-	-0.00009368625912653273,
-	0.00012868097422549633,
-	0.0001302494748925311,
-	-0.00007148172152916054,
-	-0.00014331106989801706,
-	0.000014817452839094533,
-	0.0001351430268246861,
-	0.00003376314516492178,
-	-0.00011054927349349643,
-	-0.00006911527994737682,
-	0.00007576823509786806,
-	0.00008881310857290007,
-	-0.00003735337473687363,
-	-0.00009302578279495699,
-	0.0000011944628912025806,
-	0.00008404099236581953,
-	0.000028198038358981674,
-	-0.00006556690126811114,
-	-0.00004808788595090281,
-	0.000041948806463490524,
-	0.00005758051475907324,
-	-0.000017433308242291467,
-	-0.00005741244502081729,
-	-0.000004422657675785303,
-	0.00004953922513582121,
-	0.000021132637438300176,
-	-0.000036621951602192004,
-	-0.000031435152764986824,
-	0.000021504272877746304,
-	0.00003523669855807393,
-	-0.000006763238037102976,
-	-0.000033393862485535225,
-	-0.000005614970297904382,
-	0.000027394605391920655,
-	0.000014405676816491412,
-	-0.00001900950000415538,
-	-0.000019169210416536448,
-	0.000009969095771614776,
-	0.000020149274590521402,
-	-0.0000017150771381245663,
-	-0.00001808979519437971,
-	-0.000004754003826496049,
-	0.000014012134824555416,
-	0.000008934491572152434,
-	-0.000008998804629755009,
-	-0.000010783028154459121,
-	0.000004013413129164568,
-	0.000010616210442297035,
-	2.1913619639647286e-7,
-	-0.000008977691120724447,
-	-0.0000032690645644996672,
-	0.000006498199709707043,
-	0.000004996552360030545,
-	-0.0000037758440362054614,
-	-0.000005502686629270356,
-	0.0000012887044747096768,
-	0.000005051623833911364,
-	6.502470118910284e-7,
-	-0.000003986641511519522,
-	-0.000001901327494748894,
-	0.000002652650924758287,
-	0.0000024739040596426665,
-	-0.0000013397680338655847,
-	-0.0000024848027011032426,
-	2.494594177906154e-7,
-	0.000002107919814424774,
-	5.135656050019221e-7,
-	-0.0000015290820804498794,
-	-9.318896474507694e-7,
-	9.09842575314164e-7,
-	0.0000010517115070353634,
-	-3.6730972899302717e-7,
-	-9.56030307332502e-7,
-	-3.360777388342856e-8,
-	7.37563605448485e-7,
-	2.74633471163643e-7,
-	-4.794610478614625e-7,
-	-3.7298388875184573e-7,
-	2.42352907189769e-7,
-	3.65552263293152e-7,
-	-6.123630603357067e-8,
-	-2.9575904337720857e-7,
-	-5.298886678963443e-8,
-	2.0207957494919066e-7,
-	1.063111338506801e-7,
-	-1.1282060101577335e-7,
-	-1.1475283380348681e-7,
-	4.352238221339384e-8,
-	9.654076871051592e-8,
-	6.919290866626263e-10,
-	-6.794166637395703e-8,
-	-2.2605046554938116e-8,
-	3.9882872499113733e-8,
-	2.8353405098959672e-8,
-	-1.833525415942144e-8,
-	-2.5090584302318893e-8,
-	4.571720061089191e-9,
-	1.8242595866114528e-8,
-	2.3945149052476393e-9,
-	-1.149718433545192e-8,
-	-4.937936098146776e-9,
-	6.223193567292987e-9,
-	4.955312284710744e-9,
-	-2.830734113398273e-9,
-	-4.0406250819100654e-9,
-	7.944397152207334e-10,
-	2.7717381872645507e-9,
-	1.585397317300865e-10,
-	-1.6057815852409051e-9,
-	-4.609116073928297e-10,
-	5.419283443575595e-10,
-	1.2138155970611815e-10
-};
-
-
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 192000 Hz
-
-	* 0 Hz - 20500 Hz
-	gain = 1
-	desired ripple = 0.25 dB
-	actual ripple = 0.10024679354423573 dB
-
-	* 22000 Hz - 96000 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -101.31822256212008 dB
-
-*/
-
-static double LPF512_192[FILTER_TAP_512] = {
-	-0.000011348704130670158,
-	-0.00004572544427306656,
-	-0.00009953982240883068,
-	-0.0001866512871079807,
-	-0.0002942749692501728,
-	-0.0004104791899414881,
-	-0.000508239871116061,
-	-0.0005606755597108268,
-	-0.0005439148698531448,
-	-0.00044910566931673365,
-	-0.0002867835628798392,
-	-0.00008823702655229492,
-	0.00010170646004511305,
-	0.00023686104257872158,
-	0.00028449683041105613,
-	0.00023692949769467454,
-	0.00011564430714093834,
-	-0.00003461270486414098,
-	-0.00016038601362440848,
-	-0.00021802943662123627,
-	-0.0001894434337325765,
-	-0.00008887906767754188,
-	0.00004230624869418396,
-	0.00015145858691100874,
-	0.00019521937372632433,
-	0.0001568608293703434,
-	0.0000532498242922933,
-	-0.00007175132653725382,
-	-0.0001651762781801039,
-	-0.00018704055476519198,
-	-0.00012748407154133598,
-	-0.00001154017821527332,
-	0.00011091048566953576,
-	0.00018618036508347017,
-	0.0001800836775697785,
-	0.00009345459043653895,
-	-0.00003720216999159761,
-	-0.00015475352605099596,
-	-0.00020614222731852967,
-	-0.000166166889498079,
-	-0.00004974131963684903,
-	0.00009331340050751315,
-	0.00019932348422556297,
-	0.00021889637010518464,
-	0.0001397783798689345,
-	-0.000006078559223147888,
-	-0.0001551380746705934,
-	-0.00023973957169053317,
-	-0.0002186406419487102,
-	-0.00009691426237370909,
-	0.00007430963332300958,
-	0.0002190819423100913,
-	0.00027013559917648963,
-	0.00019997010638154073,
-	0.00003521782695612677,
-	-0.0001530441859788921,
-	-0.0002797433314405789,
-	-0.00028408268780404637,
-	-0.0001584912886531051,
-	0.000045439552319925564,
-	0.00023784435917556385,
-	0.00032999011288425777,
-	0.0002750171645259084,
-	0.00009138040791600163,
-	-0.00014257659721486946,
-	-0.0003217953430253818,
-	-0.00036149332050806047,
-	-0.00023704617109859144,
-	0.000001913333622127115,
-	0.00025085952185720147,
-	0.00039588206825397215,
-	0.0003656151857573588,
-	0.00016600796814113096,
-	-0.00011886644450972869,
-	-0.0003619076099331978,
-	-0.00044949562704502946,
-	-0.0003343832720442384,
-	-0.00006044475389747455,
-	0.0002534001385681851,
-	0.00046455534732328245,
-	0.00047133700111162143,
-	0.00026162390892442574,
-	-0.00007757452165399713,
-	-0.00039579911469299583,
-	-0.0005456453698811256,
-	-0.00045081133560027307,
-	-0.00014437612504758078,
-	0.0002416588886688631,
-	0.0005329047394220694,
-	0.0005911299224481199,
-	0.00037955238679714863,
-	-0.000015830258780649598,
-	-0.00042062023964949233,
-	-0.0006486590077608275,
-	-0.0005873812290521887,
-	-0.00025286558444324533,
-	0.0002121314404936958,
-	0.0005986888241445059,
-	0.000725322172117188,
-	0.000522867286711647,
-	0.00007108047862322127,
-	-0.0004319664029921087,
-	-0.0007563885691288192,
-	-0.000745268613954907,
-	-0.00039008475836334084,
-	0.00015927631879570468,
-	0.00065723964418903,
-	0.0008720082233182957,
-	0.000693133952985187,
-	0.00018741861643375909,
-	-0.00042478840954901194,
-	-0.0008651776630479138,
-	-0.0009236822743224579,
-	-0.000558209846561876,
-	0.00007923220698079797,
-	0.0007050451307828392,
-	0.0010298304272684964,
-	0.0008918512780400293,
-	0.00033676677699617184,
-	-0.00039533027946339914,
-	-0.0009732288447524023,
-	-0.0011240726218721309,
-	-0.0007617058544379052,
-	-0.00003373084268959067,
-	0.0007376601256062714,
-	0.0011978313021278964,
-	0.0011223359814957787,
-	0.0005256474130290235,
-	-0.0003363774756377516,
-	-0.001075534060163285,
-	-0.001345659186698823,
-	-0.0010042302574217437,
-	-0.0001859844829377685,
-	0.0007488604447383905,
-	0.0013726194436395054,
-	0.0013853186950655656,
-	0.0007581962184398505,
-	-0.0002427911262748304,
-	-0.0011688693205117386,
-	-0.001589116985822746,
-	-0.0012903928546062673,
-	-0.00038404703807706374,
-	0.0007334429574038483,
-	0.0015532085830992151,
-	0.0016851511403913689,
-	0.0010427826785368176,
-	-0.00010547042976277846,
-	-0.0012472448737728076,
-	-0.0018541990663252213,
-	-0.0016258227438163246,
-	-0.000636911159608579,
-	0.0006831148269355421,
-	0.0017357552543558058,
-	0.002024076313011098,
-	0.0013864035951655447,
-	0.00008357309965300958,
-	-0.0013061211600283093,
-	-0.0021427669641803796,
-	-0.0020186842351393062,
-	-0.0009557354801521419,
-	0.0005888558083409832,
-	0.0019179487586540897,
-	0.002408245235103737,
-	0.0018015784943568008,
-	0.000338024068961838,
-	-0.0013366388421516032,
-	-0.0024547351662749465,
-	-0.0024775751875139905,
-	-0.0013534631901747653,
-	0.0004400468697239229,
-	0.002097354609673214,
-	0.0028455139305107965,
-	0.0023034346350867935,
-	0.0006732773720338036,
-	-0.0013309861170667672,
-	-0.0027947581857569515,
-	-0.0030188110769089832,
-	-0.0018515194343593504,
-	0.0002197714408237766,
-	0.0022698035782669945,
-	0.003347121367584713,
-	0.0029139803697855785,
-	0.0011117810528889394,
-	-0.0012776836269534349,
-	-0.0031692506567746227,
-	-0.003665345759674223,
-	-0.002479603702428122,
-	-0.00009426382687906465,
-	0.0024323197441618195,
-	0.00393296857581636,
-	0.003668525274618571,
-	0.0016883641759220611,
-	-0.0011597162813471653,
-	-0.003589319746315907,
-	-0.004453776504955099,
-	-0.0032841450268269383,
-	-0.0005359307924564218,
-	0.002582285813367189,
-	0.004636928756117987,
-	0.0046249930412177705,
-	0.0024589142363015226,
-	-0.0009515846523046888,
-	-0.004076599073144366,
-	-0.005448127068147286,
-	-0.004344871044361679,
-	-0.0011625001132347834,
-	0.0027169814874848713,
-	0.005519910342113978,
-	0.0058862134839004175,
-	0.003522205032021172,
-	-0.0006092436768660271,
-	-0.004672330965155837,
-	-0.006766954572206708,
-	-0.0058092533184345395,
-	-0.0020796222129161137,
-	0.002833456054251748,
-	0.00670025714708632,
-	0.007651633020075574,
-	0.005070153452809452,
-	-0.00004880625706078929,
-	-0.0054639760549092,
-	-0.008656095416683487,
-	-0.007984503013000306,
-	-0.0035082650233681503,
-	0.002929609292963826,
-	0.00844125285026659,
-	0.010368459242976307,
-	0.007539002214434595,
-	0.0009223422848698358,
-	-0.006661134141794343,
-	-0.011712241821553563,
-	-0.011631503013634241,
-	-0.0060072772593957715,
-	0.003003496078542107,
-	0.011452001108030664,
-	0.01527332928525692,
-	0.012171360651785118,
-	0.0028684857237294575,
-	-0.008911118604626707,
-	-0.017841433607244692,
-	-0.019283508231622642,
-	-0.01152318431896022,
-	0.0030535082021585346,
-	0.018493284786571727,
-	0.027483553157441946,
-	0.024474999357260732,
-	0.008488866678763642,
-	-0.01561471880289819,
-	-0.038115614496158814,
-	-0.04751896433464264,
-	-0.0347476859059995,
-	0.003078850635936987,
-	0.0607571312123494,
-	0.12585773905727404,
-	0.18220017219238419,
-	0.2148360381207516,
-	0.2148360381207516,
-	0.18220017219238419,
-	0.12585773905727404,
-	0.0607571312123494,
-	0.003078850635936987,
-	-0.0347476859059995,
-	-0.04751896433464264,
-	-0.038115614496158814,
-	-0.01561471880289819,
-	0.008488866678763642,
-	0.024474999357260732,
-	0.027483553157441946,
-	0.018493284786571727,
-	0.0030535082021585346,
-	-0.01152318431896022,
-	-0.019283508231622642,
-	-0.017841433607244692,
-	-0.008911118604626707,
-	0.0028684857237294575,
-	0.012171360651785118,
-	0.01527332928525692,
-	0.011452001108030664,
-	0.003003496078542107,
-	-0.0060072772593957715,
-	-0.011631503013634241,
-	-0.011712241821553563,
-	-0.006661134141794343,
-	0.0009223422848698358,
-	0.007539002214434595,
-	0.010368459242976307,
-	0.00844125285026659,
-	0.002929609292963826,
-	-0.0035082650233681503,
-	-0.007984503013000306,
-	-0.008656095416683487,
-	-0.0054639760549092,
-	-0.00004880625706078929,
-	0.005070153452809452,
-	0.007651633020075574,
-	0.00670025714708632,
-	0.002833456054251748,
-	-0.0020796222129161137,
-	-0.0058092533184345395,
-	-0.006766954572206708,
-	-0.004672330965155837,
-	-0.0006092436768660271,
-	0.003522205032021172,
-	0.0058862134839004175,
-	0.005519910342113978,
-	0.0027169814874848713,
-	-0.0011625001132347834,
-	-0.004344871044361679,
-	-0.005448127068147286,
-	-0.004076599073144366,
-	-0.0009515846523046888,
-	0.0024589142363015226,
-	0.0046249930412177705,
-	0.004636928756117987,
-	0.002582285813367189,
-	-0.0005359307924564218,
-	-0.0032841450268269383,
-	-0.004453776504955099,
-	-0.003589319746315907,
-	-0.0011597162813471653,
-	0.0016883641759220611,
-	0.003668525274618571,
-	0.00393296857581636,
-	0.0024323197441618195,
-	-0.00009426382687906465,
-	-0.002479603702428122,
-	-0.003665345759674223,
-	-0.0031692506567746227,
-	-0.0012776836269534349,
-	0.0011117810528889394,
-	0.0029139803697855785,
-	0.003347121367584713,
-	0.0022698035782669945,
-	0.0002197714408237766,
-	-0.0018515194343593504,
-	-0.0030188110769089832,
-	-0.0027947581857569515,
-	-0.0013309861170667672,
-	0.0006732773720338036,
-	0.0023034346350867935,
-	0.0028455139305107965,
-	0.002097354609673214,
-	0.0004400468697239229,
-	-0.0013534631901747653,
-	-0.0024775751875139905,
-	-0.0024547351662749465,
-	-0.0013366388421516032,
-	0.000338024068961838,
-	0.0018015784943568008,
-	0.002408245235103737,
-	0.0019179487586540897,
-	0.0005888558083409832,
-	-0.0009557354801521419,
-	-0.0020186842351393062,
-	-0.0021427669641803796,
-	-0.0013061211600283093,
-	0.00008357309965300958,
-	0.0013864035951655447,
-	0.002024076313011098,
-	0.0017357552543558058,
-	0.0006831148269355421,
-	-0.000636911159608579,
-	-0.0016258227438163246,
-	-0.0018541990663252213,
-	-0.0012472448737728076,
-	-0.00010547042976277846,
-	0.0010427826785368176,
-	0.0016851511403913689,
-	0.0015532085830992151,
-	0.0007334429574038483,
-	-0.00038404703807706374,
-	-0.0012903928546062673,
-	-0.001589116985822746,
-	-0.0011688693205117386,
-	-0.0002427911262748304,
-	0.0007581962184398505,
-	0.0013853186950655656,
-	0.0013726194436395054,
-	0.0007488604447383905,
-	-0.0001859844829377685,
-	-0.0010042302574217437,
-	-0.001345659186698823,
-	-0.001075534060163285,
-	-0.0003363774756377516,
-	0.0005256474130290235,
-	0.0011223359814957787,
-	0.0011978313021278964,
-	0.0007376601256062714,
-	-0.00003373084268959067,
-	-0.0007617058544379052,
-	-0.0011240726218721309,
-	-0.0009732288447524023,
-	-0.00039533027946339914,
-	0.00033676677699617184,
-	0.0008918512780400293,
-	0.0010298304272684964,
-	0.0007050451307828392,
-	0.00007923220698079797,
-	-0.000558209846561876,
-	-0.0009236822743224579,
-	-0.0008651776630479138,
-	-0.00042478840954901194,
-	0.00018741861643375909,
-	0.000693133952985187,
-	0.0008720082233182957,
-	0.00065723964418903,
-	0.00015927631879570468,
-	-0.00039008475836334084,
-	-0.000745268613954907,
-	-0.0007563885691288192,
-	-0.0004319664029921087,
-	0.00007108047862322127,
-	0.000522867286711647,
-	0.000725322172117188,
-	0.0005986888241445059,
-	0.0002121314404936958,
-	-0.00025286558444324533,
-	-0.0005873812290521887,
-	-0.0006486590077608275,
-	-0.00042062023964949233,
-	-0.000015830258780649598,
-	0.00037955238679714863,
-	0.0005911299224481199,
-	0.0005329047394220694,
-	0.0002416588886688631,
-	-0.00014437612504758078,
-	-0.00045081133560027307,
-	-0.0005456453698811256,
-	-0.00039579911469299583,
-	-0.00007757452165399713,
-	0.00026162390892442574,
-	0.00047133700111162143,
-	0.00046455534732328245,
-	0.0002534001385681851,
-	-0.00006044475389747455,
-	-0.0003343832720442384,
-	-0.00044949562704502946,
-	-0.0003619076099331978,
-	-0.00011886644450972869,
-	0.00016600796814113096,
-	0.0003656151857573588,
-	0.00039588206825397215,
-	0.00025085952185720147,
-	0.000001913333622127115,
-	-0.00023704617109859144,
-	-0.00036149332050806047,
-	-0.0003217953430253818,
-	-0.00014257659721486946,
-	0.00009138040791600163,
-	0.0002750171645259084,
-	0.00032999011288425777,
-	0.00023784435917556385,
-	0.000045439552319925564,
-	-0.0001584912886531051,
-	-0.00028408268780404637,
-	-0.0002797433314405789,
-	-0.0001530441859788921,
-	0.00003521782695612677,
-	0.00019997010638154073,
-	0.00027013559917648963,
-	0.0002190819423100913,
-	0.00007430963332300958,
-	-0.00009691426237370909,
-	-0.0002186406419487102,
-	-0.00023973957169053317,
-	-0.0001551380746705934,
-	-0.000006078559223147888,
-	0.0001397783798689345,
-	0.00021889637010518464,
-	0.00019932348422556297,
-	0.00009331340050751315,
-	-0.00004974131963684903,
-	-0.000166166889498079,
-	-0.00020614222731852967,
-	-0.00015475352605099596,
-	-0.00003720216999159761,
-	0.00009345459043653895,
-	0.0001800836775697785,
-	0.00018618036508347017,
-	0.00011091048566953576,
-	-0.00001154017821527332,
-	-0.00012748407154133598,
-	-0.00018704055476519198,
-	-0.0001651762781801039,
-	-0.00007175132653725382,
-	0.0000532498242922933,
-	0.0001568608293703434,
-	0.00019521937372632433,
-	0.00015145858691100874,
-	0.00004230624869418396,
-	-0.00008887906767754188,
-	-0.0001894434337325765,
-	-0.00021802943662123627,
-	-0.00016038601362440848,
-	-0.00003461270486414098,
-	0.00011564430714093834,
-	0.00023692949769467454,
-	0.00028449683041105613,
-	0.00023686104257872158,
-	0.00010170646004511305,
-	-0.00008823702655229492,
-	-0.0002867835628798392,
-	-0.00044910566931673365,
-	-0.0005439148698531448,
-	-0.0005606755597108268,
-	-0.000508239871116061,
-	-0.0004104791899414881,
-	-0.0002942749692501728,
-	-0.0001866512871079807,
-	-0.00009953982240883068,
-	-0.00004572544427306656,
-	-0.000011348704130670158
-};
-
-
-// -------------------------------------------------------------- //
-//
-// ----------- 1024 POINT FIR LPF h[n] arrays ------------------- //
-//
-// -------------------------------------------------------------- //
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-sampling frequency: 88200 Hz
-
-	* 0 Hz - 21500 Hz
-	gain = 1
-	desired ripple = 0.25 dB
-	actual ripple = 0.005205391792064664 dB
-
-	* 22000 Hz - 44100 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -127.01046775559655 dB
-
-*/
-
-#define FILTER_TAP_1024 1024
-
-static double LPF1024_882[FILTER_TAP_1024] = {
-	0.000002296994628064047,
-	0.000014789279868473218,
-	0.00003935014169199962,
-	0.00006027271312718244,
-	0.00005196585200581446,
-	0.000011869188157785482,
-	-0.000025250576548906196,
-	-0.000023572914710735582,
-	0.000006687718035213566,
-	0.000021208509712051986,
-	0.0000028489151334185076,
-	-0.000016452488559251687,
-	-0.000007397406960098254,
-	0.000012073243312514536,
-	0.000009409710469610436,
-	-0.000008577610159733683,
-	-0.000010169808447472138,
-	0.000005896552652011822,
-	0.000010332320299186227,
-	-0.000003847270047554453,
-	-0.000010229864200374897,
-	0.000002255162837511969,
-	0.000010027642501838871,
-	-9.836787185139625e-7,
-	-0.00000980717433746539,
-	-6.937606870348361e-8,
-	0.000009606923574821677,
-	9.82352614629753e-7,
-	-0.000009436464490188146,
-	-0.000001806999720804682,
-	0.000009298952545751506,
-	0.0000025862709874353385,
-	-0.000009184546775248134,
-	-0.0000033467906487353053,
-	0.000009082165855075164,
-	0.000004104787294159089,
-	-0.00000898496447878191,
-	-0.000004877920359938534,
-	0.000008877724857059966,
-	0.000005671814712340069,
-	-0.000008751838612176002,
-	-0.000006494333694218778,
-	0.000008593066903092431,
-	0.000007343558212311522,
-	-0.000008395361293730261,
-	-0.000008221997204699646,
-	0.000008148845106292554,
-	0.000009127486525832755,
-	-0.000007847760531821056,
-	-0.000010062134657174814,
-	0.000007479196664414018,
-	0.000011019168000729255,
-	-0.0000070351634184965045,
-	-0.00001198955311132423,
-	0.000006513983424949496,
-	0.000012969298073892428,
-	-0.000005912632685343827,
-	-0.000013956566622789792,
-	0.00000522370588326623,
-	0.000014945741518954324,
-	-0.000004439738955041458,
-	-0.00001592753641974636,
-	0.000003555834456989047,
-	0.00001689024230475955,
-	-0.000002573284201677643,
-	-0.000017827704195848142,
-	0.0000014911594699039913,
-	0.000018734913816067718,
-	-3.050005866810878e-7,
-	-0.0000196030989067878,
-	-9.89004983114132e-7,
-	0.00002041918307090786,
-	0.000002387783533818304,
-	-0.000021175340210740072,
-	-0.000003889811783770288,
-	0.000021865626081072404,
-	0.000005498122754525232,
-	-0.000022478401192426876,
-	-0.000007212391825423073,
-	0.000023000362611467996,
-	0.000009027415653010349,
-	-0.000023421328886888577,
-	-0.000010936500292722058,
-	0.000023735960384710525,
-	0.000012938566043328133,
-	-0.000023934869215235214,
-	-0.000015032601359841204,
-	0.000024003264255481392,
-	0.000017209566735471053,
-	-0.000023931902325459494,
-	-0.000019461080429353612,
-	0.000023714083792643627,
-	0.00002178196373882044,
-	-0.00002334054370322617,
-	-0.00002416682206453142,
-	0.00002279748607136802,
-	0.000026601518300088966,
-	-0.000022079786527580878,
-	-0.000029076552488621866,
-	0.000021182470990680354,
-	0.00003158641178135503,
-	-0.00002009424146171185,
-	-0.000034120344003784895,
-	0.000018803757884805453,
-	0.00003666183040231645,
-	-0.00001730608278215499,
-	-0.00003919601646048409,
-	0.00001560016165337331,
-	0.000041715718020393335,
-	-0.000013674977489872177,
-	-0.00004420427361926466,
-	0.000011523471158327147,
-	0.00004664074520798729,
-	-0.000009147839533639106,
-	-0.00004901243332746167,
-	0.000006546510737615573,
-	0.00005130806904007649,
-	-0.0000037105132693790837,
-	-0.00005350395114450705,
-	6.431562486604855e-7,
-	0.00005558300342981458,
-	0.0000026526066387136125,
-	-0.00005753114126079866,
-	-0.0000061780027014466315,
-	0.00005933081836755614,
-	0.000009936063624880513,
-	-0.000060952135508038515,
-	-0.000013906197104111977,
-	0.00006239642757240919,
-	0.000018103643272849216,
-	-0.00006362740772278254,
-	-0.000022510015532181457,
-	0.00006463259723719125,
-	0.000027120552745745748,
-	-0.00006539118461771872,
-	-0.00003192318902563505,
-	0.0000658903788287759,
-	0.000036917770768488116,
-	-0.00006609784663905755,
-	-0.00004207938311507649,
-	0.00006600319721129817,
-	0.00004739607376727531,
-	-0.00006559370659041364,
-	-0.000052865055332254914,
-	0.00006483391729884361,
-	0.000058449005279419096,
-	-0.00006372673026384478,
-	-0.00006414549990570795,
-	0.00006224685450143735,
-	0.00006993435888631713,
-	-0.00006037109946025668,
-	-0.00007577978452995987,
-	0.00005810574096553653,
-	0.00008168395244976234,
-	-0.00005541293301948038,
-	-0.00008760393119571363,
-	0.0000522907288590488,
-	0.00009351621767491762,
-	-0.00004873448457193082,
-	-0.0000994087403466871,
-	0.00004471404301585999,
-	0.00010523048744889164,
-	-0.000040244675346910315,
-	-0.00011097589990829873,
-	0.00003529595732464388,
-	0.0001165920925141407,
-	-0.00002988410491123574,
-	-0.00012206828807153678,
-	0.000023986378441389205,
-	0.00012735392850470964,
-	-0.000017618541276056995,
-	-0.00013243288137523702,
-	0.000010764567861135158,
-	0.0001372576814100897,
-	-0.0000034364515003600397,
-	-0.00014179867647408213,
-	-0.000004361533185637595,
-	0.0001460242163242314,
-	0.00001262820834540656,
-	-0.0001498948699801588,
-	-0.0000213541013233084,
-	0.00015337220423553556,
-	0.000030523416981937124,
-	-0.00015642502772205755,
-	-0.00004012725397092759,
-	0.0001590145620425128,
-	0.00005014956864299458,
-	-0.00016110281615033846,
-	-0.00006056914552850669,
-	0.00016265526864108596,
-	0.00007136504701471067,
-	-0.00016363813974213276,
-	-0.0000825160738129935,
-	0.00016401372222454836,
-	0.00009399316494568045,
-	-0.0001637495698946307,
-	-0.00010576823805666007,
-	0.00016281386512546187,
-	0.00011781222916233818,
-	-0.0001611713538255061,
-	-0.0001300885632981971,
-	0.0001587930266047376,
-	0.0001425622756110098,
-	-0.00015564874898100567,
-	-0.00015519380231519324,
-	0.00015171009216381577,
-	0.00016794246102556874,
-	-0.00014694919571954892,
-	-0.00018076081564753082,
-	0.0001413438996227225,
-	0.00019360334481399825,
-	-0.00013487317585068117,
-	-0.00020642227626704458,
-	0.00012751586057429564,
-	0.00021916572161910248,
-	-0.00011925491780595219,
-	-0.0002317788946074346,
-	0.00011007815568458062,
-	0.0002442080486991933,
-	-0.00009997508554561889,
-	-0.0002563992951775903,
-	0.00008893376506931989,
-	0.0002682924771382845,
-	-0.00007694758300105873,
-	-0.0002798243994460669,
-	0.0000640170522696743,
-	0.00029093462646013335,
-	-0.000050143329897271024,
-	-0.0003015603255009458,
-	0.00003533085134649429,
-	0.0003116367392774929,
-	-0.000019588184150535474,
-	-0.0003210969240434255,
-	0.000002930957127717829,
-	0.0003298771785482339,
-	0.000014623752707682696,
-	-0.00033791363984433226,
-	-0.00003305757279341992,
-	0.0003451389328451049,
-	0.000052346524516107234,
-	-0.00035148427761776666,
-	-0.0000724588324193515,
-	0.00035688493784840996,
-	0.0000933607535472872,
-	-0.00036127656657693706,
-	-0.00011501625992258564,
-	0.0003645921347924834,
-	0.00013738163362174655,
-	-0.00036676665654919997,
-	-0.00016040607639304666,
-	0.00036774278894067646,
-	0.00018404259073196965,
-	-0.00036745695940595914,
-	-0.00020823391527390332,
-	0.00036585140960536947,
-	0.00023292180097774306,
-	-0.0003628664964758258,
-	-0.00025803891603269136,
-	0.0003584494838070244,
-	0.0002835172096342207,
-	-0.0003525477466248522,
-	-0.0003092824122391966,
-	0.00034511357277687327,
-	0.00033525849126053774,
-	-0.00033609912163146106,
-	-0.0003613615283087846,
-	0.00032546240011275694,
-	0.0003875018265649072,
-	-0.00031317238916828274,
-	-0.00041359663803604133,
-	0.0002991917149230007,
-	0.0004395529211454413,
-	-0.00028348938173321545,
-	-0.00046527320042886897,
-	0.0002660404863756384,
-	0.0004906576526486572,
-	-0.0002468239091790056,
-	-0.0005156014436685091,
-	0.00022582580544231603,
-	0.0005399971495738935,
-	-0.00020304155809277636,
-	-0.000563744613121747,
-	0.00017845359356441517,
-	0.0005867098907201442,
-	-0.00015209992623740277,
-	-0.0006088313402848105,
-	0.00012391776842565403,
-	0.0006298955545177441,
-	-0.000094057543217338,
-	-0.0006499663883698653,
-	0.0000623143134386573,
-	0.0006686586937142014,
-	-0.000029014743352432716,
-	-0.0006861676792717339,
-	-0.000006113115216012686,
-	0.0007021004979478701,
-	0.00004281431862033022,
-	-0.0007164643989494654,
-	-0.00008106414614688624,
-	0.0007292132308629276,
-	0.00012094874912208555,
-	-0.0007400580144154026,
-	-0.00016224972699466355,
-	0.0007489821231631454,
-	0.00020491885090971233,
-	-0.0007559249376409623,
-	-0.0002489851696329621,
-	0.0007606547731267669,
-	0.0002942783488660361,
-	-0.0007630804985088466,
-	-0.00034065703633269127,
-	0.0007631831130351218,
-	0.0003881057330927636,
-	-0.0007608175470776444,
-	-0.0004365374338348583,
-	0.0007558157917387595,
-	0.00048576120196325013,
-	-0.0007481272663055698,
-	-0.00053565193634857,
-	0.0007377051080486571,
-	0.0005861406162024303,
-	-0.0007244216776913867,
-	-0.0006370926876928682,
-	0.0007081571376479413,
-	0.0006883210874268012,
-	-0.0006888533269886017,
-	-0.0007396552964386607,
-	0.0006664880623163516,
-	0.0007909854148282617,
-	-0.000640981809237771,
-	-0.0008421712437480292,
-	0.000612238720258293,
-	0.0008930220811500419,
-	-0.0005801969324641445,
-	-0.0009433271986727659,
-	0.0005448482584606248,
-	0.0009929146109510921,
-	-0.0005061806698978792,
-	-0.0010416313487329853,
-	0.0004641550577891033,
-	0.0010893043622848023,
-	-0.00041872420801015894,
-	-0.0011357233086747005,
-	0.0003698697982755902,
-	0.001180664098871314,
-	-0.0003176121806468286,
-	-0.0012239215370781409,
-	0.0002619850444227353,
-	0.001265313025400672,
-	-0.00020300686948123656,
-	-0.0013046489730593194,
-	0.00014068930549400197,
-	0.0013417183750415904,
-	-0.00007505569215431857,
-	-0.0013762900779236494,
-	0.000006160755566999878,
-	0.001408135489631785,
-	0.00006591454318733212,
-	-0.001437044448983207,
-	-0.0001410832289581654,
-	0.0014628201128808929,
-	0.0002192662749791417,
-	-0.0014852589689213556,
-	-0.0003003847983502368,
-	0.0015041398199654066,
-	0.0003843400622810705,
-	-0.0015192360983826362,
-	-0.00047100984979634835,
-	0.0015303273262231173,
-	0.0005602537738505885,
-	-0.0015372062209234628,
-	-0.0006519267879009093,
-	0.001539669119222191,
-	0.0007458781899147113,
-	-0.0015375095367225677,
-	-0.0008419421179238874,
-	0.0015305271925333947,
-	0.0009399437812478536,
-	-0.0015185265695011295,
-	-0.0010397028504062458,
-	0.0015013103026860369,
-	0.0011410301014716448,
-	-0.0014786726911888027,
-	-0.0012437108212966642,
-	0.0014504164251893967,
-	0.0013475080565165823,
-	-0.0014163656930775593,
-	-0.0014521813459216924,
-	0.0013763586161903499,
-	0.0015574972430174104,
-	-0.0013302263876368784,
-	-0.0016632141611617056,
-	0.0012777899422493912,
-	0.0017690613725129109,
-	-0.0012188877570953615,
-	-0.0018747584625628665,
-	0.0011533720886912505,
-	0.001980026727512454,
-	-0.0010810906681681645,
-	-0.0020845744941585575,
-	0.001001888384000216,
-	0.0021880821803586486,
-	-0.0009156319960675837,
-	-0.002290223228662138,
-	0.000822206388181637,
-	0.002390679825211993,
-	-0.000721489652782853,
-	-0.0024891257793635906,
-	0.0006133495229335604,
-	0.0025852010920771164,
-	-0.0004976829760562754,
-	-0.0026785517493375217,
-	0.0003743879589943524,
-	0.0027688223351350796,
-	-0.0002433534432725637,
-	-0.0028556415085332267,
-	0.00010445739886208105,
-	0.002938590428372991,
-	0.000042368824363106123,
-	-0.003017287221059919,
-	-0.00019722433651629472,
-	0.0030913285748001324,
-	0.0003602190909391579,
-	-0.0031602720324280806,
-	-0.0005314327836537573,
-	0.003223682875737903,
-	0.0007109469036422084,
-	-0.0032811350908386674,
-	-0.0008988830262115275,
-	0.003332152402968346,
-	0.0010953478512954332,
-	-0.0033762409638370913,
-	-0.0013004323339003664,
-	0.0034129336507673215,
-	0.0015142976140996123,
-	-0.003441682965796687,
-	-0.0017370755650873025,
-	0.0034619333481817447,
-	0.0019688980253564246,
-	-0.0034731533042929663,
-	-0.002209995718014684,
-	0.0034746929332076957,
-	0.002460545187594304,
-	-0.003465928856295623,
-	-0.0027207886468407997,
-	0.0034462015787187087,
-	0.0029910527177725546,
-	-0.0034147276452886136,
-	-0.0032716125342472178,
-	0.0033707893123139368,
-	0.003562939865128625,
-	-0.003313463433454772,
-	-0.0038654490732951165,
-	0.003241866901135835,
-	0.00417975091679267,
-	-0.0031549286087296305,
-	-0.004506487906903821,
-	0.0030515245037105983,
-	0.004846485920438749,
-	-0.002930345044817954,
-	-0.005200690019860161,
-	0.0027899404418279907,
-	0.005570255833705836,
-	-0.0026286436218647172,
-	-0.005956567602181702,
-	0.0024445350709271117,
-	0.006361293170747905,
-	-0.002235388006621966,
-	-0.006786458663587732,
-	0.0019985868259545674,
-	0.0072345337828066125,
-	-0.0017310266752698293,
-	-0.0077085401044380865,
-	0.0014289932560785385,
-	0.008212213970990853,
-	-0.0010879765379883698,
-	-0.008750194907629608,
-	0.0007024467100493902,
-	0.009328301355982624,
-	-0.00026553751235601443,
-	-0.00995391238124531,
-	-0.00023140412843359806,
-	0.010636492669509976,
-	0.0007994502856064066,
-	-0.011388345953877894,
-	-0.0014530021778399894,
-	0.012225734435028762,
-	0.002211153034250726,
-	-0.013170574191420509,
-	-0.0030997972377845295,
-	0.014253044627040707,
-	0.004154936361229311,
-	-0.015515839778480615,
-	-0.0054281585491901905,
-	0.017021315014654394,
-	0.006996091479056578,
-	-0.01886417375291823,
-	-0.00897768647862408,
-	0.021195420778046262,
-	0.011568084639321153,
-	-0.02427131854541106,
-	-0.015111192495937849,
-	0.028564179844598105,
-	0.020274717162575024,
-	-0.03505042726799895,
-	-0.028548343543967694,
-	0.04612714231003844,
-	0.04407038108620761,
-	-0.06967106516522001,
-	-0.08422230592344494,
-	0.15556960353394766,
-	0.44449234102623,
-	0.44449234102623,
-	0.15556960353394766,
-	-0.08422230592344494,
-	-0.06967106516522001,
-	0.04407038108620761,
-	0.04612714231003844,
-	-0.028548343543967694,
-	-0.03505042726799895,
-	0.020274717162575024,
-	0.028564179844598105,
-	-0.015111192495937849,
-	-0.02427131854541106,
-	0.011568084639321153,
-	0.021195420778046262,
-	-0.00897768647862408,
-	-0.01886417375291823,
-	0.006996091479056578,
-	0.017021315014654394,
-	-0.0054281585491901905,
-	-0.015515839778480615,
-	0.004154936361229311,
-	0.014253044627040707,
-	-0.0030997972377845295,
-	-0.013170574191420509,
-	0.002211153034250726,
-	0.012225734435028762,
-	-0.0014530021778399894,
-	-0.011388345953877894,
-	0.0007994502856064066,
-	0.010636492669509976,
-	-0.00023140412843359806,
-	-0.00995391238124531,
-	-0.00026553751235601443,
-	0.009328301355982624,
-	0.0007024467100493902,
-	-0.008750194907629608,
-	-0.0010879765379883698,
-	0.008212213970990853,
-	0.0014289932560785385,
-	-0.0077085401044380865,
-	-0.0017310266752698293,
-	0.0072345337828066125,
-	0.0019985868259545674,
-	-0.006786458663587732,
-	-0.002235388006621966,
-	0.006361293170747905,
-	0.0024445350709271117,
-	-0.005956567602181702,
-	-0.0026286436218647172,
-	0.005570255833705836,
-	0.0027899404418279907,
-	-0.005200690019860161,
-	-0.002930345044817954,
-	0.004846485920438749,
-	0.0030515245037105983,
-	-0.004506487906903821,
-	-0.0031549286087296305,
-	0.00417975091679267,
-	0.003241866901135835,
-	-0.0038654490732951165,
-	-0.003313463433454772,
-	0.003562939865128625,
-	0.0033707893123139368,
-	-0.0032716125342472178,
-	-0.0034147276452886136,
-	0.0029910527177725546,
-	0.0034462015787187087,
-	-0.0027207886468407997,
-	-0.003465928856295623,
-	0.002460545187594304,
-	0.0034746929332076957,
-	-0.002209995718014684,
-	-0.0034731533042929663,
-	0.0019688980253564246,
-	0.0034619333481817447,
-	-0.0017370755650873025,
-	-0.003441682965796687,
-	0.0015142976140996123,
-	0.0034129336507673215,
-	-0.0013004323339003664,
-	-0.0033762409638370913,
-	0.0010953478512954332,
-	0.003332152402968346,
-	-0.0008988830262115275,
-	-0.0032811350908386674,
-	0.0007109469036422084,
-	0.003223682875737903,
-	-0.0005314327836537573,
-	-0.0031602720324280806,
-	0.0003602190909391579,
-	0.0030913285748001324,
-	-0.00019722433651629472,
-	-0.003017287221059919,
-	0.000042368824363106123,
-	0.002938590428372991,
-	0.00010445739886208105,
-	-0.0028556415085332267,
-	-0.0002433534432725637,
-	0.0027688223351350796,
-	0.0003743879589943524,
-	-0.0026785517493375217,
-	-0.0004976829760562754,
-	0.0025852010920771164,
-	0.0006133495229335604,
-	-0.0024891257793635906,
-	-0.000721489652782853,
-	0.002390679825211993,
-	0.000822206388181637,
-	-0.002290223228662138,
-	-0.0009156319960675837,
-	0.0021880821803586486,
-	0.001001888384000216,
-	-0.0020845744941585575,
-	-0.0010810906681681645,
-	0.001980026727512454,
-	0.0011533720886912505,
-	-0.0018747584625628665,
-	-0.0012188877570953615,
-	0.0017690613725129109,
-	0.0012777899422493912,
-	-0.0016632141611617056,
-	-0.0013302263876368784,
-	0.0015574972430174104,
-	0.0013763586161903499,
-	-0.0014521813459216924,
-	-0.0014163656930775593,
-	0.0013475080565165823,
-	0.0014504164251893967,
-	-0.0012437108212966642,
-	-0.0014786726911888027,
-	0.0011410301014716448,
-	0.0015013103026860369,
-	-0.0010397028504062458,
-	-0.0015185265695011295,
-	0.0009399437812478536,
-	0.0015305271925333947,
-	-0.0008419421179238874,
-	-0.0015375095367225677,
-	0.0007458781899147113,
-	0.001539669119222191,
-	-0.0006519267879009093,
-	-0.0015372062209234628,
-	0.0005602537738505885,
-	0.0015303273262231173,
-	-0.00047100984979634835,
-	-0.0015192360983826362,
-	0.0003843400622810705,
-	0.0015041398199654066,
-	-0.0003003847983502368,
-	-0.0014852589689213556,
-	0.0002192662749791417,
-	0.0014628201128808929,
-	-0.0001410832289581654,
-	-0.001437044448983207,
-	0.00006591454318733212,
-	0.001408135489631785,
-	0.000006160755566999878,
-	-0.0013762900779236494,
-	-0.00007505569215431857,
-	0.0013417183750415904,
-	0.00014068930549400197,
-	-0.0013046489730593194,
-	-0.00020300686948123656,
-	0.001265313025400672,
-	0.0002619850444227353,
-	-0.0012239215370781409,
-	-0.0003176121806468286,
-	0.001180664098871314,
-	0.0003698697982755902,
-	-0.0011357233086747005,
-	-0.00041872420801015894,
-	0.0010893043622848023,
-	0.0004641550577891033,
-	-0.0010416313487329853,
-	-0.0005061806698978792,
-	0.0009929146109510921,
-	0.0005448482584606248,
-	-0.0009433271986727659,
-	-0.0005801969324641445,
-	0.0008930220811500419,
-	0.000612238720258293,
-	-0.0008421712437480292,
-	-0.000640981809237771,
-	0.0007909854148282617,
-	0.0006664880623163516,
-	-0.0007396552964386607,
-	-0.0006888533269886017,
-	0.0006883210874268012,
-	0.0007081571376479413,
-	-0.0006370926876928682,
-	-0.0007244216776913867,
-	0.0005861406162024303,
-	0.0007377051080486571,
-	-0.00053565193634857,
-	-0.0007481272663055698,
-	0.00048576120196325013,
-	0.0007558157917387595,
-	-0.0004365374338348583,
-	-0.0007608175470776444,
-	0.0003881057330927636,
-	0.0007631831130351218,
-	-0.00034065703633269127,
-	-0.0007630804985088466,
-	0.0002942783488660361,
-	0.0007606547731267669,
-	-0.0002489851696329621,
-	-0.0007559249376409623,
-	0.00020491885090971233,
-	0.0007489821231631454,
-	-0.00016224972699466355,
-	-0.0007400580144154026,
-	0.00012094874912208555,
-	0.0007292132308629276,
-	-0.00008106414614688624,
-	-0.0007164643989494654,
-	0.00004281431862033022,
-	0.0007021004979478701,
-	-0.000006113115216012686,
-	-0.0006861676792717339,
-	-0.000029014743352432716,
-	0.0006686586937142014,
-	0.0000623143134386573,
-	-0.0006499663883698653,
-	-0.000094057543217338,
-	0.0006298955545177441,
-	0.00012391776842565403,
-	-0.0006088313402848105,
-	-0.00015209992623740277,
-	0.0005867098907201442,
-	0.00017845359356441517,
-	-0.000563744613121747,
-	-0.00020304155809277636,
-	0.0005399971495738935,
-	0.00022582580544231603,
-	-0.0005156014436685091,
-	-0.0002468239091790056,
-	0.0004906576526486572,
-	0.0002660404863756384,
-	-0.00046527320042886897,
-	-0.00028348938173321545,
-	0.0004395529211454413,
-	0.0002991917149230007,
-	-0.00041359663803604133,
-	-0.00031317238916828274,
-	0.0003875018265649072,
-	0.00032546240011275694,
-	-0.0003613615283087846,
-	-0.00033609912163146106,
-	0.00033525849126053774,
-	0.00034511357277687327,
-	-0.0003092824122391966,
-	-0.0003525477466248522,
-	0.0002835172096342207,
-	0.0003584494838070244,
-	-0.00025803891603269136,
-	-0.0003628664964758258,
-	0.00023292180097774306,
-	0.00036585140960536947,
-	-0.00020823391527390332,
-	-0.00036745695940595914,
-	0.00018404259073196965,
-	0.00036774278894067646,
-	-0.00016040607639304666,
-	-0.00036676665654919997,
-	0.00013738163362174655,
-	0.0003645921347924834,
-	-0.00011501625992258564,
-	-0.00036127656657693706,
-	0.0000933607535472872,
-	0.00035688493784840996,
-	-0.0000724588324193515,
-	-0.00035148427761776666,
-	0.000052346524516107234,
-	0.0003451389328451049,
-	-0.00003305757279341992,
-	-0.00033791363984433226,
-	0.000014623752707682696,
-	0.0003298771785482339,
-	0.000002930957127717829,
-	-0.0003210969240434255,
-	-0.000019588184150535474,
-	0.0003116367392774929,
-	0.00003533085134649429,
-	-0.0003015603255009458,
-	-0.000050143329897271024,
-	0.00029093462646013335,
-	0.0000640170522696743,
-	-0.0002798243994460669,
-	-0.00007694758300105873,
-	0.0002682924771382845,
-	0.00008893376506931989,
-	-0.0002563992951775903,
-	-0.00009997508554561889,
-	0.0002442080486991933,
-	0.00011007815568458062,
-	-0.0002317788946074346,
-	-0.00011925491780595219,
-	0.00021916572161910248,
-	0.00012751586057429564,
-	-0.00020642227626704458,
-	-0.00013487317585068117,
-	0.00019360334481399825,
-	0.0001413438996227225,
-	-0.00018076081564753082,
-	-0.00014694919571954892,
-	0.00016794246102556874,
-	0.00015171009216381577,
-	-0.00015519380231519324,
-	-0.00015564874898100567,
-	0.0001425622756110098,
-	0.0001587930266047376,
-	-0.0001300885632981971,
-	-0.0001611713538255061,
-	0.00011781222916233818,
-	0.00016281386512546187,
-	-0.00010576823805666007,
-	-0.0001637495698946307,
-	0.00009399316494568045,
-	0.00016401372222454836,
-	-0.0000825160738129935,
-	-0.00016363813974213276,
-	0.00007136504701471067,
-	0.00016265526864108596,
-	-0.00006056914552850669,
-	-0.00016110281615033846,
-	0.00005014956864299458,
-	0.0001590145620425128,
-	-0.00004012725397092759,
-	-0.00015642502772205755,
-	0.000030523416981937124,
-	0.00015337220423553556,
-	-0.0000213541013233084,
-	-0.0001498948699801588,
-	0.00001262820834540656,
-	0.0001460242163242314,
-	-0.000004361533185637595,
-	-0.00014179867647408213,
-	-0.0000034364515003600397,
-	0.0001372576814100897,
-	0.000010764567861135158,
-	-0.00013243288137523702,
-	-0.000017618541276056995,
-	0.00012735392850470964,
-	0.000023986378441389205,
-	-0.00012206828807153678,
-	-0.00002988410491123574,
-	0.0001165920925141407,
-	0.00003529595732464388,
-	-0.00011097589990829873,
-	-0.000040244675346910315,
-	0.00010523048744889164,
-	0.00004471404301585999,
-	-0.0000994087403466871,
-	-0.00004873448457193082,
-	0.00009351621767491762,
-	0.0000522907288590488,
-	-0.00008760393119571363,
-	-0.00005541293301948038,
-	0.00008168395244976234,
-	0.00005810574096553653,
-	-0.00007577978452995987,
-	-0.00006037109946025668,
-	0.00006993435888631713,
-	0.00006224685450143735,
-	-0.00006414549990570795,
-	-0.00006372673026384478,
-	0.000058449005279419096,
-	0.00006483391729884361,
-	-0.000052865055332254914,
-	-0.00006559370659041364,
-	0.00004739607376727531,
-	0.00006600319721129817,
-	-0.00004207938311507649,
-	-0.00006609784663905755,
-	0.000036917770768488116,
-	0.0000658903788287759,
-	-0.00003192318902563505,
-	-0.00006539118461771872,
-	0.000027120552745745748,
-	0.00006463259723719125,
-	-0.000022510015532181457,
-	-0.00006362740772278254,
-	0.000018103643272849216,
-	0.00006239642757240919,
-	-0.000013906197104111977,
-	-0.000060952135508038515,
-	0.000009936063624880513,
-	0.00005933081836755614,
-	-0.0000061780027014466315,
-	-0.00005753114126079866,
-	0.0000026526066387136125,
-	0.00005558300342981458,
-	6.431562486604855e-7,
-	-0.00005350395114450705,
-	-0.0000037105132693790837,
-	0.00005130806904007649,
-	0.000006546510737615573,
-	-0.00004901243332746167,
-	-0.000009147839533639106,
-	0.00004664074520798729,
-	0.000011523471158327147,
-	-0.00004420427361926466,
-	-0.000013674977489872177,
-	0.000041715718020393335,
-	0.00001560016165337331,
-	-0.00003919601646048409,
-	-0.00001730608278215499,
-	0.00003666183040231645,
-	0.000018803757884805453,
-	-0.000034120344003784895,
-	-0.00002009424146171185,
-	0.00003158641178135503,
-	0.000021182470990680354,
-	-0.000029076552488621866,
-	-0.000022079786527580878,
-	0.000026601518300088966,
-	0.00002279748607136802,
-	-0.00002416682206453142,
-	-0.00002334054370322617,
-	0.00002178196373882044,
-	0.000023714083792643627,
-	-0.000019461080429353612,
-	-0.000023931902325459494,
-	0.000017209566735471053,
-	0.000024003264255481392,
-	-0.000015032601359841204,
-	-0.000023934869215235214,
-	0.000012938566043328133,
-	0.000023735960384710525,
-	-0.000010936500292722058,
-	-0.000023421328886888577,
-	0.000009027415653010349,
-	0.000023000362611467996,
-	-0.000007212391825423073,
-	-0.000022478401192426876,
-	0.000005498122754525232,
-	0.000021865626081072404,
-	-0.000003889811783770288,
-	-0.000021175340210740072,
-	0.000002387783533818304,
-	0.00002041918307090786,
-	-9.89004983114132e-7,
-	-0.0000196030989067878,
-	-3.050005866810878e-7,
-	0.000018734913816067718,
-	0.0000014911594699039913,
-	-0.000017827704195848142,
-	-0.000002573284201677643,
-	0.00001689024230475955,
-	0.000003555834456989047,
-	-0.00001592753641974636,
-	-0.000004439738955041458,
-	0.000014945741518954324,
-	0.00000522370588326623,
-	-0.000013956566622789792,
-	-0.000005912632685343827,
-	0.000012969298073892428,
-	0.000006513983424949496,
-	-0.00001198955311132423,
-	-0.0000070351634184965045,
-	0.000011019168000729255,
-	0.000007479196664414018,
-	-0.000010062134657174814,
-	-0.000007847760531821056,
-	0.000009127486525832755,
-	0.000008148845106292554,
-	-0.000008221997204699646,
-	-0.000008395361293730261,
-	0.000007343558212311522,
-	0.000008593066903092431,
-	-0.000006494333694218778,
-	-0.000008751838612176002,
-	0.000005671814712340069,
-	0.000008877724857059966,
-	-0.000004877920359938534,
-	-0.00000898496447878191,
-	0.000004104787294159089,
-	0.000009082165855075164,
-	-0.0000033467906487353053,
-	-0.000009184546775248134,
-	0.0000025862709874353385,
-	0.000009298952545751506,
-	-0.000001806999720804682,
-	-0.000009436464490188146,
-	9.82352614629753e-7,
-	0.000009606923574821677,
-	-6.937606870348361e-8,
-	-0.00000980717433746539,
-	-9.836787185139625e-7,
-	0.000010027642501838871,
-	0.000002255162837511969,
-	-0.000010229864200374897,
-	-0.000003847270047554453,
-	0.000010332320299186227,
-	0.000005896552652011822,
-	-0.000010169808447472138,
-	-0.000008577610159733683,
-	0.000009409710469610436,
-	0.000012073243312514536,
-	-0.000007397406960098254,
-	-0.000016452488559251687,
-	0.0000028489151334185076,
-	0.000021208509712051986,
-	0.000006687718035213566,
-	-0.000023572914710735582,
-	-0.000025250576548906196,
-	0.000011869188157785482,
-	0.00005196585200581446,
-	0.00006027271312718244,
-	0.00003935014169199962,
-	0.000014789279868473218,
-	0.000002296994628064047
-};
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 176400 Hz
-
-	* 0 Hz - 21000 Hz
-	gain = 1
-	desired ripple = 0.25 dB
-	actual ripple = 0.0052678710286102395 dB
-
-	* 22000 Hz - 88200 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -126.90683354577267 dB
-
-*/
-
-static double LPF1024_1764[FILTER_TAP_1024] = {
-	-0.0000010852899687113288,
-	-0.000003016244273831896,
-	-0.000006186481174314161,
-	-0.000010139808159983564,
-	-0.000013819319507616947,
-	-0.00001568035927180949,
-	-0.000014161441261808751,
-	-0.000008346821081828053,
-	0.0000014366707908815286,
-	0.000013390727866791427,
-	0.000024589451560746817,
-	0.00003187611835079159,
-	0.000033027007519598565,
-	0.000027715491928172806,
-	0.000017820377895432576,
-	0.0000068541848306632,
-	-0.0000013389530165154596,
-	-0.0000041127060375214346,
-	-0.0000011150221342967014,
-	0.000005568437408310967,
-	0.000012342079574603483,
-	0.000015724284087645305,
-	0.000013941301265126443,
-	0.000007741258546744631,
-	1.850467383156997e-8,
-	-0.000005600859302033518,
-	-0.000006545911504059993,
-	-0.000002585706845825623,
-	0.0000040415140792482096,
-	0.000009746875825076957,
-	0.000011417559901073802,
-	0.000008031869287682198,
-	0.000001222156630075335,
-	-0.0000055358001439318716,
-	-0.00000872117970296646,
-	-0.000006636359255811318,
-	-3.5820793484470297e-7,
-	0.000006762740491267239,
-	0.000010836171294667274,
-	0.000009512110391803634,
-	0.000003300681237107332,
-	-0.000004608407733554973,
-	-0.000009985849675760376,
-	-0.000009829098028467324,
-	-0.000004047705336773931,
-	0.000004374140685381497,
-	0.000010889549308684053,
-	0.00001181871203633049,
-	0.000006405028147588416,
-	-0.0000026465190889620814,
-	-0.000010510613941178612,
-	-0.000012808250506467202,
-	-0.000008040568081173693,
-	0.0000014569479503829166,
-	0.000010633355109408724,
-	0.000014391183164913997,
-	0.000010402410725494906,
-	5.217141990992467e-7,
-	-0.000010049590130649052,
-	-0.000015490705002890887,
-	-0.000012557518749249433,
-	-0.0000024989323557017393,
-	0.000009428598179826871,
-	0.000016691413969419233,
-	0.000015044370352182777,
-	0.000004992230963832062,
-	-0.000008271332013012868,
-	-0.000017531215629813144,
-	-0.000017464934973325264,
-	-0.000007686590275830617,
-	0.000006811642238052536,
-	0.000018187127708237987,
-	0.000019975870449370993,
-	0.000010749661804615328,
-	-0.000004859786120665716,
-	-0.000018461182914750188,
-	-0.000022401188724177614,
-	-0.000014056381828207223,
-	0.0000024793956845403756,
-	0.000018370845247859933,
-	0.000024746525353976816,
-	0.00001763653475634581,
-	4.021953815642143e-7,
-	-0.00001780928787329286,
-	-0.000026902712692574238,
-	-0.00002141650384473761,
-	-0.0000037698900968862148,
-	0.000016738497832970754,
-	0.000028810731405264303,
-	0.000025358527411235555,
-	0.00000763701024438684,
-	-0.000015093223621246674,
-	-0.000030382658399687544,
-	-0.000029396239282728652,
-	-0.000011994332574402612,
-	0.00001281806020569076,
-	0.00003152388765346107,
-	0.00003344130833463864,
-	0.000016801186334362383,
-	-0.000009891181180652391,
-	-0.00003217011691128803,
-	-0.000037430889232512026,
-	-0.000022039612556495887,
-	0.0000062673647521681635,
-	0.000032230821092881615,
-	0.00004127441627558887,
-	0.000027667404879805492,
-	-0.0000019157376171897207,
-	-0.00003161602137765386,
-	-0.00004486988026483178,
-	-0.000033626630650911463,
-	-0.000003184937369714104,
-	0.000030230589320380944,
-	0.000048091548567626997,
-	0.00003981903233240597,
-	0.000009005258285784,
-	-0.000028033067130329335,
-	-0.000050865981777413383,
-	-0.000046198143472700565,
-	-0.00001557226396666025,
-	0.00002491565741378364,
-	0.000053042530536763926,
-	0.0000526340984713108,
-	0.000022831653466909773,
-	-0.000020841687159573508,
-	-0.000054526928619142024,
-	-0.000059040334497320424,
-	-0.00003076731658910717,
-	0.00001573064679015645,
-	0.000055167875241966775,
-	0.00006525971326585448,
-	0.00003928522630260633,
-	-0.000009578961864436804,
-	-0.00005488366601449032,
-	-0.00007119593198410217,
-	-0.00004834780226015844,
-	0.000002322205599790805,
-	0.000053519789700703213,
-	0.00007666701632600644,
-	0.00005782611100744608,
-	0.000006017463640365019,
-	-0.00005099499219740134,
-	-0.00008154781542580123,
-	-0.00006763514273603203,
-	-0.0000154588435416977,
-	0.000047178618033185096,
-	0.00008564978491057572,
-	0.00007761617555881783,
-	0.000025945875593591237,
-	-0.000042007069531784254,
-	-0.0000888384228541149,
-	-0.00008765287081588074,
-	-0.000037462438840123496,
-	0.00003536691257938203,
-	0.00009091283157425619,
-	0.00009754869109538869,
-	0.00004990732146095939,
-	-0.000027223744681695147,
-	-0.00009173604895929777,
-	-0.0001071550321928551,
-	-0.00006322092646608981,
-	0.00001749429534252289,
-	0.00009110599908266018,
-	0.00011624049012679008,
-	0.00007725010348590036,
-	-0.000006185695121969894,
-	-0.0000888950212909366,
-	-0.00012462868689654572,
-	-0.00009188360428723134,
-	-0.000006735369633472702,
-	0.00008492442438328268,
-	0.00013207647346029155,
-	0.00010693385038530367,
-	0.00002122996032939209,
-	-0.0000790703101083225,
-	-0.00013837110081811406,
-	-0.0001222231889254793,
-	-0.000037261974426543755,
-	0.00007119825132235157,
-	0.000143272935973484,
-	0.00013753391475192778,
-	0.00005475366254062155,
-	-0.00006119983230732855,
-	-0.0001465439897820959,
-	-0.00015262448493907102,
-	-0.00007359208874511192,
-	0.00004899894689073472,
-	0.00014796081774833287,
-	0.0001672515283488218,
-	0.00009365474784810233,
-	-0.0000345176169075521,
-	-0.00014727442165552213,
-	-0.00018111804636037205,
-	-0.00011474829670536883,
-	0.000017749281588028325,
-	0.00014429160194667014,
-	0.0001939622018189595,
-	0.00013670177256081098,
-	0.0000013394329614716623,
-	-0.0001387713779638981,
-	-0.00020544689992505223,
-	-0.00015924927657468796,
-	-0.00002268563024963061,
-	0.00013055112287161305,
-	0.00021528564104901596,
-	0.00018215272844137586,
-	0.000046248757728297426,
-	-0.00011943096397249396,
-	-0.0002231274203566491,
-	-0.00020508478143945954,
-	-0.00007189032733355634,
-	0.00010529680442881588,
-	0.00022868099981558545,
-	0.0002277529378499163,
-	0.00009949756750099171,
-	-0.00008799593740369557,
-	-0.00023158745743232496,
-	-0.0002497668172042038,
-	-0.00012884463796489044,
-	0.0000674804523993892,
-	0.00023156497686677846,
-	0.0002707806468434657,
-	0.00015973044774709232,
-	-0.00004367439564769654,
-	-0.00022827956409724078,
-	-0.0002903654779699785,
-	-0.0001918508033577001,
-	0.000016601624191172307,
-	0.00022147102759633957,
-	0.0003081306003404239,
-	0.0002249134087249416,
-	0.000013723019043059293,
-	-0.00021084817993211513,
-	-0.0003236198862024589,
-	-0.0002585335897191557,
-	-0.00004718891675109828,
-	0.00019619163436904692,
-	0.0003364086515979058,
-	0.00029232107712948797,
-	0.00008366430104321278,
-	-0.0001772909510891001,
-	-0.0003460502502044329,
-	-0.0003258338826630191,
-	-0.00012295661551853297,
-	0.0001539764902544676,
-	0.00035209762369660147,
-	0.00035858690548839486,
-	0.00016480693729436718,
-	-0.00012613814156087154,
-	-0.00035413195671378273,
-	-0.00039008691292793756,
-	-0.00020892948322835835,
-	0.0000936803146881106,
-	0.0003517092034273869,
-	0.00041976724252722414,
-	0.00025493235034523295,
-	-0.00005661483344740372,
-	-0.0003444635452660949,
-	-0.0004470972383524934,
-	-0.0003024290233602617,
-	0.000014948767527865337,
-	0.00033199343244055026,
-	0.0004714643205165906,
-	0.0003509152161789372,
-	0.000031187889628860926,
-	-0.000313990760719681,
-	-0.0004923001317270983,
-	-0.0003998877585478045,
-	-0.0000816524154631075,
-	0.00029013751005210314,
-	0.0005089803975112741,
-	0.00044874478755472906,
-	0.00013618892058399405,
-	-0.0002602050810357349,
-	-0.0005209190976331516,
-	-0.0004968699552605801,
-	-0.00019449987785587075,
-	0.00022399472033910841,
-	0.0005275177167865972,
-	0.0005435874082710433,
-	0.0002562055975354706,
-	-0.00018137226187164545,
-	-0.0005281905012308189,
-	-0.0005881728865401527,
-	-0.0003208380777368825,
-	0.0001322907879791506,
-	0.0005223995788924378,
-	0.0006298963071643336,
-	0.0003878874617467388,
-	-0.00007674144019407095,
-	-0.0005096012884327245,
-	-0.0006679599938658885,
-	-0.0004567293483134119,
-	0.000014836372611306772,
-	0.0004893353987130747,
-	0.0007015890734451152,
-	0.0005267123557125201,
-	0.000053274340707433944,
-	-0.0004611447089976287,
-	-0.0007299491540708775,
-	-0.0005970695905706307,
-	-0.00012730720404969934,
-	0.0004246745826702442,
-	0.0007522451413711291,
-	0.0006670119468735746,
-	0.00020693012954810168,
-	-0.00037959567804859886,
-	-0.0007676473593500653,
-	-0.0007356534789857852,
-	-0.000291685912306955,
-	0.0003256803350319196,
-	0.0007753628468699239,
-	0.0008020716644921747,
-	0.00038103728777231073,
-	-0.0002627720301401588,
-	-0.0007746156544223702,
-	-0.000865293864157214,
-	-0.0004743568440980121,
-	0.00019079227734707303,
-	0.0007646464125297957,
-	0.0009242844129677729,
-	0.000570898137026645,
-	-0.00010978457818496405,
-	-0.0007447676153393111,
-	-0.0009780052179783102,
-	-0.0006698569008782314,
-	0.000019853326354131217,
-	0.0007142989346574138,
-	0.001025342113905362,
-	0.0007702837660477187,
-	0.0000787336346354941,
-	-0.0006726819828099261,
-	-0.00106522572824965,
-	-0.0008712057489294089,
-	-0.00018566472440770604,
-	0.0006193611587469451,
-	0.0010965087843125552,
-	0.0009714959429209905,
-	0.00030044588511951695,
-	-0.0005539275212172799,
-	-0.0011181090753458836,
-	-0.001070009346340323,
-	-0.000422525920249919,
-	0.00047600269533254106,
-	0.0011288979156968645,
-	0.0011654706391821539,
-	0.0005511810395244051,
-	-0.00038535550368885114,
-	-0.0011278119591974901,
-	-0.001256574141018997,
-	-0.0006855979112660553,
-	0.00028183690104674524,
-	0.0011138032709078994,
-	0.0013419444558090592,
-	0.0008248419638076362,
-	-0.0001654032000982236,
-	-0.0010858496341338403,
-	-0.0014201283260180805,
-	-0.0009678274979781369,
-	0.00003616688638211446,
-	0.0010430207858427647,
-	0.001489669165309947,
-	0.0011133935469725274,
-	0.00010567871494012563,
-	-0.0009844025347672712,
-	-0.0015490250893007646,
-	-0.0012602129737619913,
-	-0.00025975760571171386,
-	0.0009092053397409749,
-	0.0015966801996656094,
-	0.0014069005507468745,
-	0.0004256152250770598,
-	-0.0008166630283983495,
-	-0.0016310410815449895,
-	-0.001551904286302032,
-	-0.0006026039223436137,
-	0.000706148752255766,
-	0.0016505473488525094,
-	0.001693603033203915,
-	0.0007899628097224246,
-	-0.0005771141839912869,
-	-0.001653627881459043,
-	-0.0018302767420697028,
-	-0.0009868003513296298,
-	0.00042909382233773417,
-	0.0016386896604981935,
-	0.0019600777314220806,
-	0.0011920480606391404,
-	-0.00026176597723481153,
-	-0.0016041884087988883,
-	-0.0020811056045387786,
-	-0.0014045357461293126,
-	0.00007487861282602415,
-	0.00154855475029025,
-	0.0021913323618258963,
-	0.0016229152120444776,
-	0.0001316739000211718,
-	-0.0014702694683702694,
-	-0.0022886738306462555,
-	-0.0018457257372851972,
-	-0.0003579088026190853,
-	0.0013678142344390198,
-	0.0023709505730346845,
-	0.002071366680157783,
-	0.0006037401236609022,
-	-0.0012396742426242122,
-	-0.002435880021832429,
-	-0.002298080841222938,
-	-0.000868953332100734,
-	0.001084374682152157,
-	0.0024811283168682287,
-	0.0025240256439819117,
-	0.0011532969252174066,
-	-0.0009003727538008586,
-	-0.002504193807068532,
-	-0.002747156069764184,
-	-0.0014563681108902347,
-	0.000686172300065946,
-	0.0025025301042162665,
-	0.002965363831870686,
-	0.0017777688863174494,
-	-0.0004401611564610671,
-	-0.00247339547827307,
-	-0.0031763573056023684,
-	-0.00211702484109154,
-	0.00016066055756293812,
-	0.0024138902042609056,
-	0.003377708052208129,
-	0.002473649728441098,
-	0.00015414539919292048,
-	-0.002320909694324333,
-	-0.0035668595137938273,
-	-0.002847224264067737,
-	-0.0005063438053495164,
-	0.0021909951813713765,
-	0.003741007219168563,
-	0.003237328924393408,
-	0.0008982621728014684,
-	-0.0020203790393513383,
-	-0.003897216789761981,
-	-0.00364376245636347,
-	-0.0013327601581037375,
-	0.0018046971462817494,
-	0.004032230463381624,
-	0.0040664935535063215,
-	0.0018133009735306147,
-	-0.0015388953147806108,
-	-0.0041424710487145576,
-	-0.004505831450948513,
-	-0.0023442544853119864,
-	0.00121692827326273,
-	0.004223910409374304,
-	0.004962562605024612,
-	0.0029312538831109372,
-	-0.0008313770316609302,
-	-0.0042719060249228466,
-	-0.005438155938158301,
-	-0.0035817074059022133,
-	0.00037291035009484494,
-	0.0042810010114264834,
-	0.005935137642393327,
-	0.004305677295766339,
-	0.00017070185580748495,
-	-0.004244366017005572,
-	-0.006457320165772498,
-	-0.00511680284151615,
-	-0.0008156178986072722,
-	0.00415347458514,
-	0.007010730780505765,
-	0.006034330881580921,
-	0.0015841146746553088,
-	-0.0039970805463939284,
-	-0.007604700180550138,
-	-0.007086145336080364,
-	-0.0025080746863804545,
-	0.003759458619229189,
-	0.008253462745626345,
-	0.00831354535859354,
-	0.003634513095777312,
-	-0.003417863200032434,
-	-0.008979511698071957,
-	-0.009780297580727787,
-	-0.005036058091399302,
-	0.0029374800803993717,
-	0.009819631418183249,
-	0.01158976790375866,
-	0.006831309769401272,
-	-0.002261299622133625,
-	-0.010836867576103236,
-	-0.013920053338018192,
-	-0.009227640335480757,
-	0.0012883991121866946,
-	0.012147456411324852,
-	0.01710487418387677,
-	0.012622835807265993,
-	0.000179475612482414,
-	-0.013989370487264063,
-	-0.021848307505371586,
-	-0.017887421069800975,
-	-0.0025939127195153634,
-	0.016933869374282606,
-	0.029930288495570265,
-	0.027360192527118275,
-	0.007256317377771403,
-	-0.022773968513728596,
-	-0.04751696107222733,
-	-0.0501877997204294,
-	-0.020095539453228208,
-	0.041505386660445794,
-	0.12025062959232817,
-	0.1930982658069367,
-	0.2367744411564749,
-	0.2367744411564749,
-	0.1930982658069367,
-	0.12025062959232817,
-	0.041505386660445794,
-	-0.020095539453228208,
-	-0.0501877997204294,
-	-0.04751696107222733,
-	-0.022773968513728596,
-	0.007256317377771403,
-	0.027360192527118275,
-	0.029930288495570265,
-	0.016933869374282606,
-	-0.0025939127195153634,
-	-0.017887421069800975,
-	-0.021848307505371586,
-	-0.013989370487264063,
-	0.000179475612482414,
-	0.012622835807265993,
-	0.01710487418387677,
-	0.012147456411324852,
-	0.0012883991121866946,
-	-0.009227640335480757,
-	-0.013920053338018192,
-	-0.010836867576103236,
-	-0.002261299622133625,
-	0.006831309769401272,
-	0.01158976790375866,
-	0.009819631418183249,
-	0.0029374800803993717,
-	-0.005036058091399302,
-	-0.009780297580727787,
-	-0.008979511698071957,
-	-0.003417863200032434,
-	0.003634513095777312,
-	0.00831354535859354,
-	0.008253462745626345,
-	0.003759458619229189,
-	-0.0025080746863804545,
-	-0.007086145336080364,
-	-0.007604700180550138,
-	-0.0039970805463939284,
-	0.0015841146746553088,
-	0.006034330881580921,
-	0.007010730780505765,
-	0.00415347458514,
-	-0.0008156178986072722,
-	-0.00511680284151615,
-	-0.006457320165772498,
-	-0.004244366017005572,
-	0.00017070185580748495,
-	0.004305677295766339,
-	0.005935137642393327,
-	0.0042810010114264834,
-	0.00037291035009484494,
-	-0.0035817074059022133,
-	-0.005438155938158301,
-	-0.0042719060249228466,
-	-0.0008313770316609302,
-	0.0029312538831109372,
-	0.004962562605024612,
-	0.004223910409374304,
-	0.00121692827326273,
-	-0.0023442544853119864,
-	-0.004505831450948513,
-	-0.0041424710487145576,
-	-0.0015388953147806108,
-	0.0018133009735306147,
-	0.0040664935535063215,
-	0.004032230463381624,
-	0.0018046971462817494,
-	-0.0013327601581037375,
-	-0.00364376245636347,
-	-0.003897216789761981,
-	-0.0020203790393513383,
-	0.0008982621728014684,
-	0.003237328924393408,
-	0.003741007219168563,
-	0.0021909951813713765,
-	-0.0005063438053495164,
-	-0.002847224264067737,
-	-0.0035668595137938273,
-	-0.002320909694324333,
-	0.00015414539919292048,
-	0.002473649728441098,
-	0.003377708052208129,
-	0.0024138902042609056,
-	0.00016066055756293812,
-	-0.00211702484109154,
-	-0.0031763573056023684,
-	-0.00247339547827307,
-	-0.0004401611564610671,
-	0.0017777688863174494,
-	0.002965363831870686,
-	0.0025025301042162665,
-	0.000686172300065946,
-	-0.0014563681108902347,
-	-0.002747156069764184,
-	-0.002504193807068532,
-	-0.0009003727538008586,
-	0.0011532969252174066,
-	0.0025240256439819117,
-	0.0024811283168682287,
-	0.001084374682152157,
-	-0.000868953332100734,
-	-0.002298080841222938,
-	-0.002435880021832429,
-	-0.0012396742426242122,
-	0.0006037401236609022,
-	0.002071366680157783,
-	0.0023709505730346845,
-	0.0013678142344390198,
-	-0.0003579088026190853,
-	-0.0018457257372851972,
-	-0.0022886738306462555,
-	-0.0014702694683702694,
-	0.0001316739000211718,
-	0.0016229152120444776,
-	0.0021913323618258963,
-	0.00154855475029025,
-	0.00007487861282602415,
-	-0.0014045357461293126,
-	-0.0020811056045387786,
-	-0.0016041884087988883,
-	-0.00026176597723481153,
-	0.0011920480606391404,
-	0.0019600777314220806,
-	0.0016386896604981935,
-	0.00042909382233773417,
-	-0.0009868003513296298,
-	-0.0018302767420697028,
-	-0.001653627881459043,
-	-0.0005771141839912869,
-	0.0007899628097224246,
-	0.001693603033203915,
-	0.0016505473488525094,
-	0.000706148752255766,
-	-0.0006026039223436137,
-	-0.001551904286302032,
-	-0.0016310410815449895,
-	-0.0008166630283983495,
-	0.0004256152250770598,
-	0.0014069005507468745,
-	0.0015966801996656094,
-	0.0009092053397409749,
-	-0.00025975760571171386,
-	-0.0012602129737619913,
-	-0.0015490250893007646,
-	-0.0009844025347672712,
-	0.00010567871494012563,
-	0.0011133935469725274,
-	0.001489669165309947,
-	0.0010430207858427647,
-	0.00003616688638211446,
-	-0.0009678274979781369,
-	-0.0014201283260180805,
-	-0.0010858496341338403,
-	-0.0001654032000982236,
-	0.0008248419638076362,
-	0.0013419444558090592,
-	0.0011138032709078994,
-	0.00028183690104674524,
-	-0.0006855979112660553,
-	-0.001256574141018997,
-	-0.0011278119591974901,
-	-0.00038535550368885114,
-	0.0005511810395244051,
-	0.0011654706391821539,
-	0.0011288979156968645,
-	0.00047600269533254106,
-	-0.000422525920249919,
-	-0.001070009346340323,
-	-0.0011181090753458836,
-	-0.0005539275212172799,
-	0.00030044588511951695,
-	0.0009714959429209905,
-	0.0010965087843125552,
-	0.0006193611587469451,
-	-0.00018566472440770604,
-	-0.0008712057489294089,
-	-0.00106522572824965,
-	-0.0006726819828099261,
-	0.0000787336346354941,
-	0.0007702837660477187,
-	0.001025342113905362,
-	0.0007142989346574138,
-	0.000019853326354131217,
-	-0.0006698569008782314,
-	-0.0009780052179783102,
-	-0.0007447676153393111,
-	-0.00010978457818496405,
-	0.000570898137026645,
-	0.0009242844129677729,
-	0.0007646464125297957,
-	0.00019079227734707303,
-	-0.0004743568440980121,
-	-0.000865293864157214,
-	-0.0007746156544223702,
-	-0.0002627720301401588,
-	0.00038103728777231073,
-	0.0008020716644921747,
-	0.0007753628468699239,
-	0.0003256803350319196,
-	-0.000291685912306955,
-	-0.0007356534789857852,
-	-0.0007676473593500653,
-	-0.00037959567804859886,
-	0.00020693012954810168,
-	0.0006670119468735746,
-	0.0007522451413711291,
-	0.0004246745826702442,
-	-0.00012730720404969934,
-	-0.0005970695905706307,
-	-0.0007299491540708775,
-	-0.0004611447089976287,
-	0.000053274340707433944,
-	0.0005267123557125201,
-	0.0007015890734451152,
-	0.0004893353987130747,
-	0.000014836372611306772,
-	-0.0004567293483134119,
-	-0.0006679599938658885,
-	-0.0005096012884327245,
-	-0.00007674144019407095,
-	0.0003878874617467388,
-	0.0006298963071643336,
-	0.0005223995788924378,
-	0.0001322907879791506,
-	-0.0003208380777368825,
-	-0.0005881728865401527,
-	-0.0005281905012308189,
-	-0.00018137226187164545,
-	0.0002562055975354706,
-	0.0005435874082710433,
-	0.0005275177167865972,
-	0.00022399472033910841,
-	-0.00019449987785587075,
-	-0.0004968699552605801,
-	-0.0005209190976331516,
-	-0.0002602050810357349,
-	0.00013618892058399405,
-	0.00044874478755472906,
-	0.0005089803975112741,
-	0.00029013751005210314,
-	-0.0000816524154631075,
-	-0.0003998877585478045,
-	-0.0004923001317270983,
-	-0.000313990760719681,
-	0.000031187889628860926,
-	0.0003509152161789372,
-	0.0004714643205165906,
-	0.00033199343244055026,
-	0.000014948767527865337,
-	-0.0003024290233602617,
-	-0.0004470972383524934,
-	-0.0003444635452660949,
-	-0.00005661483344740372,
-	0.00025493235034523295,
-	0.00041976724252722414,
-	0.0003517092034273869,
-	0.0000936803146881106,
-	-0.00020892948322835835,
-	-0.00039008691292793756,
-	-0.00035413195671378273,
-	-0.00012613814156087154,
-	0.00016480693729436718,
-	0.00035858690548839486,
-	0.00035209762369660147,
-	0.0001539764902544676,
-	-0.00012295661551853297,
-	-0.0003258338826630191,
-	-0.0003460502502044329,
-	-0.0001772909510891001,
-	0.00008366430104321278,
-	0.00029232107712948797,
-	0.0003364086515979058,
-	0.00019619163436904692,
-	-0.00004718891675109828,
-	-0.0002585335897191557,
-	-0.0003236198862024589,
-	-0.00021084817993211513,
-	0.000013723019043059293,
-	0.0002249134087249416,
-	0.0003081306003404239,
-	0.00022147102759633957,
-	0.000016601624191172307,
-	-0.0001918508033577001,
-	-0.0002903654779699785,
-	-0.00022827956409724078,
-	-0.00004367439564769654,
-	0.00015973044774709232,
-	0.0002707806468434657,
-	0.00023156497686677846,
-	0.0000674804523993892,
-	-0.00012884463796489044,
-	-0.0002497668172042038,
-	-0.00023158745743232496,
-	-0.00008799593740369557,
-	0.00009949756750099171,
-	0.0002277529378499163,
-	0.00022868099981558545,
-	0.00010529680442881588,
-	-0.00007189032733355634,
-	-0.00020508478143945954,
-	-0.0002231274203566491,
-	-0.00011943096397249396,
-	0.000046248757728297426,
-	0.00018215272844137586,
-	0.00021528564104901596,
-	0.00013055112287161305,
-	-0.00002268563024963061,
-	-0.00015924927657468796,
-	-0.00020544689992505223,
-	-0.0001387713779638981,
-	0.0000013394329614716623,
-	0.00013670177256081098,
-	0.0001939622018189595,
-	0.00014429160194667014,
-	0.000017749281588028325,
-	-0.00011474829670536883,
-	-0.00018111804636037205,
-	-0.00014727442165552213,
-	-0.0000345176169075521,
-	0.00009365474784810233,
-	0.0001672515283488218,
-	0.00014796081774833287,
-	0.00004899894689073472,
-	-0.00007359208874511192,
-	-0.00015262448493907102,
-	-0.0001465439897820959,
-	-0.00006119983230732855,
-	0.00005475366254062155,
-	0.00013753391475192778,
-	0.000143272935973484,
-	0.00007119825132235157,
-	-0.000037261974426543755,
-	-0.0001222231889254793,
-	-0.00013837110081811406,
-	-0.0000790703101083225,
-	0.00002122996032939209,
-	0.00010693385038530367,
-	0.00013207647346029155,
-	0.00008492442438328268,
-	-0.000006735369633472702,
-	-0.00009188360428723134,
-	-0.00012462868689654572,
-	-0.0000888950212909366,
-	-0.000006185695121969894,
-	0.00007725010348590036,
-	0.00011624049012679008,
-	0.00009110599908266018,
-	0.00001749429534252289,
-	-0.00006322092646608981,
-	-0.0001071550321928551,
-	-0.00009173604895929777,
-	-0.000027223744681695147,
-	0.00004990732146095939,
-	0.00009754869109538869,
-	0.00009091283157425619,
-	0.00003536691257938203,
-	-0.000037462438840123496,
-	-0.00008765287081588074,
-	-0.0000888384228541149,
-	-0.000042007069531784254,
-	0.000025945875593591237,
-	0.00007761617555881783,
-	0.00008564978491057572,
-	0.000047178618033185096,
-	-0.0000154588435416977,
-	-0.00006763514273603203,
-	-0.00008154781542580123,
-	-0.00005099499219740134,
-	0.000006017463640365019,
-	0.00005782611100744608,
-	0.00007666701632600644,
-	0.000053519789700703213,
-	0.000002322205599790805,
-	-0.00004834780226015844,
-	-0.00007119593198410217,
-	-0.00005488366601449032,
-	-0.000009578961864436804,
-	0.00003928522630260633,
-	0.00006525971326585448,
-	0.000055167875241966775,
-	0.00001573064679015645,
-	-0.00003076731658910717,
-	-0.000059040334497320424,
-	-0.000054526928619142024,
-	-0.000020841687159573508,
-	0.000022831653466909773,
-	0.0000526340984713108,
-	0.000053042530536763926,
-	0.00002491565741378364,
-	-0.00001557226396666025,
-	-0.000046198143472700565,
-	-0.000050865981777413383,
-	-0.000028033067130329335,
-	0.000009005258285784,
-	0.00003981903233240597,
-	0.000048091548567626997,
-	0.000030230589320380944,
-	-0.000003184937369714104,
-	-0.000033626630650911463,
-	-0.00004486988026483178,
-	-0.00003161602137765386,
-	-0.0000019157376171897207,
-	0.000027667404879805492,
-	0.00004127441627558887,
-	0.000032230821092881615,
-	0.0000062673647521681635,
-	-0.000022039612556495887,
-	-0.000037430889232512026,
-	-0.00003217011691128803,
-	-0.000009891181180652391,
-	0.000016801186334362383,
-	0.00003344130833463864,
-	0.00003152388765346107,
-	0.00001281806020569076,
-	-0.000011994332574402612,
-	-0.000029396239282728652,
-	-0.000030382658399687544,
-	-0.000015093223621246674,
-	0.00000763701024438684,
-	0.000025358527411235555,
-	0.000028810731405264303,
-	0.000016738497832970754,
-	-0.0000037698900968862148,
-	-0.00002141650384473761,
-	-0.000026902712692574238,
-	-0.00001780928787329286,
-	4.021953815642143e-7,
-	0.00001763653475634581,
-	0.000024746525353976816,
-	0.000018370845247859933,
-	0.0000024793956845403756,
-	-0.000014056381828207223,
-	-0.000022401188724177614,
-	-0.000018461182914750188,
-	-0.000004859786120665716,
-	0.000010749661804615328,
-	0.000019975870449370993,
-	0.000018187127708237987,
-	0.000006811642238052536,
-	-0.000007686590275830617,
-	-0.000017464934973325264,
-	-0.000017531215629813144,
-	-0.000008271332013012868,
-	0.000004992230963832062,
-	0.000015044370352182777,
-	0.000016691413969419233,
-	0.000009428598179826871,
-	-0.0000024989323557017393,
-	-0.000012557518749249433,
-	-0.000015490705002890887,
-	-0.000010049590130649052,
-	5.217141990992467e-7,
-	0.000010402410725494906,
-	0.000014391183164913997,
-	0.000010633355109408724,
-	0.0000014569479503829166,
-	-0.000008040568081173693,
-	-0.000012808250506467202,
-	-0.000010510613941178612,
-	-0.0000026465190889620814,
-	0.000006405028147588416,
-	0.00001181871203633049,
-	0.000010889549308684053,
-	0.000004374140685381497,
-	-0.000004047705336773931,
-	-0.000009829098028467324,
-	-0.000009985849675760376,
-	-0.000004608407733554973,
-	0.000003300681237107332,
-	0.000009512110391803634,
-	0.000010836171294667274,
-	0.000006762740491267239,
-	-3.5820793484470297e-7,
-	-0.000006636359255811318,
-	-0.00000872117970296646,
-	-0.0000055358001439318716,
-	0.000001222156630075335,
-	0.000008031869287682198,
-	0.000011417559901073802,
-	0.000009746875825076957,
-	0.0000040415140792482096,
-	-0.000002585706845825623,
-	-0.000006545911504059993,
-	-0.000005600859302033518,
-	1.850467383156997e-8,
-	0.000007741258546744631,
-	0.000013941301265126443,
-	0.000015724284087645305,
-	0.000012342079574603483,
-	0.000005568437408310967,
-	-0.0000011150221342967014,
-	-0.0000041127060375214346,
-	-0.0000013389530165154596,
-	0.0000068541848306632,
-	0.000017820377895432576,
-	0.000027715491928172806,
-	0.000033027007519598565,
-	0.00003187611835079159,
-	0.000024589451560746817,
-	0.000013390727866791427,
-	0.0000014366707908815286,
-	-0.000008346821081828053,
-	-0.000014161441261808751,
-	-0.00001568035927180949,
-	-0.000013819319507616947,
-	-0.000010139808159983564,
-	-0.000006186481174314161,
-	-0.000003016244273831896,
-	-0.0000010852899687113288
-};
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 96000 Hz
-
-	* 0 Hz - 21500 Hz
-	gain = 1
-	desired ripple = 0.1 dB
-	actual ripple = 0.007496277394110995 dB
-
-	* 22000 Hz - 48000 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -115.85619830015295 dB
-
-*/
-
-static double LPF1024_96[FILTER_TAP_1024] = {
-	0.000004449219143524114,
-	0.00002506592504664121,
-	0.0000587368323361594,
-	0.00008341699644554538,
-	0.0000696356493448651,
-	0.000018066375706778557,
-	-0.00003072878994170461,
-	-0.000034772584857783255,
-	4.4960253393903034e-7,
-	0.000027277799453135128,
-	0.000014534136409515875,
-	-0.000015086920349508594,
-	-0.000019530141247485016,
-	0.000004067133555631817,
-	0.000018876709519717275,
-	0.000004280239749964013,
-	-0.000015292014786555476,
-	-0.000009874210067312299,
-	0.000010378009403388471,
-	0.000013048597564929435,
-	-0.000005065840937590083,
-	-0.000014200661611120256,
-	-8.658536964407678e-8,
-	0.000013689937910276946,
-	0.0000047190402453709905,
-	-0.000011829280685977885,
-	-0.000008575659876295646,
-	0.000008900917032007205,
-	0.000011456952645706297,
-	-0.000005179967127137705,
-	-0.000013199158677616643,
-	9.606429020572706e-7,
-	0.000013679316598507045,
-	0.000003426933811493111,
-	-0.000012839487372885412,
-	-0.0000076247708278005905,
-	0.000010702029929192856,
-	0.000011256177116888878,
-	-0.000007394926766116624,
-	-0.000013960409556935915,
-	0.0000031560951365232176,
-	0.000015428969130157403,
-	0.0000016775653082602964,
-	-0.000015433054157796455,
-	-0.000006679079611648547,
-	0.000013866104326879185,
-	0.000011372712583614752,
-	-0.000010755711991294011,
-	-0.00001525999540299377,
-	0.000006294081784866243,
-	0.000017885468787819465,
-	-8.193214666749084e-7,
-	-0.00001887116788434141,
-	-0.0000051835786318535025,
-	0.000017992190793056386,
-	0.00001115725984925636,
-	-0.000015167021783872,
-	-0.000016467657652120865,
-	0.000010541086898180632,
-	0.000020530758514421037,
-	-0.000004418944160882535,
-	-0.000022800061793476855,
-	-0.000002673657263051339,
-	0.00002290391000219421,
-	0.000010093809312357922,
-	-0.000020643648580473144,
-	-0.000017096650648601403,
-	0.000016058662780436424,
-	0.000022923720115198676,
-	-0.00000943379912253346,
-	-0.000026885964107975757,
-	0.000001268241668492036,
-	0.00002840268246014668,
-	0.000007707892687698114,
-	-0.000027126298447122383,
-	-0.00001664242451804458,
-	0.00002295520347264729,
-	0.000024609814033174334,
-	-0.00001608132012539357,
-	-0.00003070475596690257,
-	0.000007006153948695235,
-	0.00003416714919922368,
-	0.0000035299925043704554,
-	-0.000034424290497769355,
-	-0.000014564761712020666,
-	0.00003118983634255468,
-	0.000025001296153149404,
-	-0.00002452827391704744,
-	-0.00003373744642152183,
-	0.000014841358844063829,
-	0.000039743590574282784,
-	-0.0000028841424042309005,
-	-0.0000421986952815137,
-	-0.000010300551282883409,
-	0.00004058938131792561,
-	0.000023482905076124788,
-	-0.00003475539342664605,
-	-0.00003532047984268589,
-	0.000024966991518811297,
-	0.00004451056481153612,
-	-0.00001192127537539799,
-	-0.00004993202407273198,
-	-0.0000033105765882478426,
-	0.00005076243025931126,
-	0.000019364510136401427,
-	-0.0000465735396212012,
-	-0.00003468483056236111,
-	0.000037421939086386974,
-	0.0000476892303743238,
-	-0.000023853984522762235,
-	-0.00005690231189149703,
-	0.000006906084608943995,
-	0.00006112393340318325,
-	0.000011965212672919126,
-	-0.000059580971389589624,
-	-0.00003101825940484859,
-	0.00005202008264678953,
-	0.00004837918866066558,
-	-0.00003875430140970416,
-	-0.00006219228352200899,
-	0.000020703152037513182,
-	0.00007083225624927401,
-	6.664568378047029e-7,
-	-0.00007309414430588618,
-	-0.000023477766411296063,
-	0.00006830626751463609,
-	0.000045569748941689235,
-	-0.000056460057006367805,
-	-0.0000647128272098391,
-	0.00003824101095624285,
-	0.00007881581462626645,
-	-0.000015013764506914997,
-	-0.00008614680931319004,
-	-0.000011268440367587552,
-	0.00008553436828693361,
-	0.00003823003001021459,
-	-0.00007650529717353621,
-	-0.00006326594288903168,
-	0.000059388237283951834,
-	0.0000837912810908152,
-	-0.00003533041967104396,
-	-0.00009749891311646454,
-	0.000006234728679336333,
-	0.00010260273878805674,
-	0.000025376674898212422,
-	-0.00009805396694510803,
-	-0.00005658594774319432,
-	0.00008366998608800955,
-	0.00008432068716820722,
-	-0.00006022033384628106,
-	-0.00010564779936559657,
-	0.000029422881991026536,
-	0.00011809330296204501,
-	0.000006194552863460927,
-	-0.00011988555055320938,
-	-0.000043471835450718634,
-	0.00011018372217368001,
-	0.00007889519552962566,
-	-0.00008920779586654655,
-	-0.00010890501214790793,
-	0.000058300001174844457,
-	0.00013025758583934426,
-	-0.000019851584813072043,
-	-0.00014036386029431437,
-	-0.000022886061045980527,
-	0.00013755135231489755,
-	0.00006603093330491609,
-	-0.0001213175880749118,
-	-0.00010544028488774929,
-	0.0000924279781470666,
-	0.00013709299128543227,
-	-0.00005290790291028614,
-	-0.00015747362349174273,
-	0.000005930635705981303,
-	0.000163941279056243,
-	0.00004440490118901074,
-	-0.0001550699822114896,
-	-0.00009346511183755426,
-	0.00013080993699616053,
-	0.00013646373974521156,
-	-0.00009258596100902732,
-	-0.0001689056777750935,
-	0.000043268931891247484,
-	0.00018706833987667523,
-	0.000013041954408534028,
-	-0.00018840257818058314,
-	-0.00007136275026118819,
-	0.00017180587397218352,
-	0.00012621009003896278,
-	-0.00013785121060829294,
-	-0.00017212944853055962,
-	0.00008882436707345657,
-	0.00020424407220838596,
-	-0.000028551254161299532,
-	-0.0002186985911834165,
-	-0.00003783039851446722,
-	0.00021312915979415545,
-	0.00010431079347756537,
-	-0.00018697618799071015,
-	-0.00016457255402917517,
-	0.00014158070629085418,
-	0.0002125126865189237,
-	-0.00008022721247001779,
-	-0.00024289061751445594,
-	0.000007900291887550656,
-	0.0002518813067179973,
-	0.00006913704173001477,
-	-0.00023744558512638802,
-	-0.00014378527212954221,
-	0.0001997151152636113,
-	0.00020883317584675573,
-	-0.00014102620750896098,
-	-0.0002575911219739727,
-	0.00006582387237183575,
-	0.00028454497656445004,
-	0.000019597904964329912,
-	-0.0002860189811583233,
-	-0.00010771232317983245,
-	0.0002604976519311009,
-	0.00019026924644923392,
-	-0.00020902250987990726,
-	-0.0002591887139255583,
-	0.00013509074887376347,
-	0.0003072090020848363,
-	-0.000044564455071643104,
-	-0.00032872865733108683,
-	-0.00005486178687933111,
-	0.00032034072393528765,
-	0.00015423593031549897,
-	-0.00028131563424139185,
-	-0.0002441710208522208,
-	0.00021377585918172645,
-	0.0003156909447902421,
-	-0.00012265491041956502,
-	-0.00036111468336088296,
-	0.000015360026974405154,
-	0.00037483916986539597,
-	0.0000987964238234023,
-	-0.00035398454208482007,
-	-0.00020939629956698795,
-	0.0002987911307380724,
-	0.00030584088111121105,
-	-0.00021275167052887777,
-	-0.000378342183836216,
-	0.0001024452872681045,
-	0.0004188945378573857,
-	0.000022940738177924484,
-	-0.00042211135553704265,
-	-0.0001523462557251009,
-	0.00038586804378665566,
-	0.0002738004694512732,
-	-0.00031165323744744095,
-	-0.00037550694054688235,
-	0.00020459630999235536,
-	0.0004469569736836846,
-	-0.00007316274542822062,
-	-0.00047998208053183944,
-	-0.00007148377422067597,
-	0.00046963456878816937,
-	0.00021640163878881329,
-	-0.00041481184239320826,
-	-0.0003480146089149564,
-	0.0003185278256815002,
-	0.0004533369206691616,
-	-0.00018786078359363145,
-	-0.0005212858321495815,
-	0.00003337576797126038,
-	0.0005436544153913579,
-	0.00013147171605175294,
-	-0.0005163525553693518,
-	-0.00029193213751754234,
-	0.0004393531821634698,
-	0.00043246712745265647,
-	-0.00031791509473986444,
-	-0.0005394221144995858,
-	0.00016088495448428978,
-	0.0006008023637363813,
-	0.000018319616917694398,
-	-0.0006090665424061126,
-	-0.00020417081956168815,
-	0.0005609292027932588,
-	0.0003796858665773193,
-	-0.00045810985276631357,
-	-0.0005277611239586931,
-	0.0003079328780334079,
-	0.0006334885370014182,
-	-0.00012217526592277184,
-	-0.0006851043148333861,
-	-0.00008358273132985182,
-	0.0006751565452266983,
-	0.0002909060287122189,
-	-0.0006018588655594484,
-	-0.00048052230741863817,
-	0.00046926953727859853,
-	0.0006340906495704603,
-	-0.0002869512451258228,
-	-0.0007356292575883939,
-	0.0000696093592412125,
-	0.0007732411077047826,
-	0.00016398643915765417,
-	-0.0007406121016025292,
-	-0.00039280829829020067,
-	0.0006376994736600456,
-	0.0005954346646259602,
-	-0.00047087423485608047,
-	-0.0007518392770118356,
-	0.0002527482843069101,
-	0.0008453365985429493,
-	-0.0000013717903433929868,
-	-0.0008644266179837702,
-	-0.00026130956878354754,
-	0.0008040900615240015,
-	0.0005114104457708583,
-	-0.0006664345360722112,
-	-0.0007251929549510446,
-	0.00046076938058178563,
-	0.00088117432758696,
-	-0.00020315976211764583,
-	-0.0009622660471352871,
-	-0.00008474046592903235,
-	0.0009576196370602054,
-	0.0003774965038297886,
-	-0.0008639316018657222,
-	-0.0006481719423210506,
-	0.0006859857572613857,
-	0.0008707067301944214,
-	-0.0004365699375335067,
-	-0.0010223605541719962,
-	0.00013562933400543882,
-	0.0010859110873043208,
-	0.00019118033170270775,
-	-0.0010515821229100126,
-	-0.0005146785790068213,
-	0.0009182630128940005,
-	0.0008047239957462139,
-	-0.0006939840338602398,
-	-0.0010329839686973592,
-	0.0003955419308349967,
-	0.001175630158457241,
-	-0.0000472952757029506,
-	-0.0012156838541652407,
-	-0.0003207069816551314,
-	0.0011449156161806924,
-	0.0006752663180024579,
-	-0.0009649834756460777,
-	-0.0009829512691073084,
-	0.0006877421336727265,
-	0.0012132090984022608,
-	-0.0003345835495422429,
-	-0.0013413381167103687,
-	-0.0000651655873778361,
-	0.0013509885057229364,
-	0.00047658688061010955,
-	-0.0012360466222370741,
-	-0.0008621625115197046,
-	0.0010016294881865023,
-	0.0011851148141809823,
-	-0.000664092711155885,
-	-0.001412798804178468,
-	0.00025005816533837716,
-	0.001519932296124561,
-	0.00020561219608699572,
-	-0.0014912446411817215,
-	-0.0006626732900277338,
-	0.001323312837384735,
-	0.0010789484831972979,
-	-0.0010254285291181051,
-	-0.0014141638499797497,
-	0.00061927318568871,
-	0.0016337226178562878,
-	-0.00013747656846445615,
-	-0.0017121413472644753,
-	-0.00037890013892289575,
-	0.0016357982856603655,
-	0.0008837687991151189,
-	-0.0014047088673318834,
-	-0.0013300270140376887,
-	0.0010331187461040756,
-	0.0016738097051042459,
-	-0.0005488641108896348,
-	-0.001878677974155797,
-	-0.000008566315215607425,
-	0.001919311289877134,
-	0.0005911328211163433,
-	-0.0017843375339389712,
-	-0.0011462617121951262,
-	0.0014780240682361618,
-	0.0016214777171165544,
-	-0.0010205910268833523,
-	-0.0019692210752534195,
-	0.0004470722605557194,
-	0.0021514071906069848,
-	0.0001951941084537904,
-	-0.0021433413671252182,
-	-0.0008502944639509706,
-	0.0019366414021882046,
-	0.0014584853183704847,
-	-0.0015407439126670214,
-	-0.001961449880214663,
-	0.0009829039817791966,
-	0.0023077031913203323,
-	-0.00030655483806677196,
-	-0.0024576249965188534,
-	-0.0004318924266494598,
-	0.00238761830052539,
-	0.0011675257291265068,
-	-0.0020930749996908187,
-	-0.0018324433323501903,
-	0.001589743549187862,
-	0.0023618184032646295,
-	-0.0009132819097909301,
-	-0.002699947622861581,
-	0.0001170013909012701,
-	0.002805765808522469,
-	0.0007320939159814953,
-	-0.0026572962393481554,
-	-0.0015586598146799838,
-	0.002254648884810249,
-	0.0022854208650641417,
-	-0.0016211755109701012,
-	-0.0028401084645273385,
-	0.0008025365382122485,
-	0.0031622387163206134,
-	0.0001362325112422195,
-	-0.0032092166933378103,
-	-0.0011155632815784682,
-	0.002961129873419123,
-	0.002047710488505847,
-	-0.0024238260010807098,
-	-0.002844228088966661,
-	0.0016298302963694633,
-	0.0034239341535230996,
-	-0.0006368719904351232,
-	-0.0037205733343041165,
-	-0.0004758300900356542,
-	0.0036896355578990053,
-	0.001613422526299001,
-	-0.0033136113012328665,
-	-0.0026729619038449726,
-	0.0026052092080055553,
-	0.0035521825662102793,
-	-0.0016079976280000048,
-	-0.004158622951921272,
-	0.0003944245138177258,
-	0.004418428669892066,
-	0.0009387717631734768,
-	-0.0042840956260345835,
-	-0.0022775594883859846,
-	0.0037404223416070293,
-	0.003499627848439463,
-	-0.002807903756500191,
-	-0.004484553399688428,
-	0.001543328574280105,
-	0.005124437896465784,
-	-0.000037373208525002634,
-	-0.005334261763047098,
-	-0.0015909519111861018,
-	0.005060905318296786,
-	0.0032026377184591194,
-	-0.004289974028263243,
-	-0.00464910742913253,
-	0.0030499624039735706,
-	0.005784218822576964,
-	-0.00141314198654223,
-	-0.00647697376980409,
-	-0.0005072603283841894,
-	0.006623656440143206,
-	0.0025632371125177567,
-	-0.0061586854389030525,
-	-0.004581360835917818,
-	0.00506332066807376,
-	0.006375031563290071,
-	-0.0033710240833768478,
-	-0.007758340291035639,
-	0.001169316489945887,
-	0.008560815742562676,
-	0.001402161714184927,
-	-0.00864225587297559,
-	-0.0041578866558801535,
-	0.00790589636478019,
-	0.006875948779509387,
-	-0.006309547767659347,
-	-0.009310639537096672,
-	0.0038736559949837887,
-	0.011207315396530367,
-	-0.0006852472974332964,
-	-0.012317587412268403,
-	-0.0031014351317150365,
-	0.012414697682220102,
-	0.007268786496801086,
-	-0.011306070468856075,
-	-0.011542042904670964,
-	0.00884252081147064,
-	0.015597544051304825,
-	-0.004920730428963302,
-	-0.01906944603252986,
-	-0.0005236594313246272,
-	0.0215505953557832,
-	0.0075391050389166546,
-	-0.022577165233932172,
-	-0.01621097100253689,
-	0.021573865185653684,
-	0.02678093082015705,
-	-0.01769459627581711,
-	-0.039947801205761295,
-	0.009336789668099171,
-	0.05780025492357212,
-	0.007676852397157466,
-	-0.08789427125129348,
-	-0.050689249105167644,
-	0.17980365360898365,
-	0.4150739265986225,
-	0.4150739265986225,
-	0.17980365360898365,
-	-0.050689249105167644,
-	-0.08789427125129348,
-	0.007676852397157466,
-	0.05780025492357212,
-	0.009336789668099171,
-	-0.039947801205761295,
-	-0.01769459627581711,
-	0.02678093082015705,
-	0.021573865185653684,
-	-0.01621097100253689,
-	-0.022577165233932172,
-	0.0075391050389166546,
-	0.0215505953557832,
-	-0.0005236594313246272,
-	-0.01906944603252986,
-	-0.004920730428963302,
-	0.015597544051304825,
-	0.00884252081147064,
-	-0.011542042904670964,
-	-0.011306070468856075,
-	0.007268786496801086,
-	0.012414697682220102,
-	-0.0031014351317150365,
-	-0.012317587412268403,
-	-0.0006852472974332964,
-	0.011207315396530367,
-	0.0038736559949837887,
-	-0.009310639537096672,
-	-0.006309547767659347,
-	0.006875948779509387,
-	0.00790589636478019,
-	-0.0041578866558801535,
-	-0.00864225587297559,
-	0.001402161714184927,
-	0.008560815742562676,
-	0.001169316489945887,
-	-0.007758340291035639,
-	-0.0033710240833768478,
-	0.006375031563290071,
-	0.00506332066807376,
-	-0.004581360835917818,
-	-0.0061586854389030525,
-	0.0025632371125177567,
-	0.006623656440143206,
-	-0.0005072603283841894,
-	-0.00647697376980409,
-	-0.00141314198654223,
-	0.005784218822576964,
-	0.0030499624039735706,
-	-0.00464910742913253,
-	-0.004289974028263243,
-	0.0032026377184591194,
-	0.005060905318296786,
-	-0.0015909519111861018,
-	-0.005334261763047098,
-	-0.000037373208525002634,
-	0.005124437896465784,
-	0.001543328574280105,
-	-0.004484553399688428,
-	-0.002807903756500191,
-	0.003499627848439463,
-	0.0037404223416070293,
-	-0.0022775594883859846,
-	-0.0042840956260345835,
-	0.0009387717631734768,
-	0.004418428669892066,
-	0.0003944245138177258,
-	-0.004158622951921272,
-	-0.0016079976280000048,
-	0.0035521825662102793,
-	0.0026052092080055553,
-	-0.0026729619038449726,
-	-0.0033136113012328665,
-	0.001613422526299001,
-	0.0036896355578990053,
-	-0.0004758300900356542,
-	-0.0037205733343041165,
-	-0.0006368719904351232,
-	0.0034239341535230996,
-	0.0016298302963694633,
-	-0.002844228088966661,
-	-0.0024238260010807098,
-	0.002047710488505847,
-	0.002961129873419123,
-	-0.0011155632815784682,
-	-0.0032092166933378103,
-	0.0001362325112422195,
-	0.0031622387163206134,
-	0.0008025365382122485,
-	-0.0028401084645273385,
-	-0.0016211755109701012,
-	0.0022854208650641417,
-	0.002254648884810249,
-	-0.0015586598146799838,
-	-0.0026572962393481554,
-	0.0007320939159814953,
-	0.002805765808522469,
-	0.0001170013909012701,
-	-0.002699947622861581,
-	-0.0009132819097909301,
-	0.0023618184032646295,
-	0.001589743549187862,
-	-0.0018324433323501903,
-	-0.0020930749996908187,
-	0.0011675257291265068,
-	0.00238761830052539,
-	-0.0004318924266494598,
-	-0.0024576249965188534,
-	-0.00030655483806677196,
-	0.0023077031913203323,
-	0.0009829039817791966,
-	-0.001961449880214663,
-	-0.0015407439126670214,
-	0.0014584853183704847,
-	0.0019366414021882046,
-	-0.0008502944639509706,
-	-0.0021433413671252182,
-	0.0001951941084537904,
-	0.0021514071906069848,
-	0.0004470722605557194,
-	-0.0019692210752534195,
-	-0.0010205910268833523,
-	0.0016214777171165544,
-	0.0014780240682361618,
-	-0.0011462617121951262,
-	-0.0017843375339389712,
-	0.0005911328211163433,
-	0.001919311289877134,
-	-0.000008566315215607425,
-	-0.001878677974155797,
-	-0.0005488641108896348,
-	0.0016738097051042459,
-	0.0010331187461040756,
-	-0.0013300270140376887,
-	-0.0014047088673318834,
-	0.0008837687991151189,
-	0.0016357982856603655,
-	-0.00037890013892289575,
-	-0.0017121413472644753,
-	-0.00013747656846445615,
-	0.0016337226178562878,
-	0.00061927318568871,
-	-0.0014141638499797497,
-	-0.0010254285291181051,
-	0.0010789484831972979,
-	0.001323312837384735,
-	-0.0006626732900277338,
-	-0.0014912446411817215,
-	0.00020561219608699572,
-	0.001519932296124561,
-	0.00025005816533837716,
-	-0.001412798804178468,
-	-0.000664092711155885,
-	0.0011851148141809823,
-	0.0010016294881865023,
-	-0.0008621625115197046,
-	-0.0012360466222370741,
-	0.00047658688061010955,
-	0.0013509885057229364,
-	-0.0000651655873778361,
-	-0.0013413381167103687,
-	-0.0003345835495422429,
-	0.0012132090984022608,
-	0.0006877421336727265,
-	-0.0009829512691073084,
-	-0.0009649834756460777,
-	0.0006752663180024579,
-	0.0011449156161806924,
-	-0.0003207069816551314,
-	-0.0012156838541652407,
-	-0.0000472952757029506,
-	0.001175630158457241,
-	0.0003955419308349967,
-	-0.0010329839686973592,
-	-0.0006939840338602398,
-	0.0008047239957462139,
-	0.0009182630128940005,
-	-0.0005146785790068213,
-	-0.0010515821229100126,
-	0.00019118033170270775,
-	0.0010859110873043208,
-	0.00013562933400543882,
-	-0.0010223605541719962,
-	-0.0004365699375335067,
-	0.0008707067301944214,
-	0.0006859857572613857,
-	-0.0006481719423210506,
-	-0.0008639316018657222,
-	0.0003774965038297886,
-	0.0009576196370602054,
-	-0.00008474046592903235,
-	-0.0009622660471352871,
-	-0.00020315976211764583,
-	0.00088117432758696,
-	0.00046076938058178563,
-	-0.0007251929549510446,
-	-0.0006664345360722112,
-	0.0005114104457708583,
-	0.0008040900615240015,
-	-0.00026130956878354754,
-	-0.0008644266179837702,
-	-0.0000013717903433929868,
-	0.0008453365985429493,
-	0.0002527482843069101,
-	-0.0007518392770118356,
-	-0.00047087423485608047,
-	0.0005954346646259602,
-	0.0006376994736600456,
-	-0.00039280829829020067,
-	-0.0007406121016025292,
-	0.00016398643915765417,
-	0.0007732411077047826,
-	0.0000696093592412125,
-	-0.0007356292575883939,
-	-0.0002869512451258228,
-	0.0006340906495704603,
-	0.00046926953727859853,
-	-0.00048052230741863817,
-	-0.0006018588655594484,
-	0.0002909060287122189,
-	0.0006751565452266983,
-	-0.00008358273132985182,
-	-0.0006851043148333861,
-	-0.00012217526592277184,
-	0.0006334885370014182,
-	0.0003079328780334079,
-	-0.0005277611239586931,
-	-0.00045810985276631357,
-	0.0003796858665773193,
-	0.0005609292027932588,
-	-0.00020417081956168815,
-	-0.0006090665424061126,
-	0.000018319616917694398,
-	0.0006008023637363813,
-	0.00016088495448428978,
-	-0.0005394221144995858,
-	-0.00031791509473986444,
-	0.00043246712745265647,
-	0.0004393531821634698,
-	-0.00029193213751754234,
-	-0.0005163525553693518,
-	0.00013147171605175294,
-	0.0005436544153913579,
-	0.00003337576797126038,
-	-0.0005212858321495815,
-	-0.00018786078359363145,
-	0.0004533369206691616,
-	0.0003185278256815002,
-	-0.0003480146089149564,
-	-0.00041481184239320826,
-	0.00021640163878881329,
-	0.00046963456878816937,
-	-0.00007148377422067597,
-	-0.00047998208053183944,
-	-0.00007316274542822062,
-	0.0004469569736836846,
-	0.00020459630999235536,
-	-0.00037550694054688235,
-	-0.00031165323744744095,
-	0.0002738004694512732,
-	0.00038586804378665566,
-	-0.0001523462557251009,
-	-0.00042211135553704265,
-	0.000022940738177924484,
-	0.0004188945378573857,
-	0.0001024452872681045,
-	-0.000378342183836216,
-	-0.00021275167052887777,
-	0.00030584088111121105,
-	0.0002987911307380724,
-	-0.00020939629956698795,
-	-0.00035398454208482007,
-	0.0000987964238234023,
-	0.00037483916986539597,
-	0.000015360026974405154,
-	-0.00036111468336088296,
-	-0.00012265491041956502,
-	0.0003156909447902421,
-	0.00021377585918172645,
-	-0.0002441710208522208,
-	-0.00028131563424139185,
-	0.00015423593031549897,
-	0.00032034072393528765,
-	-0.00005486178687933111,
-	-0.00032872865733108683,
-	-0.000044564455071643104,
-	0.0003072090020848363,
-	0.00013509074887376347,
-	-0.0002591887139255583,
-	-0.00020902250987990726,
-	0.00019026924644923392,
-	0.0002604976519311009,
-	-0.00010771232317983245,
-	-0.0002860189811583233,
-	0.000019597904964329912,
-	0.00028454497656445004,
-	0.00006582387237183575,
-	-0.0002575911219739727,
-	-0.00014102620750896098,
-	0.00020883317584675573,
-	0.0001997151152636113,
-	-0.00014378527212954221,
-	-0.00023744558512638802,
-	0.00006913704173001477,
-	0.0002518813067179973,
-	0.000007900291887550656,
-	-0.00024289061751445594,
-	-0.00008022721247001779,
-	0.0002125126865189237,
-	0.00014158070629085418,
-	-0.00016457255402917517,
-	-0.00018697618799071015,
-	0.00010431079347756537,
-	0.00021312915979415545,
-	-0.00003783039851446722,
-	-0.0002186985911834165,
-	-0.000028551254161299532,
-	0.00020424407220838596,
-	0.00008882436707345657,
-	-0.00017212944853055962,
-	-0.00013785121060829294,
-	0.00012621009003896278,
-	0.00017180587397218352,
-	-0.00007136275026118819,
-	-0.00018840257818058314,
-	0.000013041954408534028,
-	0.00018706833987667523,
-	0.000043268931891247484,
-	-0.0001689056777750935,
-	-0.00009258596100902732,
-	0.00013646373974521156,
-	0.00013080993699616053,
-	-0.00009346511183755426,
-	-0.0001550699822114896,
-	0.00004440490118901074,
-	0.000163941279056243,
-	0.000005930635705981303,
-	-0.00015747362349174273,
-	-0.00005290790291028614,
-	0.00013709299128543227,
-	0.0000924279781470666,
-	-0.00010544028488774929,
-	-0.0001213175880749118,
-	0.00006603093330491609,
-	0.00013755135231489755,
-	-0.000022886061045980527,
-	-0.00014036386029431437,
-	-0.000019851584813072043,
-	0.00013025758583934426,
-	0.000058300001174844457,
-	-0.00010890501214790793,
-	-0.00008920779586654655,
-	0.00007889519552962566,
-	0.00011018372217368001,
-	-0.000043471835450718634,
-	-0.00011988555055320938,
-	0.000006194552863460927,
-	0.00011809330296204501,
-	0.000029422881991026536,
-	-0.00010564779936559657,
-	-0.00006022033384628106,
-	0.00008432068716820722,
-	0.00008366998608800955,
-	-0.00005658594774319432,
-	-0.00009805396694510803,
-	0.000025376674898212422,
-	0.00010260273878805674,
-	0.000006234728679336333,
-	-0.00009749891311646454,
-	-0.00003533041967104396,
-	0.0000837912810908152,
-	0.000059388237283951834,
-	-0.00006326594288903168,
-	-0.00007650529717353621,
-	0.00003823003001021459,
-	0.00008553436828693361,
-	-0.000011268440367587552,
-	-0.00008614680931319004,
-	-0.000015013764506914997,
-	0.00007881581462626645,
-	0.00003824101095624285,
-	-0.0000647128272098391,
-	-0.000056460057006367805,
-	0.000045569748941689235,
-	0.00006830626751463609,
-	-0.000023477766411296063,
-	-0.00007309414430588618,
-	6.664568378047029e-7,
-	0.00007083225624927401,
-	0.000020703152037513182,
-	-0.00006219228352200899,
-	-0.00003875430140970416,
-	0.00004837918866066558,
-	0.00005202008264678953,
-	-0.00003101825940484859,
-	-0.000059580971389589624,
-	0.000011965212672919126,
-	0.00006112393340318325,
-	0.000006906084608943995,
-	-0.00005690231189149703,
-	-0.000023853984522762235,
-	0.0000476892303743238,
-	0.000037421939086386974,
-	-0.00003468483056236111,
-	-0.0000465735396212012,
-	0.000019364510136401427,
-	0.00005076243025931126,
-	-0.0000033105765882478426,
-	-0.00004993202407273198,
-	-0.00001192127537539799,
-	0.00004451056481153612,
-	0.000024966991518811297,
-	-0.00003532047984268589,
-	-0.00003475539342664605,
-	0.000023482905076124788,
-	0.00004058938131792561,
-	-0.000010300551282883409,
-	-0.0000421986952815137,
-	-0.0000028841424042309005,
-	0.000039743590574282784,
-	0.000014841358844063829,
-	-0.00003373744642152183,
-	-0.00002452827391704744,
-	0.000025001296153149404,
-	0.00003118983634255468,
-	-0.000014564761712020666,
-	-0.000034424290497769355,
-	0.0000035299925043704554,
-	0.00003416714919922368,
-	0.000007006153948695235,
-	-0.00003070475596690257,
-	-0.00001608132012539357,
-	0.000024609814033174334,
-	0.00002295520347264729,
-	-0.00001664242451804458,
-	-0.000027126298447122383,
-	0.000007707892687698114,
-	0.00002840268246014668,
-	0.000001268241668492036,
-	-0.000026885964107975757,
-	-0.00000943379912253346,
-	0.000022923720115198676,
-	0.000016058662780436424,
-	-0.000017096650648601403,
-	-0.000020643648580473144,
-	0.000010093809312357922,
-	0.00002290391000219421,
-	-0.000002673657263051339,
-	-0.000022800061793476855,
-	-0.000004418944160882535,
-	0.000020530758514421037,
-	0.000010541086898180632,
-	-0.000016467657652120865,
-	-0.000015167021783872,
-	0.00001115725984925636,
-	0.000017992190793056386,
-	-0.0000051835786318535025,
-	-0.00001887116788434141,
-	-8.193214666749084e-7,
-	0.000017885468787819465,
-	0.000006294081784866243,
-	-0.00001525999540299377,
-	-0.000010755711991294011,
-	0.000011372712583614752,
-	0.000013866104326879185,
-	-0.000006679079611648547,
-	-0.000015433054157796455,
-	0.0000016775653082602964,
-	0.000015428969130157403,
-	0.0000031560951365232176,
-	-0.000013960409556935915,
-	-0.000007394926766116624,
-	0.000011256177116888878,
-	0.000010702029929192856,
-	-0.0000076247708278005905,
-	-0.000012839487372885412,
-	0.000003426933811493111,
-	0.000013679316598507045,
-	9.606429020572706e-7,
-	-0.000013199158677616643,
-	-0.000005179967127137705,
-	0.000011456952645706297,
-	0.000008900917032007205,
-	-0.000008575659876295646,
-	-0.000011829280685977885,
-	0.0000047190402453709905,
-	0.000013689937910276946,
-	-8.658536964407678e-8,
-	-0.000014200661611120256,
-	-0.000005065840937590083,
-	0.000013048597564929435,
-	0.000010378009403388471,
-	-0.000009874210067312299,
-	-0.000015292014786555476,
-	0.000004280239749964013,
-	0.000018876709519717275,
-	0.000004067133555631817,
-	-0.000019530141247485016,
-	-0.000015086920349508594,
-	0.000014534136409515875,
-	0.000027277799453135128,
-	4.4960253393903034e-7,
-	-0.000034772584857783255,
-	-0.00003072878994170461,
-	0.000018066375706778557,
-	0.0000696356493448651,
-	0.00008341699644554538,
-	0.0000587368323361594,
-	0.00002506592504664121,
-	0.000004449219143524114
-};
-/*
-
-FIR filter designed with
-http://t-filter.appspot.com
-
-	sampling frequency: 192000 Hz
-
-	* 0 Hz - 21000 Hz
-	gain = 1
-	desired ripple = 0.1 dB
-	actual ripple = 0.007641543387609277 dB
-
-	* 22000 Hz - 96000 Hz
-	gain = 0
-	desired attenuation = -96 dB
-	actual attenuation = -115.68948963325914 dB
-
-*/
-
-static double LPF1024_192[FILTER_TAP_1024] = {
-	5.732384939313111e-8,
-	-0.000002995124530997341,
-	-0.000007414389316129729,
-	-0.000014575023588006043,
-	-0.000023708305198746705,
-	-0.00003328338759804663,
-	-0.00004102810776324112,
-	-0.000044500571390739185,
-	-0.000041895667939426734,
-	-0.00003281503852103178,
-	-0.000018685700068081398,
-	-0.000002591933639891315,
-	0.000011519826145698853,
-	0.00002005671027009798,
-	0.00002100905132801628,
-	0.000014726331941536703,
-	0.000003896275724682098,
-	-0.00000733530030815466,
-	-0.000014829208095693444,
-	-0.0000159703955751247,
-	-0.000010646013360722382,
-	-0.0000012719735370230235,
-	0.000008179427956846732,
-	0.000013789936827032793,
-	0.00001330202714418844,
-	0.000007054915128006397,
-	-0.000002159302732538178,
-	-0.000010283781270640221,
-	-0.000013743909756354081,
-	-0.000011010830788494336,
-	-0.00000329472792468027,
-	0.000005957282668230628,
-	0.00001256723081836136,
-	0.000013490649124311719,
-	0.00000821459264169915,
-	-9.546425837847541e-7,
-	-0.000009875826386914405,
-	-0.000014421358695625829,
-	-0.00001237337467805291,
-	-0.0000045007260221563704,
-	0.000005705101975049593,
-	0.00001356038487539337,
-	0.00001532320797427613,
-	0.000009965605657617825,
-	-2.521162814830978e-7,
-	-0.000010717135079495118,
-	-0.00001653187924995875,
-	-0.000014794188399932098,
-	-0.0000060328639783132276,
-	0.00000590638968313938,
-	0.000015533934060310803,
-	0.000018228247366462175,
-	0.000012442756081093535,
-	5.586427477450163e-7,
-	-0.000012073785833291778,
-	-0.000019531106609088555,
-	-0.000018083153151891752,
-	-0.000008042912110936015,
-	0.000006210889857560443,
-	0.00001812759157395982,
-	0.000021983743273574117,
-	0.00001561975268714211,
-	0.0000016111838367923607,
-	-0.00001374641119459346,
-	-0.00002325354601734911,
-	-0.000022170620664919795,
-	-0.00001056305567350533,
-	0.000006525094611355635,
-	0.000021244840678029816,
-	0.00002653563962364359,
-	0.0000194991236098124,
-	0.000002947005197179089,
-	-0.00001568816092629852,
-	-0.00002767603388663566,
-	-0.000027066894954007395,
-	-0.000013625646000949535,
-	0.00000681736934223362,
-	0.000024874185731625778,
-	0.00003189777685264989,
-	0.000024109226837738523,
-	0.0000045899603766169495,
-	-0.00001789500761255502,
-	-0.00003281677194999471,
-	-0.00003280019680852152,
-	-0.00001724889345205945,
-	0.000007095546365378221,
-	0.000029051511450492384,
-	0.00003811915611192215,
-	0.000029486893290679676,
-	0.000006542159661631028,
-	-0.000020406411500654868,
-	-0.00003874218975525262,
-	-0.00003943351223721377,
-	-0.000021460486113752548,
-	0.000007384438499836809,
-	0.00003384676693257152,
-	0.00004528503465371475,
-	0.00003569356429847407,
-	0.000008811044635790377,
-	-0.000023275569262007185,
-	-0.00004554508015863123,
-	-0.00004705903698196971,
-	-0.00002631083356618592,
-	0.000007698338137981426,
-	0.00003933235410925248,
-	0.00005349201042481846,
-	0.00004280454136317392,
-	0.000011415417442044681,
-	-0.000026547916245739522,
-	-0.000053311588334018505,
-	-0.000055760259417693607,
-	-0.000031838706909641476,
-	0.000008063226269081897,
-	0.00004558697333505023,
-	0.00006283277335567137,
-	0.00005087909213646893,
-	0.000014347733022596164,
-	-0.000030300116060848745,
-	-0.00006215597690325007,
-	-0.00006563738442212655,
-	-0.00003808245230975486,
-	0.000008523261549407315,
-	0.00005271964945171215,
-	0.00007343260796145781,
-	0.00006000154407018752,
-	0.00001761230012298181,
-	-0.00003461043491159405,
-	-0.00007220346319948724,
-	-0.00007680469452120502,
-	-0.00004509186227026753,
-	0.000009117674241916548,
-	0.00006084250700734425,
-	0.0000854267627404686,
-	0.00007027015582612183,
-	0.00002122844789117863,
-	-0.0000395421761557929,
-	-0.00008356404837658247,
-	-0.0000893610555988591,
-	-0.0000529030772706927,
-	0.000009892906421364906,
-	0.00007006250039926729,
-	0.00009892881932231115,
-	0.00008174503324515726,
-	0.000025165906449978364,
-	-0.00004521061088047025,
-	-0.000096391030105906,
-	-0.00010343027775420537,
-	-0.0000615541393800883,
-	0.000010914619452507617,
-	0.00008051922165919722,
-	0.0001140875872650641,
-	0.00009451420902125749,
-	0.000029409303196346074,
-	-0.000051729543446296596,
-	-0.0001108457740723979,
-	-0.00011914767355869508,
-	-0.00007109221689745329,
-	0.00001224533282370695,
-	0.00009235531876738242,
-	0.00013105942043558331,
-	0.0001086763187498838,
-	0.00003395702662085722,
-	-0.000059194068800461757,
-	-0.0001270641177103661,
-	-0.0001366164248252694,
-	-0.00008152942017631855,
-	0.000013977656600351354,
-	0.00010572916590068265,
-	0.00014999414972685564,
-	0.00012429776781120773,
-	0.000038752725242791594,
-	-0.00006776701275240774,
-	-0.00014524862430147152,
-	-0.00015599143055973407,
-	-0.00009290594138570706,
-	0.000016201595544464193,
-	0.0001208176036922023,
-	0.00017107345263432568,
-	0.0001414814051180414,
-	0.00004377436066102236,
-	-0.0000775807462573799,
-	-0.00016557399663954075,
-	-0.00017740268700170764,
-	-0.00010524195641353178,
-	0.000019020344018255317,
-	0.00013780065955850426,
-	0.00019446620316296198,
-	0.0001603003617144306,
-	0.00004896111919824208,
-	-0.0000888061442200792,
-	-0.0001882459950842544,
-	-0.0002009939853060925,
-	-0.00011854809460761659,
-	0.000022563525698882233,
-	0.00015688947116415886,
-	0.00022036938989866852,
-	0.0001808470555398744,
-	0.000054255669217518296,
-	-0.00010162579632242586,
-	-0.0002134837510806329,
-	-0.00022692126890369227,
-	-0.000132844545218473,
-	0.000026956437781931536,
-	0.00017829254088985104,
-	0.0002489729423841409,
-	0.00020319860664818484,
-	0.00005958069016011972,
-	-0.000116233299696151,
-	-0.00024151030808230542,
-	-0.0002553219075739514,
-	-0.0001481125386004683,
-	0.000032374521737551104,
-	0.00020227012443688227,
-	0.00028050563133280115,
-	0.00022744781947456043,
-	0.00006485245092886926,
-	-0.0001328553061751487,
-	-0.00027258751320419314,
-	-0.0002863780293020681,
-	-0.00016437169290735098,
-	0.00003896243005588468,
-	0.00022905464321105892,
-	0.00031516891949876153,
-	0.0002536610680119409,
-	0.00006996181825766191,
-	-0.00015172830327918953,
-	-0.00030696882833116486,
-	-0.0003202336858140739,
-	-0.00018157911901024368,
-	0.00004694327596058949,
-	0.0002589568584267673,
-	0.00035322527688814385,
-	0.0002819352274660386,
-	0.00007479723333122215,
-	-0.00017311990486413388,
-	-0.0003449534436357346,
-	-0.00035708109995318243,
-	-0.00019973230198942044,
-	0.00005650901411089541,
-	0.00029226190660368794,
-	0.00039491008503039104,
-	0.0003123348953601127,
-	0.00007921106536358135,
-	-0.00019732935244931495,
-	-0.00038685671893743127,
-	-0.0003971039130860373,
-	-0.00021879319132858487,
-	0.00006790747207867101,
-	0.0003293171777746329,
-	0.00044051243227728396,
-	0.000344958455550035,
-	0.00008306822318666412,
-	-0.00022465760274655995,
-	-0.00043299700007073656,
-	-0.00044047807102391316,
-	-0.00023870067545188963,
-	0.00008142001434434474,
-	0.0003705005497770655,
-	0.000490332250630912,
-	0.0003798844862338567,
-	0.00008618130353115488,
-	-0.0002554799362063903,
-	-0.0004837713862016497,
-	-0.0004874448505842913,
-	-0.00025943399733418095,
-	0.00009731275061795888,
-	0.0004161902942650928,
-	0.0005446716435634876,
-	0.00041718406696742365,
-	0.00008834419412737403,
-	-0.0002901927514399932,
-	-0.0005395845885466463,
-	-0.0005382244687167511,
-	-0.0002809167182144312,
-	0.00011593485503138594,
-	0.0004668562550358207,
-	0.0006039094098007255,
-	0.0004569720904349198,
-	0.00008935615212750451,
-	-0.0003292159691310272,
-	-0.000600873560452496,
-	-0.0005930566772063596,
-	-0.0003030665499687982,
-	0.00013766467962847423,
-	0.0005230043031040096,
-	0.0006684443526354385,
-	0.0004993492510134692,
-	0.0000889638982091055,
-	-0.0003730473218001383,
-	-0.0006681529581548878,
-	-0.0006522320271593518,
-	-0.00032580912874029006,
-	0.00016291300578956288,
-	0.0005851930689832412,
-	0.0007387190867073685,
-	0.0005444261387162935,
-	0.00008688146870451937,
-	-0.00042224785490096225,
-	-0.0007420036887959418,
-	-0.0007160793171652949,
-	-0.0003490607220689191,
-	0.0001921458341283233,
-	0.000654058965827219,
-	0.0008152423881481406,
-	0.0005923381606832221,
-	0.00008279563582384248,
-	-0.0004774434691409633,
-	-0.0008230755976995103,
-	-0.0007849631987568346,
-	-0.00037271710738433667,
-	0.00022590323777417194,
-	0.0007303366575591422,
-	0.0008986016763482808,
-	0.0006432418795176939,
-	0.000076342835347059,
-	-0.0005393640295663494,
-	-0.000912132428475843,
-	-0.000859321667496573,
-	-0.00039667311219512244,
-	0.00026480142663593985,
-	0.0008148787979506917,
-	0.0009894906417441593,
-	0.000697338954362689,
-	0.0000671218402427792,
-	-0.0006088423146580527,
-	-0.0010100567136430126,
-	-0.0009396684735325382,
-	-0.0004208154446374747,
-	0.00030955022198011464,
-	0.0009086763972760061,
-	0.001088720863226173,
-	0.0007548689468376054,
-	0.000054664535599749594,
-	-0.000686858771254236,
-	-0.0011178947781317697,
-	-0.0010266205250397905,
-	-0.0004450211259270636,
-	0.0003609834178104427,
-	0.0010129058601103212,
-	0.0011972651864054279,
-	0.0008161291074456624,
-	0.000038421930822342114,
-	-0.0007745840963555642,
-	-0.001236909515616151,
-	-0.001120937380448221,
-	-0.0004691648268640018,
-	0.0004200888609381093,
-	0.0011289847096690698,
-	0.001316315502052761,
-	0.000881509766031662,
-	0.000017763620914343717,
-	-0.0008734121498473937,
-	-0.0013686264286857624,
-	-0.0012235540894009519,
-	-0.0004931180863907048,
-	0.00048804579164119806,
-	0.0012586282069898336,
-	0.0014473285900325373,
-	0.0009515012561183692,
-	-0.000008066137603215745,
-	-0.0009850430084223153,
-	-0.0015149225560132944,
-	-0.0013356345149675465,
-	-0.0005167380221446533,
-	0.0005663024476848302,
-	0.0014039648832924378,
-	0.0015921323387516853,
-	0.0010267436599425265,
-	-0.000039980601894741344,
-	-0.0011115845932019662,
-	-0.0016781513559039497,
-	-0.0014586619107919844,
-	-0.0005398793549362328,
-	0.0006566532695096868,
-	0.001567671837023656,
-	0.0017530559264916892,
-	0.0011080878978398944,
-	-0.00007909108938039061,
-	-0.001255682893090268,
-	-0.0018613095123099408,
-	-0.0015945678529681309,
-	-0.0005624274019284695,
-	0.0007613101185440537,
-	0.0017531018782725792,
-	0.0019330312192734113,
-	0.0011965909491074838,
-	-0.00012685670163194184,
-	-0.0014207843980681978,
-	-0.00206831588083728,
-	-0.0017459102981978575,
-	-0.0005842868110523522,
-	0.0008831200283039535,
-	0.0019646377611572644,
-	0.0021359517336459865,
-	0.0012937468139486662,
-	-0.00018505156525351138,
-	-0.0016112725491676228,
-	-0.0023041974894452218,
-	-0.001915946846431197,
-	-0.0006052211998882486,
-	0.0010259731679074637,
-	0.0022082369546082645,
-	0.0023671529964106757,
-	0.0014016983254689478,
-	-0.00025593254331395606,
-	-0.0018329773818618355,
-	-0.002575754340251432,
-	-0.0021092083514944035,
-	-0.0006251350657109493,
-	0.001194861894053302,
-	0.0024916925164307252,
-	0.002633610774262166,
-	0.0015231056606654072,
-	-0.00034282876660269717,
-	-0.002094112620100304,
-	-0.0028925265935435384,
-	-0.0023320781487148755,
-	-0.0006439478096310847,
-	0.0013967729854439308,
-	0.0028260369347295473,
-	0.0029453684031394817,
-	0.0016620825008595546,
-	-0.0004499977414446187,
-	-0.002405865586870962,
-	-0.0032676926672110477,
-	-0.002593408119863926,
-	-0.0006614502518582479,
-	0.0016416834829062112,
-	0.003227002346943362,
-	0.0033167240310830503,
-	0.0018243542672467335,
-	-0.0005838882774412274,
-	-0.002784845099259867,
-	-0.0037208609153253445,
-	-0.0029065178149466357,
-	-0.0006775918784117797,
-	0.0019442257115597874,
-	0.0037179987276143973,
-	0.0037692145319913124,
-	0.0020188285969533763,
-	-0.000753826421503349,
-	-0.0032558107946200772,
-	-0.004281551102313349,
-	-0.0032915813221286094,
-	-0.0006922397590971022,
-	0.002326937986648083,
-	0.004335231352769519,
-	0.004336270584001769,
-	0.00225927594424633,
-	-0.0009747594448035721,
-	-0.0038583062736355007,
-	-0.004997133274974968,
-	-0.0037811921022471886,
-	-0.0007052561076404197,
-	0.0028265648246473107,
-	0.005138230779207769,
-	0.00507336576496093,
-	0.0025689277918601264,
-	-0.0012714150799949188,
-	-0.0046588670479872875,
-	-0.005948135073590903,
-	-0.004431353558317859,
-	-0.0007166394880447685,
-	0.0035068994240217747,
-	0.0062314781745863084,
-	0.006078821855273324,
-	0.002989347313501119,
-	-0.0016885532492914937,
-	-0.00577911097211555,
-	-0.007283290974447884,
-	-0.005346588744894581,
-	-0.0007262369541386524,
-	0.004490116424178474,
-	0.00781743888962345,
-	0.007545600697176357,
-	0.00360321163279737,
-	-0.0023164002495889183,
-	-0.007467835342689177,
-	-0.009311568240236037,
-	-0.0067475977116800735,
-	-0.0007339846523904389,
-	0.006042552844292652,
-	0.010345835400183917,
-	0.009910729349595492,
-	0.004601764882352088,
-	-0.0033675336773192318,
-	-0.010325042382732038,
-	-0.012796051078590666,
-	-0.009193367536487647,
-	-0.0007398610077277306,
-	0.00887649147644728,
-	0.015056265088370326,
-	0.014418222633583002,
-	0.00654849392665824,
-	-0.005491920281353769,
-	-0.016260107925829367,
-	-0.020272517422648365,
-	-0.014630994252946011,
-	-0.0007437912052878945,
-	0.015755949586580713,
-	0.027069453501284216,
-	0.026577986458831904,
-	0.012142620546153358,
-	-0.012092477148075672,
-	-0.03634822535223242,
-	-0.04832234192818729,
-	-0.03775349265395012,
-	-0.0007457454198074118,
-	0.05787549614260139,
-	0.12524705148137374,
-	0.18414239669432544,
-	0.21843687319741092,
-	0.21843687319741092,
-	0.18414239669432544,
-	0.12524705148137374,
-	0.05787549614260139,
-	-0.0007457454198074118,
-	-0.03775349265395012,
-	-0.04832234192818729,
-	-0.03634822535223242,
-	-0.012092477148075672,
-	0.012142620546153358,
-	0.026577986458831904,
-	0.027069453501284216,
-	0.015755949586580713,
-	-0.0007437912052878945,
-	-0.014630994252946011,
-	-0.020272517422648365,
-	-0.016260107925829367,
-	-0.005491920281353769,
-	0.00654849392665824,
-	0.014418222633583002,
-	0.015056265088370326,
-	0.00887649147644728,
-	-0.0007398610077277306,
-	-0.009193367536487647,
-	-0.012796051078590666,
-	-0.010325042382732038,
-	-0.0033675336773192318,
-	0.004601764882352088,
-	0.009910729349595492,
-	0.010345835400183917,
-	0.006042552844292652,
-	-0.0007339846523904389,
-	-0.0067475977116800735,
-	-0.009311568240236037,
-	-0.007467835342689177,
-	-0.0023164002495889183,
-	0.00360321163279737,
-	0.007545600697176357,
-	0.00781743888962345,
-	0.004490116424178474,
-	-0.0007262369541386524,
-	-0.005346588744894581,
-	-0.007283290974447884,
-	-0.00577911097211555,
-	-0.0016885532492914937,
-	0.002989347313501119,
-	0.006078821855273324,
-	0.0062314781745863084,
-	0.0035068994240217747,
-	-0.0007166394880447685,
-	-0.004431353558317859,
-	-0.005948135073590903,
-	-0.0046588670479872875,
-	-0.0012714150799949188,
-	0.0025689277918601264,
-	0.00507336576496093,
-	0.005138230779207769,
-	0.0028265648246473107,
-	-0.0007052561076404197,
-	-0.0037811921022471886,
-	-0.004997133274974968,
-	-0.0038583062736355007,
-	-0.0009747594448035721,
-	0.00225927594424633,
-	0.004336270584001769,
-	0.004335231352769519,
-	0.002326937986648083,
-	-0.0006922397590971022,
-	-0.0032915813221286094,
-	-0.004281551102313349,
-	-0.0032558107946200772,
-	-0.000753826421503349,
-	0.0020188285969533763,
-	0.0037692145319913124,
-	0.0037179987276143973,
-	0.0019442257115597874,
-	-0.0006775918784117797,
-	-0.0029065178149466357,
-	-0.0037208609153253445,
-	-0.002784845099259867,
-	-0.0005838882774412274,
-	0.0018243542672467335,
-	0.0033167240310830503,
-	0.003227002346943362,
-	0.0016416834829062112,
-	-0.0006614502518582479,
-	-0.002593408119863926,
-	-0.0032676926672110477,
-	-0.002405865586870962,
-	-0.0004499977414446187,
-	0.0016620825008595546,
-	0.0029453684031394817,
-	0.0028260369347295473,
-	0.0013967729854439308,
-	-0.0006439478096310847,
-	-0.0023320781487148755,
-	-0.0028925265935435384,
-	-0.002094112620100304,
-	-0.00034282876660269717,
-	0.0015231056606654072,
-	0.002633610774262166,
-	0.0024916925164307252,
-	0.001194861894053302,
-	-0.0006251350657109493,
-	-0.0021092083514944035,
-	-0.002575754340251432,
-	-0.0018329773818618355,
-	-0.00025593254331395606,
-	0.0014016983254689478,
-	0.0023671529964106757,
-	0.0022082369546082645,
-	0.0010259731679074637,
-	-0.0006052211998882486,
-	-0.001915946846431197,
-	-0.0023041974894452218,
-	-0.0016112725491676228,
-	-0.00018505156525351138,
-	0.0012937468139486662,
-	0.0021359517336459865,
-	0.0019646377611572644,
-	0.0008831200283039535,
-	-0.0005842868110523522,
-	-0.0017459102981978575,
-	-0.00206831588083728,
-	-0.0014207843980681978,
-	-0.00012685670163194184,
-	0.0011965909491074838,
-	0.0019330312192734113,
-	0.0017531018782725792,
-	0.0007613101185440537,
-	-0.0005624274019284695,
-	-0.0015945678529681309,
-	-0.0018613095123099408,
-	-0.001255682893090268,
-	-0.00007909108938039061,
-	0.0011080878978398944,
-	0.0017530559264916892,
-	0.001567671837023656,
-	0.0006566532695096868,
-	-0.0005398793549362328,
-	-0.0014586619107919844,
-	-0.0016781513559039497,
-	-0.0011115845932019662,
-	-0.000039980601894741344,
-	0.0010267436599425265,
-	0.0015921323387516853,
-	0.0014039648832924378,
-	0.0005663024476848302,
-	-0.0005167380221446533,
-	-0.0013356345149675465,
-	-0.0015149225560132944,
-	-0.0009850430084223153,
-	-0.000008066137603215745,
-	0.0009515012561183692,
-	0.0014473285900325373,
-	0.0012586282069898336,
-	0.00048804579164119806,
-	-0.0004931180863907048,
-	-0.0012235540894009519,
-	-0.0013686264286857624,
-	-0.0008734121498473937,
-	0.000017763620914343717,
-	0.000881509766031662,
-	0.001316315502052761,
-	0.0011289847096690698,
-	0.0004200888609381093,
-	-0.0004691648268640018,
-	-0.001120937380448221,
-	-0.001236909515616151,
-	-0.0007745840963555642,
-	0.000038421930822342114,
-	0.0008161291074456624,
-	0.0011972651864054279,
-	0.0010129058601103212,
-	0.0003609834178104427,
-	-0.0004450211259270636,
-	-0.0010266205250397905,
-	-0.0011178947781317697,
-	-0.000686858771254236,
-	0.000054664535599749594,
-	0.0007548689468376054,
-	0.001088720863226173,
-	0.0009086763972760061,
-	0.00030955022198011464,
-	-0.0004208154446374747,
-	-0.0009396684735325382,
-	-0.0010100567136430126,
-	-0.0006088423146580527,
-	0.0000671218402427792,
-	0.000697338954362689,
-	0.0009894906417441593,
-	0.0008148787979506917,
-	0.00026480142663593985,
-	-0.00039667311219512244,
-	-0.000859321667496573,
-	-0.000912132428475843,
-	-0.0005393640295663494,
-	0.000076342835347059,
-	0.0006432418795176939,
-	0.0008986016763482808,
-	0.0007303366575591422,
-	0.00022590323777417194,
-	-0.00037271710738433667,
-	-0.0007849631987568346,
-	-0.0008230755976995103,
-	-0.0004774434691409633,
-	0.00008279563582384248,
-	0.0005923381606832221,
-	0.0008152423881481406,
-	0.000654058965827219,
-	0.0001921458341283233,
-	-0.0003490607220689191,
-	-0.0007160793171652949,
-	-0.0007420036887959418,
-	-0.00042224785490096225,
-	0.00008688146870451937,
-	0.0005444261387162935,
-	0.0007387190867073685,
-	0.0005851930689832412,
-	0.00016291300578956288,
-	-0.00032580912874029006,
-	-0.0006522320271593518,
-	-0.0006681529581548878,
-	-0.0003730473218001383,
-	0.0000889638982091055,
-	0.0004993492510134692,
-	0.0006684443526354385,
-	0.0005230043031040096,
-	0.00013766467962847423,
-	-0.0003030665499687982,
-	-0.0005930566772063596,
-	-0.000600873560452496,
-	-0.0003292159691310272,
-	0.00008935615212750451,
-	0.0004569720904349198,
-	0.0006039094098007255,
-	0.0004668562550358207,
-	0.00011593485503138594,
-	-0.0002809167182144312,
-	-0.0005382244687167511,
-	-0.0005395845885466463,
-	-0.0002901927514399932,
-	0.00008834419412737403,
-	0.00041718406696742365,
-	0.0005446716435634876,
-	0.0004161902942650928,
-	0.00009731275061795888,
-	-0.00025943399733418095,
-	-0.0004874448505842913,
-	-0.0004837713862016497,
-	-0.0002554799362063903,
-	0.00008618130353115488,
-	0.0003798844862338567,
-	0.000490332250630912,
-	0.0003705005497770655,
-	0.00008142001434434474,
-	-0.00023870067545188963,
-	-0.00044047807102391316,
-	-0.00043299700007073656,
-	-0.00022465760274655995,
-	0.00008306822318666412,
-	0.000344958455550035,
-	0.00044051243227728396,
-	0.0003293171777746329,
-	0.00006790747207867101,
-	-0.00021879319132858487,
-	-0.0003971039130860373,
-	-0.00038685671893743127,
-	-0.00019732935244931495,
-	0.00007921106536358135,
-	0.0003123348953601127,
-	0.00039491008503039104,
-	0.00029226190660368794,
-	0.00005650901411089541,
-	-0.00019973230198942044,
-	-0.00035708109995318243,
-	-0.0003449534436357346,
-	-0.00017311990486413388,
-	0.00007479723333122215,
-	0.0002819352274660386,
-	0.00035322527688814385,
-	0.0002589568584267673,
-	0.00004694327596058949,
-	-0.00018157911901024368,
-	-0.0003202336858140739,
-	-0.00030696882833116486,
-	-0.00015172830327918953,
-	0.00006996181825766191,
-	0.0002536610680119409,
-	0.00031516891949876153,
-	0.00022905464321105892,
-	0.00003896243005588468,
-	-0.00016437169290735098,
-	-0.0002863780293020681,
-	-0.00027258751320419314,
-	-0.0001328553061751487,
-	0.00006485245092886926,
-	0.00022744781947456043,
-	0.00028050563133280115,
-	0.00020227012443688227,
-	0.000032374521737551104,
-	-0.0001481125386004683,
-	-0.0002553219075739514,
-	-0.00024151030808230542,
-	-0.000116233299696151,
-	0.00005958069016011972,
-	0.00020319860664818484,
-	0.0002489729423841409,
-	0.00017829254088985104,
-	0.000026956437781931536,
-	-0.000132844545218473,
-	-0.00022692126890369227,
-	-0.0002134837510806329,
-	-0.00010162579632242586,
-	0.000054255669217518296,
-	0.0001808470555398744,
-	0.00022036938989866852,
-	0.00015688947116415886,
-	0.000022563525698882233,
-	-0.00011854809460761659,
-	-0.0002009939853060925,
-	-0.0001882459950842544,
-	-0.0000888061442200792,
-	0.00004896111919824208,
-	0.0001603003617144306,
-	0.00019446620316296198,
-	0.00013780065955850426,
-	0.000019020344018255317,
-	-0.00010524195641353178,
-	-0.00017740268700170764,
-	-0.00016557399663954075,
-	-0.0000775807462573799,
-	0.00004377436066102236,
-	0.0001414814051180414,
-	0.00017107345263432568,
-	0.0001208176036922023,
-	0.000016201595544464193,
-	-0.00009290594138570706,
-	-0.00015599143055973407,
-	-0.00014524862430147152,
-	-0.00006776701275240774,
-	0.000038752725242791594,
-	0.00012429776781120773,
-	0.00014999414972685564,
-	0.00010572916590068265,
-	0.000013977656600351354,
-	-0.00008152942017631855,
-	-0.0001366164248252694,
-	-0.0001270641177103661,
-	-0.000059194068800461757,
-	0.00003395702662085722,
-	0.0001086763187498838,
-	0.00013105942043558331,
-	0.00009235531876738242,
-	0.00001224533282370695,
-	-0.00007109221689745329,
-	-0.00011914767355869508,
-	-0.0001108457740723979,
-	-0.000051729543446296596,
-	0.000029409303196346074,
-	0.00009451420902125749,
-	0.0001140875872650641,
-	0.00008051922165919722,
-	0.000010914619452507617,
-	-0.0000615541393800883,
-	-0.00010343027775420537,
-	-0.000096391030105906,
-	-0.00004521061088047025,
-	0.000025165906449978364,
-	0.00008174503324515726,
-	0.00009892881932231115,
-	0.00007006250039926729,
-	0.000009892906421364906,
-	-0.0000529030772706927,
-	-0.0000893610555988591,
-	-0.00008356404837658247,
-	-0.0000395421761557929,
-	0.00002122844789117863,
-	0.00007027015582612183,
-	0.0000854267627404686,
-	0.00006084250700734425,
-	0.000009117674241916548,
-	-0.00004509186227026753,
-	-0.00007680469452120502,
-	-0.00007220346319948724,
-	-0.00003461043491159405,
-	0.00001761230012298181,
-	0.00006000154407018752,
-	0.00007343260796145781,
-	0.00005271964945171215,
-	0.000008523261549407315,
-	-0.00003808245230975486,
-	-0.00006563738442212655,
-	-0.00006215597690325007,
-	-0.000030300116060848745,
-	0.000014347733022596164,
-	0.00005087909213646893,
-	0.00006283277335567137,
-	0.00004558697333505023,
-	0.000008063226269081897,
-	-0.000031838706909641476,
-	-0.000055760259417693607,
-	-0.000053311588334018505,
-	-0.000026547916245739522,
-	0.000011415417442044681,
-	0.00004280454136317392,
-	0.00005349201042481846,
-	0.00003933235410925248,
-	0.000007698338137981426,
-	-0.00002631083356618592,
-	-0.00004705903698196971,
-	-0.00004554508015863123,
-	-0.000023275569262007185,
-	0.000008811044635790377,
-	0.00003569356429847407,
-	0.00004528503465371475,
-	0.00003384676693257152,
-	0.000007384438499836809,
-	-0.000021460486113752548,
-	-0.00003943351223721377,
-	-0.00003874218975525262,
-	-0.000020406411500654868,
-	0.000006542159661631028,
-	0.000029486893290679676,
-	0.00003811915611192215,
-	0.000029051511450492384,
-	0.000007095546365378221,
-	-0.00001724889345205945,
-	-0.00003280019680852152,
-	-0.00003281677194999471,
-	-0.00001789500761255502,
-	0.0000045899603766169495,
-	0.000024109226837738523,
-	0.00003189777685264989,
-	0.000024874185731625778,
-	0.00000681736934223362,
-	-0.000013625646000949535,
-	-0.000027066894954007395,
-	-0.00002767603388663566,
-	-0.00001568816092629852,
-	0.000002947005197179089,
-	0.0000194991236098124,
-	0.00002653563962364359,
-	0.000021244840678029816,
-	0.000006525094611355635,
-	-0.00001056305567350533,
-	-0.000022170620664919795,
-	-0.00002325354601734911,
-	-0.00001374641119459346,
-	0.0000016111838367923607,
-	0.00001561975268714211,
-	0.000021983743273574117,
-	0.00001812759157395982,
-	0.000006210889857560443,
-	-0.000008042912110936015,
-	-0.000018083153151891752,
-	-0.000019531106609088555,
-	-0.000012073785833291778,
-	5.586427477450163e-7,
-	0.000012442756081093535,
-	0.000018228247366462175,
-	0.000015533934060310803,
-	0.00000590638968313938,
-	-0.0000060328639783132276,
-	-0.000014794188399932098,
-	-0.00001653187924995875,
-	-0.000010717135079495118,
-	-2.521162814830978e-7,
-	0.000009965605657617825,
-	0.00001532320797427613,
-	0.00001356038487539337,
-	0.000005705101975049593,
-	-0.0000045007260221563704,
-	-0.00001237337467805291,
-	-0.000014421358695625829,
-	-0.000009875826386914405,
-	-9.546425837847541e-7,
-	0.00000821459264169915,
-	0.000013490649124311719,
-	0.00001256723081836136,
-	0.000005957282668230628,
-	-0.00000329472792468027,
-	-0.000011010830788494336,
-	-0.000013743909756354081,
-	-0.000010283781270640221,
-	-0.000002159302732538178,
-	0.000007054915128006397,
-	0.00001330202714418844,
-	0.000013789936827032793,
-	0.000008179427956846732,
-	-0.0000012719735370230235,
-	-0.000010646013360722382,
-	-0.0000159703955751247,
-	-0.000014829208095693444,
-	-0.00000733530030815466,
-	0.000003896275724682098,
-	0.000014726331941536703,
-	0.00002100905132801628,
-	0.00002005671027009798,
-	0.000011519826145698853,
-	-0.000002591933639891315,
-	-0.000018685700068081398,
-	-0.00003281503852103178,
-	-0.000041895667939426734,
-	-0.000044500571390739185,
-	-0.00004102810776324112,
-	-0.00003328338759804663,
-	-0.000023708305198746705,
-	-0.000014575023588006043,
-	-0.000007414389316129729,
-	-0.000002995124530997341,
-	5.732384939313111e-8
-};
-
-
-
-#endif
\ No newline at end of file
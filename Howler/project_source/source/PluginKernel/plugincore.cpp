@@ -272,7 +272,7 @@ bool PluginCore::preProcessAudioBlock(IMidiEventQueue* midiEventQueue)
 	//     for the DSP algorithm at hand
 	//     NOTE: updating (cooking) only once per block usually SAVES CPU cycles
 	//           updating (cooking) once per sample period usually EATS CPU cycles, potentially unnecessarily
-	// updateParameters();
+	updateParameters();
 
 	return true;
 }
@@ -332,7 +332,32 @@ bool PluginCore::processAudioBlock(ProcessBlockInfo& processBlockInfo)
 
 	// --- or FX
 	else if (getPluginType() == kFXPlugin)
-		renderFXPassThrough(processBlockInfo);
+	{
+		if (fx_On)
+		{
+			// --- both channels are driven from input channel 0, so go in reverse order
+			//     to overwrite an in-place channel 0 last
+			const uint32_t start = processBlockInfo.blockStartIndex;
+			const float* input = &processBlockInfo.inputs[0][start];
+			for (unsigned int i = NUM_CHANNELS; i-- > 0;)
+			{
+				if (i >= processBlockInfo.numAudioOutChannels)
+					continue;
+
+				float* output = &processBlockInfo.outputs[i][start];
+				for (uint32_t n = 0; n < processBlockInfo.blockSize; n++)
+				{
+					double y = analogClippingStages[i].processAudioSample(input[n]);
+					output[n] = analogToneControls[i].processAudioSample(y);
+				}
+			}
+		}
+		else
+		{
+			// --- Bypass
+			renderFXPassThrough(processBlockInfo);
+		}
+	}
 
 	return true;
 }
@@ -400,8 +425,11 @@ bool PluginCore::renderFXPassThrough(ProcessBlockInfo& blockInfo)
 		// --- handles multiple channels, but up to you for bookkeeping
 		for (uint32_t channel = 0; channel < blockInfo.numAudioOutChannels; channel++)
 		{
+			// --- a mono input feeds all of the output channels
+			const uint32_t inputChannel = channel < blockInfo.numAudioInChannels ? channel : 0;
+
 			// --- pass through code, or your processed FX version
-			blockInfo.outputs[channel][sample] = blockInfo.inputs[channel][sample];
+			blockInfo.outputs[channel][sample] = blockInfo.inputs[inputChannel][sample];
 		}
 	}
 	return true;
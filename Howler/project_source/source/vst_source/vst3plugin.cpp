@@ -563,6 +563,12 @@ tresult PLUGIN_API VST3Plugin::canProcessSampleSize(int32 symbolicSampleSize)
 	{
 		return kResultTrue;
 	}
+
+	// --- and 64 bit audio if the core has opted in
+	if (symbolicSampleSize == kSample64 && pluginCore && pluginCore->wantsDoublePrecision())
+	{
+		return kResultTrue;
+	}
 	return kResultFalse;
 }
 
@@ -956,9 +962,20 @@ tresult PLUGIN_API VST3Plugin::process(ProcessData& data)
 
     // --- setup buffer processing
     ProcessBufferInfo info;
- 
-    info.inputs = isSynth ? nullptr : &data.inputs[0].channelBuffers32[0];
-    info.outputs = &data.outputs[0].channelBuffers32[0];
+
+    // --- 64-bit buffers only arrive if canProcessSampleSize(kSample64) returned true
+    bool is64Bit = data.symbolicSampleSize == kSample64;
+
+    if (is64Bit)
+    {
+        info.inputs64 = isSynth ? nullptr : &data.inputs[0].channelBuffers64[0];
+        info.outputs64 = &data.outputs[0].channelBuffers64[0];
+    }
+    else
+    {
+        info.inputs = isSynth ? nullptr : &data.inputs[0].channelBuffers32[0];
+        info.outputs = &data.outputs[0].channelBuffers32[0];
+    }
     
     // --- setup channel formats
     SpeakerArrangement inputArr;
@@ -989,7 +1006,10 @@ tresult PLUGIN_API VST3Plugin::process(ProcessData& data)
             // --- output = input
 			for (unsigned int i = 0; i<info.numAuxAudioOutChannels; i++)
             {
-                (data.outputs[0].channelBuffers32[i])[sample] = (data.inputs[0].channelBuffers32[i])[sample];
+                if (is64Bit)
+                    (data.outputs[0].channelBuffers64[i])[sample] = (data.inputs[0].channelBuffers64[i])[sample];
+                else
+                    (data.outputs[0].channelBuffers32[i])[sample] = (data.inputs[0].channelBuffers32[i])[sample];
             }
         }
 
@@ -1015,7 +1035,10 @@ tresult PLUGIN_API VST3Plugin::process(ProcessData& data)
         if (auxBus && auxBus->isActive())
         {
             info.numAuxAudioInChannels = data.inputs[1].numChannels;
-            info.auxInputs = &data.inputs[1].channelBuffers32[0]; //** to sidechain
+            if (is64Bit)
+                info.auxInputs64 = &data.inputs[1].channelBuffers64[0]; //** to sidechain
+            else
+                info.auxInputs = &data.inputs[1].channelBuffers32[0]; //** to sidechain
         }
     }
 
@@ -148,6 +148,10 @@ void PluginCore::updateParameters()
 	// --- set on objects
 	leftAudioFilter.setParameters(filterParams);
 	rightAudioFilter.setParameters(filterParams);
+
+	// --- copy the coefficients to the filter bank
+	stereoFilter.setCoefficients(0, leftAudioFilter.getCoefficients());
+	stereoFilter.setCoefficients(1, rightAudioFilter.getCoefficients());
 }
 
 /**
@@ -170,6 +174,7 @@ bool PluginCore::reset(ResetInfo& resetInfo)
 	// --- other reset inits
 	leftAudioFilter.reset(resetInfo.sampleRate);
 	rightAudioFilter.reset(resetInfo.sampleRate);
+	stereoFilter.reset();
 
 	return PluginBase::reset(resetInfo);
 }
@@ -252,8 +257,14 @@ bool PluginCore::processAudioFrame(ProcessFrameInfo& processFrameInfo)
     // --- do left channel (there will always be at least one channel if we get here)
     double xnL = processFrameInfo.audioInputFrame[0]; //< framework input sample L
 
-    // --- process the audio through the left channel C++ effects object(s)
-    double ynL = leftAudioFilter.processAudioSample(xnL);
+    // --- right channel if we have one, otherwise the right filter follows the left
+    double xnR = processFrameInfo.channelIOConfig.inputChannelFormat == kCFStereo ? processFrameInfo.audioInputFrame[1] : xnL;
+
+    // --- process the audio through both channels' filters in one pass
+    double xn[2] = { xnL, xnR };
+    double yn[2] = { 0.0, 0.0 };
+    stereoFilter.processAudioFrame(xn, yn);
+    double ynL = yn[0];
 
     // --- FX Plugin:
     if (processFrameInfo.channelIOConfig.inputChannelFormat == kCFMono &&
@@ -280,11 +291,8 @@ bool PluginCore::processAudioFrame(ProcessFrameInfo& processFrameInfo)
     else if (processFrameInfo.channelIOConfig.inputChannelFormat == kCFStereo &&
 	    processFrameInfo.channelIOConfig.outputChannelFormat == kCFStereo)
     {
-	    // --- If we get here, we have a separate right channel; get the data
-	    double xnR = processFrameInfo.audioInputFrame[1]; //< framework input sample R
-
-	    // --- process the audio through the right channel C++ effects object(s)
-	    double ynR = rightAudioFilter.processAudioSample(xnR);
+	    // --- If we get here, we have a separate right channel; it was processed with the left
+	    double ynR = yn[1];
 
 	    // --- ynL, ynR
 	    processFrameInfo.audioOutputFrame[0] = ynL; //< framework output sample L
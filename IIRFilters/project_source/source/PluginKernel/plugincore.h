@@ -110,6 +110,7 @@ public:
 protected:
 	AudioFilter leftAudioFilter;
 	AudioFilter rightAudioFilter;
+	BiquadBank<2> stereoFilter;	///< runs the left and right filters in one pass; the AudioFilters calculate the coefficients
 	void updateParameters();	
 
 	// --- END USER VARIABLES AND FUNCTIONS -------------------------------------- //
@@ -62,13 +62,18 @@ void PluginCore::updateParameters()
 	params.fc = filterFc_Hz;
 	params.Q = filterQ;
 
-	// --- apply to all filters
+	// --- apply to the selected topology only; the others catch up in setParameters( )
+	//     on the first frame after they are selected
 	for (unsigned int i = 0; i < NUM_CHANNELS; i++)
 	{
-		rlcLPF[i].setParameters(params);
-		rlcHPF[i].setParameters(params);
-		rlcBPF[i].setParameters(params);
-		rlcBSF[i].setParameters(params);
+		if (compareIntToEnum(filterType, filterTypeEnum::RLC_LPF))
+			rlcLPF[i].setParameters(params);
+		else if (compareIntToEnum(filterType, filterTypeEnum::RLC_HPF))
+			rlcHPF[i].setParameters(params);
+		else if (compareIntToEnum(filterType, filterTypeEnum::RLC_BPF))
+			rlcBPF[i].setParameters(params);
+		else if (compareIntToEnum(filterType, filterTypeEnum::RLC_BSF))
+			rlcBSF[i].setParameters(params);
 	}
 }
 
@@ -59,6 +59,8 @@ PluginBase::~PluginBase()
 	delete[] VSTSAAPluginParameters;
 	delete[] smoothingPluginParameters;
 	delete [] outboundPluginParameters;
+	delete[] activeSmoothingPluginParameters;
+	delete[] isActiveSmoothingParameter;
 }
 
 /**
@@ -67,17 +69,36 @@ PluginBase::~PluginBase()
 Operation:
 - update sample-rate dependent objects
 - PluginParameter will update its smoother (its only sample rate dependent member)
+- when processing fixed-size blocks, smoothing runs once per block (see preProcessAudioBlock( ))
+  so the smoothers are clocked at the block rate to keep the smoothing times in mSec (a short last block
+  takes a partial step, see doParameterSmoothing( )); ramp smoothing parameters are smoothed per sample by
+  the plugin core so they stay at the audio rate
 */
 bool PluginBase::reset(ResetInfo& resetInfo)
 {
+	// --- smoothing update rate
+	double smoothingRate = resetInfo.sampleRate;
+	smoothingBlockSize = 1;
+	if (!pluginDescriptor.processFrames && processBlockInfo.blockSize != WANT_WHOLE_BUFFER)
+	{
+		smoothingBlockSize = processBlockInfo.blockSize;
+		smoothingRate /= smoothingBlockSize;
+	}
+
 	// --- update param smoothers
 	for (std::vector<PluginParameter*>::iterator it = pluginParameters.begin(); it != pluginParameters.end(); ++it)
 	{
 		PluginParameter* piParam = *it;
 		if (piParam)
-			piParam->updateSampleRate(resetInfo.sampleRate);
+		{
+			piParam->updateSampleRate(piParam->getRampSmoothing() ? resetInfo.sampleRate : smoothingRate);
+			piParam->resetMeterAccumulator(resetInfo.sampleRate);
+		}
 	}
 
+	// --- re-sync every bound variable on the next buffer
+	dirtyParameters.setAll();
+
 	return true;
 }
 
@@ -99,8 +120,9 @@ bool PluginBase::initialize(PluginInfo& _pluginInfo)
 \brief initialize object for a new run of audio; called just before audio streams
 
 Operation:
-- iterate through parameters and copy their values into the bound variables you set up
+- iterate through the parameters written since the last buffer (see dirtyParameters) and copy their values into the bound variables you set up
 - then, call the postUpdatePluginParameter method to do any post-update cooking required to use the variable for processing
+- every parameter is synced on the first buffer and after reset( )
 */
 void PluginBase::syncInBoundVariables()
 {
@@ -108,14 +130,31 @@ void PluginBase::syncInBoundVariables()
 	info.bufferProcUpdate = true;
 	info.boundVariableUpdate = true;
 
-	// --- rip through and synch em
-	for (unsigned int i = 0; i < numPluginParameters; i++)
+	// --- take the changed set and synch em; the work is proportional to the number of changes
+	dirtyParameters.takeAll([this, &info](uint32_t index)
 	{
-		if (pluginParameterArray[i] && pluginParameterArray[i]->updateInBoundVariable())
+		PluginParameter* piParam = pluginParameterArray[index];
+		if (piParam && piParam->updateInBoundVariable())
 		{
-			postUpdatePluginParameter(pluginParameterArray[i]->getControlID(), pluginParameterArray[i]->getControlValue(), info);
+			postUpdatePluginParameter(piParam->getControlID(), piParam->getControlValue(), info);
 		}
-	}
+	});
+}
+
+/**
+\brief move the parameters that were given a new smoothing target into the active smoothing list; a parameter
+       leaves the list again when its smoother reaches the target
+*/
+void PluginBase::activateSmoothingParameters()
+{
+	dirtySmoothingParameters.takeAll([this](uint32_t index)
+	{
+		if (!isActiveSmoothingParameter[index])
+		{
+			isActiveSmoothingParameter[index] = true;
+			activeSmoothingPluginParameters[numActiveSmoothingPluginParameters++] = pluginParameterArray[index];
+		}
+	});
 }
 
 /**
@@ -127,6 +166,7 @@ Operation:
 - call the frame processing function that the derived class MUST implement repeatedly until the buffer is processed
 - call the post-processing function on derived class to allow it to do any stuff that requires the buffer to be processed first
 - NOTE: if you want the derived class to process buffers instead of frames, override and implement THIS function in the derived class
+- NOTE: runs with flush-to-zero/denormals-are-zero set (DenormalGuard); an override should hold its own DenormalGuard
 
 \param processBufferInfo - a structure of information about the current buffer to process; includes information from host (BPM, etc...)
 
@@ -134,10 +174,8 @@ Operation:
 */
 bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 {
-	memset(&inputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
-	memset(&outputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
-	memset(&auxInputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
-	memset(&auxOutputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
+	// --- flush-to-zero/denormals-are-zero for the whole buffer, restored on return
+	DenormalGuard denormalGuard;
 
 	// --- for keeping track of host buffer index
 	double sampleInterval = 1.0 / audioProcDescriptor.sampleRate;
@@ -147,6 +185,12 @@ bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 
 	if (pluginDescriptor.processFrames)
 	{
+		// --- frames are only needed here; block processing works on the host pointers directly
+		memset(&inputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
+		memset(&outputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
+		memset(&auxInputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
+		memset(&auxOutputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
+
 		ProcessFrameInfo info;
 
 		info.audioInputFrame = &inputFrame[0];
@@ -171,14 +215,30 @@ bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 		// --- build frames, one sample from each channel
 		for (uint32_t frame = 0; frame<processBufferInfo.numFramesToProcess; frame++)
 		{
-			for (uint32_t i = 0; i<processBufferInfo.numAudioInChannels; i++)
+			if (processBufferInfo.inputs64)
 			{
-				inputFrame[i] = processBufferInfo.inputs[i][frame];
-			}
+				// --- 64-bit host buffers: frames are always 32-bit
+				for (uint32_t i = 0; i<processBufferInfo.numAudioInChannels; i++)
+				{
+					inputFrame[i] = (float)processBufferInfo.inputs64[i][frame];
+				}
 
-			for (uint32_t i = 0; i<processBufferInfo.numAuxAudioInChannels; i++)
+				for (uint32_t i = 0; i<processBufferInfo.numAuxAudioInChannels; i++)
+				{
+					auxInputFrame[i] = (float)processBufferInfo.auxInputs64[i][frame];
+				}
+			}
+			else
 			{
-				auxInputFrame[i] = processBufferInfo.auxInputs[i][frame];
+				for (uint32_t i = 0; i<processBufferInfo.numAudioInChannels; i++)
+				{
+					inputFrame[i] = processBufferInfo.inputs[i][frame];
+				}
+
+				for (uint32_t i = 0; i<processBufferInfo.numAuxAudioInChannels; i++)
+				{
+					auxInputFrame[i] = processBufferInfo.auxInputs[i][frame];
+				}
 			}
 
 			info.currentFrame = frame;
@@ -186,13 +246,30 @@ bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 			// -- process the frame of data
 			processAudioFrame(info);
 
-			for (uint32_t i = 0; i<processBufferInfo.numAudioOutChannels; i++)
+			// --- sample accurate meters
+			accumulateOutBoundVariables(1);
+
+			if (processBufferInfo.outputs64)
 			{
-				processBufferInfo.outputs[i][frame] = outputFrame[i];
+				for (uint32_t i = 0; i<processBufferInfo.numAudioOutChannels; i++)
+				{
+					processBufferInfo.outputs64[i][frame] = outputFrame[i];
+				}
+				for (uint32_t i = 0; i<processBufferInfo.numAuxAudioOutChannels; i++)
+				{
+					processBufferInfo.auxOutputs64[i][frame] = auxOutputFrame[i];
+				}
 			}
-			for (uint32_t i = 0; i<processBufferInfo.numAuxAudioOutChannels; i++)
+			else
 			{
-				processBufferInfo.auxOutputs[i][frame] = auxOutputFrame[i];
+				for (uint32_t i = 0; i<processBufferInfo.numAudioOutChannels; i++)
+				{
+					processBufferInfo.outputs[i][frame] = outputFrame[i];
+				}
+				for (uint32_t i = 0; i<processBufferInfo.numAuxAudioOutChannels; i++)
+				{
+					processBufferInfo.auxOutputs[i][frame] = auxOutputFrame[i];
+				}
 			}
 
 			// --- update per-frame
@@ -237,6 +314,12 @@ bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 		processBlockInfo.auxInputs = processBufferInfo.auxInputs;
 		processBlockInfo.auxOutputs = processBufferInfo.auxOutputs;
 
+		// --- 64-bit host pointers (nullptr unless the host is running double precision)
+		processBlockInfo.inputs64 = processBufferInfo.inputs64;
+		processBlockInfo.outputs64 = processBufferInfo.outputs64;
+		processBlockInfo.auxInputs64 = processBufferInfo.auxInputs64;
+		processBlockInfo.auxOutputs64 = processBufferInfo.auxOutputs64;
+
 		processBlockInfo.numAudioInChannels = processBufferInfo.numAudioInChannels;
 		processBlockInfo.numAudioOutChannels = processBufferInfo.numAudioOutChannels;
 		processBlockInfo.numAuxAudioInChannels = processBufferInfo.numAuxAudioInChannels;
@@ -266,6 +349,7 @@ bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 
 			// --- do the block
 			processAudioBlock(processBlockInfo);
+			accumulateOutBoundVariables(processBlockInfo.blockSize);
 
 			// --- reset
 			processBlockInfo.blockSize = _blockSize;
@@ -283,6 +367,7 @@ bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 
 			// --- process the block
 			processAudioBlock(processBlockInfo);
+			accumulateOutBoundVariables(processBlockInfo.blockSize);
 
 			// --- reset
 			processBlockInfo.blockSize = _blockSize;
@@ -321,6 +406,40 @@ bool PluginBase::updateOutBoundVariables()
 	return updated;
 }
 
+/**
+\brief feed the meter variables into their accumulators
+
+Operation:
+- called after each frame (numSamples = 1) or block (numSamples = block size)
+- a meter variable is held for numSamples; plugins can instead feed the accumulator directly, see getMeterAccumulator( )
+
+\param numSamples number of samples since the last call
+*/
+void PluginBase::accumulateOutBoundVariables(uint32_t numSamples)
+{
+	for (unsigned int i = 0; i < numOutboundPluginParameters; i++)
+	{
+		if (outboundPluginParameters[i])
+			outboundPluginParameters[i]->accumulateOutBoundVariable(numSamples);
+	}
+}
+
+/**
+\brief get a meter parameter's accumulator; unlike getPluginParameterByControlID( ) a missing ID is not inserted into the map
+
+\param controlID the control ID of the meter parameter
+
+\return the accumulator or nullptr if controlID is not a meter parameter
+*/
+MeterAccumulator* PluginBase::getMeterAccumulator(int32_t controlID)
+{
+	pluginParameterControlIDMap::iterator it = pluginParameterMap.find(controlID);
+	if (it == pluginParameterMap.end() || !it->second)
+		return nullptr;
+
+	return it->second->getMeterAccumulator();
+}
+
 /**
 \brief combines parameter smoothing and VST3 sample accurate updates
 
@@ -328,8 +447,8 @@ NOTE:
 - beware: this function can eat a lot of CPU if the sample accurate updates trigger complex cooking functions
 - to combat CPU usage, you can set the VST3 sample granularity in initPluginDescriptors() apiSpecificInfo.vst3SampleAccurateGranularity
 - you can also change the parameter smoothing granularity
-- but in either case, the list MUST be iterated; this function is the reason for the old-fashioned C-array of pointers\n
-as it was found to be faster than any other list method for entire-list iteration (if you have a faster way, let me knmow!)
+- ASPiK smoothing only visits the parameters that are still moving: a new smoothing target puts a parameter on the
+  active list (see activateSmoothingParameters( )) and it drops off when it reaches the target
 - the parameter is updated with the smoothed value
 - the post-parameter update function is then called (complex cooking functions here will eat the CPU as well)
 */
@@ -339,15 +458,25 @@ bool PluginBase::doParameterSmoothing()
 	//                     or (b) VST3 sample accurate smoothing is not enabled
 	bool smoothed = doVST3SAAUpdates();
 
-	if (!smoothed && numSmoothingPluginParameters > 0)
+	if (numSmoothingPluginParameters == 0)
+		return smoothed;
+
+	// --- pick up new smoothing targets; usually a single relaxed load
+	activateSmoothingParameters();
+
+	if (!smoothed && numActiveSmoothingPluginParameters > 0)
 	{
 		ParameterUpdateInfo paramSmoothUpdate(true, false); /// true = this is called from smoothing operation, false = NOT VST sample accurate update
 		paramSmoothUpdate.isSmoothing = true;
 
-		for (uint32_t i = 0; i < numSmoothingPluginParameters; i++)
+		// --- a short (partial) block only moves the block rate smoothers part of a step, so the
+		//     smoothing time does not depend on the host buffer size
+		const double stepFraction = processBlockInfo.blockSize < smoothingBlockSize ? (double)processBlockInfo.blockSize / smoothingBlockSize : 1.0;
+
+		for (uint32_t i = 0; i < numActiveSmoothingPluginParameters;)
 		{
-			PluginParameter* piParam = smoothingPluginParameters[i];
-			if (piParam && piParam->smoothParameterValue())
+			PluginParameter* piParam = activeSmoothingPluginParameters[i];
+			if (piParam->smoothParameterValue(stepFraction))
 			{
 				// --- save state
 				smoothed = true; // at least one was smoothed
@@ -359,6 +488,13 @@ bool PluginBase::doParameterSmoothing()
 				}
 				// --- post update function (normally this is empty and unused)
 				postUpdatePluginParameter(piParam->getControlID(), piParam->getControlValue(), paramSmoothUpdate);
+				i++;
+			}
+			else
+			{
+				// --- reached its target: swap in the last active parameter
+				isActiveSmoothingParameter[piParam->getParameterIndex()] = false;
+				activeSmoothingPluginParameters[i] = activeSmoothingPluginParameters[--numActiveSmoothingPluginParameters];
 			}
 		}
 	}
@@ -1000,6 +1136,24 @@ void PluginBase::initPluginParameterArray()
 				outboundPluginParameters[m++] = pluginParameters[i];
 		}
 	}
+
+	// --- change tracking; every parameter starts out dirty so the first buffer syncs them all
+	dirtyParameters.resize(numPluginParameters);
+	dirtySmoothingParameters.resize(numPluginParameters);
+
+	delete[] activeSmoothingPluginParameters;
+	delete[] isActiveSmoothingParameter;
+	activeSmoothingPluginParameters = new PluginParameter*[numPluginParameters];
+	isActiveSmoothingParameter = new bool[numPluginParameters]();
+	numActiveSmoothingPluginParameters = 0;
+
+	for (unsigned int i = 0; i < numPluginParameters; i++)
+	{
+		// --- meters are outbound only
+		if (pluginParameters[i]->getControlVariableType() != controlVariableType::kMeter)
+			pluginParameters[i]->setDirtySets(&dirtyParameters, &dirtySmoothingParameters, i);
+	}
+	dirtyParameters.setAll();
 }
 
 /**
@@ -55,9 +55,14 @@ PluginCore::PluginCore()
 
 void PluginCore::updateParameters()
 {
+    // --- only cook when a bound variable has actually been updated, see postUpdatePluginParameter( )
+    if (!parametersDirty)
+        return;
+    parametersDirty = false;
+
     DigitalDelayParameters<DefaultSideChainSignalProcessorParameters> params = stereoDelay.getParameters();
-    params.leftDelay_mSec = delayTime_mSec;
-    params.rightDelay_mSec = delayTime_mSec;
+    params.leftDelay_mSec = rampedDelayTime_mSec;
+    params.rightDelay_mSec = rampedDelayTime_mSec;
 
     params.Level_dB = level_dB;
     params.mix = mix;
@@ -79,7 +84,39 @@ void PluginCore::updateParameters()
     }
 
     // ---set them
-    stereoDelay.setParameters(params);
+    delayParameters = params;
+    stereoDelay.setParameters(delayParameters);
+    appliedDelayTime_mSec = rampedDelayTime_mSec;
+}
+
+/**
+\brief move the delay time without re-cooking the rest of the delay parameters; this is called
+       per-sample while the delay time is ramping, so it must stay cheap
+
+\param delay_mSec the new delay time in mSec
+*/
+void PluginCore::updateDelayTime(double delay_mSec)
+{
+    rampedDelayTime_mSec = delay_mSec;
+    appliedDelayTime_mSec = delay_mSec;
+    delayParameters.leftDelay_mSec = delay_mSec;
+    delayParameters.rightDelay_mSec = delay_mSec;
+    stereoDelay.setParameters(delayParameters);
+}
+
+/**
+\brief follow a per-sample delay time ramp; each delay time update re-cooks the whole DigitalDelay, so the
+       ramp is only passed on once it has moved kDelayTimeResolution_Samples from the applied delay time, and
+       always when it lands on its target, so the number of updates follows the speed of the change
+
+\param delay_mSec the ramp value for this sample in mSec
+\param isTarget true when delay_mSec is the end of the ramp
+*/
+void PluginCore::rampDelayTime(double delay_mSec, bool isTarget)
+{
+    rampedDelayTime_mSec = delay_mSec;
+    if (isTarget || fabs(delay_mSec - appliedDelayTime_mSec) >= delayTimeResolution_mSec)
+        updateDelayTime(delay_mSec);
 }
 
 /**
@@ -105,6 +142,11 @@ bool PluginCore::reset(ResetInfo& resetInfo)
     // -- create 2 second delay buffers
     stereoDelay.createDelayBuffers(resetInfo.sampleRate, 2000.0);
 
+    // --- force a full cook on the next update, with the delay time at its target
+    rampedDelayTime_mSec = delayTime_mSec;
+    delayTimeResolution_mSec = kDelayTimeResolution_Samples * 1000.0 / resetInfo.sampleRate;
+    parametersDirty = true;
+
     // --- other reset inits
     return PluginBase::reset(resetInfo);
 }
@@ -224,6 +266,11 @@ bool PluginCore::processAudioFrame(ProcessFrameInfo& processFrameInfo)
     //     for the DSP algorithm at hand
     updateParameters();
 
+    // --- the delay time is ramp smoothed; step its smoother by one sample
+    double smoothedDelayTime_mSec = delayTime_mSec;
+    const uint32_t moving = delayTimeParameter->smoothParameterBlock(&smoothedDelayTime_mSec, 1);
+    if (rampedDelayTime_mSec != smoothedDelayTime_mSec)
+        rampDelayTime(smoothedDelayTime_mSec, moving == 0);
 
     // --- decode the channelIOConfiguration and process accordingly
     //
@@ -305,7 +352,7 @@ bool PluginCore::preProcessAudioBlock(IMidiEventQueue* midiEventQueue)
     //     for the DSP algorithm at hand
     //     NOTE: updating (cooking) only once per block usually SAVES CPU cycles
     //           updating (cooking) once per sample period usually EATS CPU cycles, potentially unnecessarily
-    // updateParameters();
+    updateParameters();
 
     return true;
 }
@@ -363,9 +410,54 @@ bool PluginCore::processAudioBlock(ProcessBlockInfo& processBlockInfo)
     if (getPluginType() == kSynthPlugin)
         renderSynthSilence(processBlockInfo);
 
-        // --- or FX
+    // --- or FX
     else if (getPluginType() == kFXPlugin)
-        renderFXPassThrough(processBlockInfo);
+    {
+        if (fx_On)
+        {
+            // --- the delay cross-feeds its channels, so it still consumes frames; build them
+            //     straight from the host buffers rather than going through processAudioFrame( )
+            float xn[NUM_CHANNELS] = {0.f};
+            float yn[NUM_CHANNELS] = {0.f};
+            const uint32_t numInputs = std::min(processBlockInfo.numAudioInChannels, NUM_CHANNELS);
+            const uint32_t numOutputs = std::min(processBlockInfo.numAudioOutChannels, NUM_CHANNELS);
+
+            // --- the delay time is smoothed per sample so that delay time changes stay click-free;
+            //     pull the ramp in chunks and only touch the delay while it is moving
+            const uint32_t blockEnd = processBlockInfo.blockStartIndex + processBlockInfo.blockSize;
+            for (uint32_t chunkStart = processBlockInfo.blockStartIndex; chunkStart < blockEnd; chunkStart += DEFAULT_AUDIO_BLOCK_SIZE)
+            {
+                const uint32_t chunkSize = std::min(blockEnd - chunkStart, (uint32_t)DEFAULT_AUDIO_BLOCK_SIZE);
+                const uint32_t moving = delayTimeParameter->smoothParameterBlock(delayTimeRamp_mSec, chunkSize);
+
+                for (uint32_t j = 0; j < chunkSize; j++)
+                {
+                    const uint32_t sample = chunkStart + j;
+                    if (delayTimeRamp_mSec[j] != rampedDelayTime_mSec)
+                        rampDelayTime(delayTimeRamp_mSec[j], j >= moving);
+
+                    for (uint32_t i = 0; i < numInputs; i++)
+                        xn[i] = processBlockInfo.inputs[i][sample];
+
+                    stereoDelay.processAudioFrame(xn, yn, numInputs, numOutputs);
+
+                    for (uint32_t i = 0; i < numOutputs; i++)
+                        processBlockInfo.outputs[i][sample] = yn[i];
+                }
+            }
+        }
+        else
+        {
+            // --- Bypass, for when fx_On is false; keep the smoother running but only apply where it ends,
+            //     nothing to ramp when nothing is heard
+            for (uint32_t done = 0; done < processBlockInfo.blockSize; done += DEFAULT_AUDIO_BLOCK_SIZE)
+                delayTimeParameter->smoothParameterBlock(delayTimeRamp_mSec, std::min(processBlockInfo.blockSize - done, (uint32_t)DEFAULT_AUDIO_BLOCK_SIZE));
+            if (rampedDelayTime_mSec != delayTime_mSec)
+                updateDelayTime(delayTime_mSec);
+
+            renderFXPassThrough(processBlockInfo);
+        }
+    }
 
     return true;
 }
@@ -433,8 +525,11 @@ bool PluginCore::renderFXPassThrough(ProcessBlockInfo& blockInfo)
         // --- handles multiple channels, but up to you for bookkeeping
         for (uint32_t channel = 0; channel < blockInfo.numAudioOutChannels; channel++)
         {
+            // --- a mono input feeds all of the output channels
+            const uint32_t inputChannel = channel < blockInfo.numAudioInChannels ? channel : 0;
+
             // --- pass through code, or your processed FX version
-            blockInfo.outputs[channel][sample] = blockInfo.inputs[channel][sample];
+            blockInfo.outputs[channel][sample] = blockInfo.inputs[inputChannel][sample];
         }
     }
     return true;
@@ -524,6 +619,10 @@ bool PluginCore::updatePluginParameterNormalized(int32_t controlID, double norma
 */
 bool PluginCore::postUpdatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo)
 {
+    // --- flag the parameters for cooking; the delay time is ramped separately (see updateDelayTime( ))
+    if (controlID != controlID::delayTime_mSec)
+        parametersDirty = true;
+
     // --- now do any post update cooking; be careful with VST Sample Accurate automation
     //     If enabled, then make sure the cooking functions are short and efficient otherwise disable it
     //     for the Parameter involved
@@ -698,8 +797,10 @@ bool PluginCore::initPluginParameters()
 	piParam = new PluginParameter(controlID::delayTime_mSec, "Delay", "mSec", controlVariableType::kDouble, 10.000000, 2000.000000, 250.000000, taper::kLinearTaper);
 	piParam->setParameterSmoothing(true);
 	piParam->setSmoothingTimeMsec(1500.00);
+	piParam->setRampSmoothing(true);
 	piParam->setBoundVariable(&delayTime_mSec, boundVariableType::kDouble);
 	addPluginParameter(piParam);
+	delayTimeParameter = piParam;
 
 	// --- continuous control: Feedback
 	piParam = new PluginParameter(controlID::delayFeedback_Pct, "Feedback", "%", controlVariableType::kDouble, 0.000000, 90.000000, 50.000000, taper::kLinearTaper);
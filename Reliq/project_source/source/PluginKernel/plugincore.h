@@ -151,6 +151,25 @@ protected:
     void updateParameters();
     DefaultSideChainSignalProcessor<DefaultSideChainSignalProcessorParameters> sideChainSignalProcessor;
     DigitalDelay<DefaultSideChainSignalProcessor<DefaultSideChainSignalProcessorParameters>, DefaultSideChainSignalProcessorParameters> stereoDelay{sideChainSignalProcessor};
+    DigitalDelayParameters<DefaultSideChainSignalProcessorParameters> delayParameters;
+
+    /** move the delay time without re-cooking the rest of the delay parameters */
+    void updateDelayTime(double delay_mSec);
+
+    /** step the delay time ramp; the delay is only updated once the ramp has moved far enough, or lands on its target */
+    void rampDelayTime(double delay_mSec, bool isTarget);
+
+    // --- smallest delay time change passed on to the delay while ramping; DigitalDelay (ASPiKCommon) has no
+    //     per-sample delay time setter, so each update is a full setParameters( )
+    static constexpr double kDelayTimeResolution_Samples = 0.25;
+
+    bool parametersDirty = true;        ///< set when a bound variable changes, cleared by updateParameters( )
+    double rampedDelayTime_mSec = 0.0;  ///< current value of the per-sample delay time ramp, see rampDelayTime( )
+    double appliedDelayTime_mSec = 0.0; ///< delay time last passed to the delay
+    double delayTimeResolution_mSec = 0.0; ///< kDelayTimeResolution_Samples in mSec at the current sample rate
+
+    PluginParameter* delayTimeParameter = nullptr;          ///< ramp smoothed; pulled per sample with smoothParameterBlock( )
+    double delayTimeRamp_mSec[DEFAULT_AUDIO_BLOCK_SIZE];    ///< per-sample smoothed delay times for one chunk of a block
 
 private:
     //  **--0x07FD--**
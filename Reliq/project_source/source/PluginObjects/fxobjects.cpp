@@ -29,7 +29,8 @@ and transposed canonical\n
 
 \returns the storage component of the filter
 */
-double Biquad::getS_value()
+template <typename SampleType>
+double BiquadT<SampleType>::getS_value()
 {
 	storageComponent = 0.0;
 	if (parameters.biquadCalcType == biquadAlgorithm::kDirect)
@@ -64,19 +65,22 @@ available on two of the forms: direct and transposed canonical\n
 \param xn the input sample x(n)
 \returns the biquad processed output y(n)
 */
-double Biquad::processAudioSample(double xn)
+template <typename SampleType>
+double BiquadT<SampleType>::processAudioSample(double input)
 {
+	const SampleType xn = static_cast<SampleType>(input);
+
 	if (parameters.biquadCalcType == biquadAlgorithm::kDirect)
 	{
 		// --- 1)  form output y(n) = a0*x(n) + a1*x(n-1) + a2*x(n-2) - b1*y(n-1) - b2*y(n-2)
-		double yn = coeffArray[a0] * xn + 
+		SampleType yn = coeffArray[a0] * xn + 
 					coeffArray[a1] * stateArray[x_z1] +
 					coeffArray[a2] * stateArray[x_z2] -
 					coeffArray[b1] * stateArray[y_z1] -
 					coeffArray[b2] * stateArray[y_z2];
 
 		// --- 2) underflow check
-		checkFloatUnderflow(yn);
+		checkOptionalFloatUnderflow(yn);
 
 		// --- 3) update states
 		stateArray[x_z2] = stateArray[x_z1];
@@ -93,13 +97,13 @@ double Biquad::processAudioSample(double xn)
 		// --- 1)  form output y(n) = a0*w(n) + m_f_a1*stateArray[x_z1] + m_f_a2*stateArray[x_z2][x_z2];
 		//
 		// --- w(n) = x(n) - b1*stateArray[x_z1] - b2*stateArray[x_z2]
-		double wn = xn - coeffArray[b1] * stateArray[x_z1] - coeffArray[b2] * stateArray[x_z2];
+		SampleType wn = xn - coeffArray[b1] * stateArray[x_z1] - coeffArray[b2] * stateArray[x_z2];
 
 		// --- y(n):
-		double yn = coeffArray[a0] * wn + coeffArray[a1] * stateArray[x_z1] + coeffArray[a2] * stateArray[x_z2];
+		SampleType yn = coeffArray[a0] * wn + coeffArray[a1] * stateArray[x_z1] + coeffArray[a2] * stateArray[x_z2];
 
 		// --- 2) underflow check
-		checkFloatUnderflow(yn);
+		checkOptionalFloatUnderflow(yn);
 
 		// --- 3) update states
 		stateArray[x_z2] = stateArray[x_z1];
@@ -113,13 +117,13 @@ double Biquad::processAudioSample(double xn)
 		// --- 1)  form output y(n) = a0*w(n) + stateArray[x_z1]
 		//
 		// --- w(n) = x(n) + stateArray[y_z1]
-		double wn = xn + stateArray[y_z1];
+		SampleType wn = xn + stateArray[y_z1];
 
 		// --- y(n) = a0*w(n) + stateArray[x_z1]
-		double yn = coeffArray[a0] * wn + stateArray[x_z1];
+		SampleType yn = coeffArray[a0] * wn + stateArray[x_z1];
 
 		// --- 2) underflow check
-		checkFloatUnderflow(yn);
+		checkOptionalFloatUnderflow(yn);
 
 		// --- 3) update states
 		stateArray[y_z1] = stateArray[y_z2] - coeffArray[b1] * wn;
@@ -134,10 +138,10 @@ double Biquad::processAudioSample(double xn)
 	else if (parameters.biquadCalcType == biquadAlgorithm::kTransposeCanonical)
 	{
 		// --- 1)  form output y(n) = a0*x(n) + stateArray[x_z1]
-		double yn = coeffArray[a0] * xn + stateArray[x_z1];
+		SampleType yn = coeffArray[a0] * xn + stateArray[x_z1];
 
 		// --- 2) underflow check
-		checkFloatUnderflow(yn);
+		checkOptionalFloatUnderflow(yn);
 
 		// --- shuffle/update
 		stateArray[x_z1] = coeffArray[a1]*xn - coeffArray[b1]*yn + stateArray[x_z2];
@@ -146,11 +150,137 @@ double Biquad::processAudioSample(double xn)
 		// --- return value
 		return yn;
 	}
-	return xn; // didn't process anything :(
+	return input; // didn't process anything :(
+}
+
+/**
+\brief process a block of samples through the biquad
+
+- NOTES:\n
+the algorithm switch is taken once per block and the coefficients and states are
+held in locals for the duration of the loop; the state array is written back at the end
+of the block so the results are identical to calling processAudioSample( ) per sample\n
+inputBlock and outputBlock may point to the same buffer for in-place processing\n
+
+\param inputBlock the input samples x(n)
+\param outputBlock the output samples y(n)
+\param numSamples the number of samples in the block
+\returns true if the block was processed
+*/
+template <typename SampleType>
+bool BiquadT<SampleType>::processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples)
+{
+	return processBlock(inputBlock, outputBlock, numSamples);
+}
+
+/**
+\brief process a block of 64-bit samples through the biquad; identical to the float version, without the conversions
+*/
+template <typename SampleType>
+bool BiquadT<SampleType>::processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples)
+{
+	return processBlock(inputBlock, outputBlock, numSamples);
+}
+
+template <typename SampleType>
+template <typename BlockType>
+bool BiquadT<SampleType>::processBlock(const BlockType* inputBlock, BlockType* outputBlock, uint32_t numSamples)
+{
+	const SampleType _a0 = coeffArray[a0];
+	const SampleType _a1 = coeffArray[a1];
+	const SampleType _a2 = coeffArray[a2];
+	const SampleType _b1 = coeffArray[b1];
+	const SampleType _b2 = coeffArray[b2];
+
+	SampleType xz1 = stateArray[x_z1];
+	SampleType xz2 = stateArray[x_z2];
+	SampleType yz1 = stateArray[y_z1];
+	SampleType yz2 = stateArray[y_z2];
+
+	if (parameters.biquadCalcType == biquadAlgorithm::kDirect)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			SampleType xn = inputBlock[i];
+			SampleType yn = _a0*xn + _a1*xz1 + _a2*xz2 - _b1*yz1 - _b2*yz2;
+			checkOptionalFloatUnderflow(yn);
+
+			xz2 = xz1;
+			xz1 = xn;
+			yz2 = yz1;
+			yz1 = yn;
+
+			outputBlock[i] = (BlockType)yn;
+		}
+	}
+	else if (parameters.biquadCalcType == biquadAlgorithm::kCanonical)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			SampleType wn = inputBlock[i] - _b1*xz1 - _b2*xz2;
+			SampleType yn = _a0*wn + _a1*xz1 + _a2*xz2;
+			checkOptionalFloatUnderflow(yn);
+
+			xz2 = xz1;
+			xz1 = wn;
+
+			outputBlock[i] = (BlockType)yn;
+		}
+	}
+	else if (parameters.biquadCalcType == biquadAlgorithm::kTransposeDirect)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			SampleType wn = inputBlock[i] + yz1;
+			SampleType yn = _a0*wn + xz1;
+			checkOptionalFloatUnderflow(yn);
+
+			yz1 = yz2 - _b1*wn;
+			yz2 = -_b2*wn;
+			xz1 = xz2 + _a1*wn;
+			xz2 = _a2*wn;
+
+			outputBlock[i] = (BlockType)yn;
+		}
+	}
+	else if (parameters.biquadCalcType == biquadAlgorithm::kTransposeCanonical)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			SampleType xn = inputBlock[i];
+			SampleType yn = _a0*xn + xz1;
+			checkOptionalFloatUnderflow(yn);
+
+			xz1 = _a1*xn - _b1*yn + xz2;
+			xz2 = _a2*xn - _b2*yn;
+
+			outputBlock[i] = (BlockType)yn;
+		}
+	}
+	else
+	{
+		// --- didn't process anything :(
+		if (outputBlock != inputBlock)
+			memcpy(outputBlock, inputBlock, sizeof(BlockType)*numSamples);
+		return true;
+	}
+
+	// --- write back the states
+	stateArray[x_z1] = xz1;
+	stateArray[x_z2] = xz2;
+	stateArray[y_z1] = yz1;
+	stateArray[y_z2] = yz2;
+
+	return true;
 }
 
+// --- compile the float and double versions; see the extern templates in fxobjects.h
+template class BiquadT<float>;
+template class BiquadT<double>;
+
 // --- returns true if coeffs were updated
-bool AudioFilter::calculateFilterCoeffs()
+template <typename SampleType>
+bool AudioFilterT<SampleType>::calculateFilterCoeffs()
 {
 	// --- clear coeff array
 	memset(&coeffArray[0], 0, sizeof(double)*numCoeffs);
@@ -941,7 +1071,8 @@ Here the biquad object does all of the work and we simply combine the wet and dr
 \param xn the input sample x(n)
 \returns the biquad processed output y(n)
 */
-double AudioFilter::processAudioSample(double xn)
+template <typename SampleType>
+double AudioFilterT<SampleType>::processAudioSample(double xn)
 {
 	// --- let biquad do the grunt-work
 	//
@@ -949,19 +1080,73 @@ double AudioFilter::processAudioSample(double xn)
 	return coeffArray[d0] * xn + coeffArray[c0] * biquad.processAudioSample(xn);
 }
 
+/**
+\brief process a block of samples through the audio filter
+
+- NOTES:\n
+for the common case of a pure wet filter (c0 = 1, d0 = 0) the biquad processes the
+block in its own tight loop; filters that scale the wet signal or mix in the dry signal
+(e.g. shelving filters) use a per-sample loop that calls the biquad directly\n
+inputBlock and outputBlock may point to the same buffer for in-place processing\n
+
+\param inputBlock the input samples x(n)
+\param outputBlock the output samples y(n)
+\param numSamples the number of samples in the block
+\returns true if the block was processed
+*/
+template <typename SampleType>
+bool AudioFilterT<SampleType>::processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples)
+{
+	return processBlock(inputBlock, outputBlock, numSamples);
+}
+
+/**
+\brief process a block of 64-bit samples through the filter; identical to the float version, without the conversions
+*/
+template <typename SampleType>
+bool AudioFilterT<SampleType>::processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples)
+{
+	return processBlock(inputBlock, outputBlock, numSamples);
+}
+
+template <typename SampleType>
+template <typename BlockType>
+bool AudioFilterT<SampleType>::processBlock(const BlockType* inputBlock, BlockType* outputBlock, uint32_t numSamples)
+{
+	const SampleType _c0 = static_cast<SampleType>(coeffArray[c0]);
+	const SampleType _d0 = static_cast<SampleType>(coeffArray[d0]);
+
+	// --- let biquad do the grunt-work
+	if (_c0 == 1.0 && _d0 == 0.0)
+		return biquad.processAudioBlock(inputBlock, outputBlock, numSamples);
+
+	// --- return (dry) + (processed): x(n)*d0 + y(n)*c0
+	for (uint32_t i = 0; i < numSamples; i++)
+	{
+		SampleType xn = inputBlock[i];
+		outputBlock[i] = (BlockType)(_d0 * xn + _c0 * static_cast<SampleType>(biquad.BiquadT<SampleType>::processAudioSample(xn)));
+	}
+	return true;
+}
+
+// --- compile the float and double versions; see the extern templates in fxobjects.h
+template class AudioFilterT<float>;
+template class AudioFilterT<double>;
+
 /**
 \brief sets the new attack time and re-calculates the time constant
 
 \param attack_in_ms the new attack timme
 \param forceCalc flag to force a re-calculation of time constant even if values have not changed.
 */
-void AudioDetector::setAttackTime(double attack_in_ms, bool forceCalc)
+template <typename SampleType>
+void AudioDetectorT<SampleType>::setAttackTime(double attack_in_ms, bool forceCalc)
 {
 	if (!forceCalc && audioDetectorParameters.attackTime_mSec == attack_in_ms)
 		return;
 
 	audioDetectorParameters.attackTime_mSec = attack_in_ms;
-	attackTime = exp(TLD_AUDIO_ENVELOPE_ANALOG_TC / (attack_in_ms * sampleRate * 0.001));
+	attackTime = static_cast<SampleType>(exp(TLD_AUDIO_ENVELOPE_ANALOG_TC / (attack_in_ms * sampleRate * 0.001)));
 }
 
 
@@ -971,19 +1156,25 @@ void AudioDetector::setAttackTime(double attack_in_ms, bool forceCalc)
 \param release_in_ms the new relase timme
 \param forceCalc flag to force a re-calculation of time constant even if values have not changed.
 */
-void AudioDetector::setReleaseTime(double release_in_ms, bool forceCalc)
+template <typename SampleType>
+void AudioDetectorT<SampleType>::setReleaseTime(double release_in_ms, bool forceCalc)
 {
 	if (!forceCalc && audioDetectorParameters.releaseTime_mSec == release_in_ms)
 		return;
 
 	audioDetectorParameters.releaseTime_mSec = release_in_ms;
-	releaseTime = exp(TLD_AUDIO_ENVELOPE_ANALOG_TC / (release_in_ms * sampleRate * 0.001));
+	releaseTime = static_cast<SampleType>(exp(TLD_AUDIO_ENVELOPE_ANALOG_TC / (release_in_ms * sampleRate * 0.001)));
 }
 
+// --- compile the float and double versions; see the extern templates in fxobjects.h
+template class AudioDetectorT<float>;
+template class AudioDetectorT<double>;
+
 /**
 \brief generates the oscillator output for one sample interval; note that there are multiple outputs.
 */
-const SignalGenData LFO::renderAudioOutput()
+template <typename SampleType>
+const SignalGenData LFOT<SampleType>::renderAudioOutput()
 {
 	// --- always first!
 	checkAndWrapModulo(modCounter, phaseInc);
@@ -1001,13 +1192,13 @@ const SignalGenData LFO::renderAudioOutput()
 	if (waveform == generatorWaveform::kSin)
 	{
 		// --- calculate normal angle
-		double angle = modCounter*2.0*kPi - kPi;
+		SampleType angle = static_cast<SampleType>(modCounter*2.0*kPi - kPi);
 
 		// --- norm output with parabolicSine approximation
 		output.normalOutput = parabolicSine(-angle);
 
 		// --- calculate QP angle
-		angle = modCounterQP*2.0*kPi - kPi;
+		angle = static_cast<SampleType>(modCounterQP*2.0*kPi - kPi);
 
 		// --- calc QP output
 		output.quadPhaseOutput_pos = parabolicSine(-angle);
@@ -1042,6 +1233,23 @@ const SignalGenData LFO::renderAudioOutput()
 	return output;
 }
 
+/**
+\brief generates the oscillator outputs for a block of sample intervals
+
+\param outputBlock the output structures, one per sample interval
+\param numSamples the number of sample intervals to render
+*/
+template <typename SampleType>
+void LFOT<SampleType>::renderAudioBlock(SignalGenData* outputBlock, uint32_t numSamples)
+{
+	for (uint32_t i = 0; i < numSamples; i++)
+		outputBlock[i] = LFOT::renderAudioOutput();
+}
+
+// --- compile the float and double versions; see the extern templates in fxobjects.h
+template class LFOT<float>;
+template class LFOT<double>;
+
 
 #ifdef HAVE_FFTW
 
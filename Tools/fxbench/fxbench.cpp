@@ -0,0 +1,1470 @@
+// -----------------------------------------------------------------------------
+//    fxbench.cpp
+//
+/**
+    \file   fxbench.cpp
+    \author Steve Dwyer
+    \brief  micro-benchmarks for the FX objects; reports the processing cost
+    		in nanoseconds per sample for each object at 44.1, 96 and 192kHz,
+    		with static parameters and with parameters modulated every block;
+    		the "tail" cases time decaying feedback with ("flushed") and without
+    		("denormal") flush-to-zero/denormals-are-zero
+
+    		usage: fxbench [options]
+    		  --rate <Hz>          run one sample rate instead of 44.1/96/192kHz
+    		  --filter <text>      only run cases whose name contains text
+    		  --length <sec>       length of the test signal (default 1.0)
+    		  --output <file>      write the results as CSV
+    		  --baseline <file>    compare against a CSV written by --output;
+    		                       exits with 2 when a case is slower than the
+    		                       baseline by more than the tolerance
+    		  --tolerance <pct>    regression tolerance in percent (default 10)
+
+    		the Phaser control rate check always runs as part of the regression gate;
+    		fxbench also exits with 2 when a control rate Phaser output strays from
+    		the per-sample LFO output by more than -100 dB
+    		the fast math check always runs; fxbench exits with 3 when fastDB2Raw( )
+    		or fastRaw2dB( ) is off by more than 0.01 dB
+    		the BiquadBank check always runs; fxbench exits with 4 when a bank lane
+    		is not bit-exact with the equivalent AudioFilter
+    		the sidechain check always runs; fxbench exits with 5 when the
+    		DynamicsProcessor block aux input path is not bit-exact with the
+    		per-sample processAuxInputAudioSample( ) handshake
+    		the PSMVocoder pitch check runs in FFTW builds; fxbench exits with 6
+    		when a pitch shifted sine is off pitch by more than 1 cent
+
+    		CSV format: name,sample_rate,mode,ns_per_sample
+*/
+// -----------------------------------------------------------------------------
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "customfxobjects.h"
+
+namespace
+{
+	// --- host-like buffer size; modulated cases change parameters once per block
+	const uint32_t kBlockSize = 64;
+
+	// --- each case is run this many times and the fastest run is reported
+	const uint32_t kRepeats = 5;
+
+	// --- blocks per modulation cycle (about 0.37 sec at 44.1kHz)
+	const uint32_t kModulationPeriod_Blocks = 256;
+
+	/** test signal: a slow sine sweep with a little noise so no path is trivially predictable */
+	std::vector<float> makeTestSignal(uint32_t numSamples, double sampleRate)
+	{
+		std::vector<float> signal(numSamples);
+		double phase = 0.0;
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			const double freq = 100.0 + 4900.0 * i / numSamples;
+			phase += kTwoPi * freq / sampleRate;
+			signal[i] = static_cast<float>(0.5 * sin(phase) + 0.01 * doWhiteNoise());
+		}
+		return signal;
+	}
+
+	/** run one benchmark case; processBlock is called with consecutive kBlockSize blocks of the test signal */
+	double measure(const std::vector<float>& input, const std::function<void(const float*, float*, uint32_t)>& processBlock)
+	{
+		std::vector<float> output(input.size());
+		const uint32_t numSamples = static_cast<uint32_t>(input.size());
+
+		double best_nSec = 0.0;
+		for (uint32_t r = 0; r < kRepeats; r++)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < numSamples; i += kBlockSize)
+				processBlock(&input[i], &output[i], std::min(kBlockSize, numSamples - i));
+			const auto end = std::chrono::steady_clock::now();
+
+			const double nSec = std::chrono::duration<double, std::nano>(end - start).count();
+			if (r == 0 || nSec < best_nSec)
+				best_nSec = nSec;
+		}
+
+		return best_nSec / numSamples;
+	}
+
+	/** modulation position for a block: a raised cosine running 0 -> 1 -> 0 over kModulationPeriod_Blocks */
+	double modulationPosition(uint32_t block)
+	{
+		return 0.5 - 0.5 * cos(kTwoPi * (block % kModulationPeriod_Blocks) / kModulationPeriod_Blocks);
+	}
+
+	/** one measurement */
+	struct BenchmarkResult
+	{
+		std::string name;
+		double sampleRate = 0.0;
+		std::string mode;
+		double nSecPerSample = 0.0;
+	};
+
+	/** results key: name, rate and mode */
+	std::string resultKey(const std::string& name, double sampleRate, const std::string& mode)
+	{
+		char rate[32];
+		snprintf(rate, sizeof(rate), "%.0f", sampleRate);
+		return name + "|" + rate + "|" + mode;
+	}
+
+	/**
+	\class Benchmark
+	\brief
+	Runs the cases: holds the sample rates, the name filter, a test signal per rate and the results.
+	*/
+	class Benchmark
+	{
+	public:
+		std::vector<double> sampleRates = { 44100.0, 96000.0, 192000.0 };	///< rates to run
+		std::string nameFilter;			///< only run cases containing this text
+		double runLength_Sec = 1.0;		///< test signal length
+		std::vector<BenchmarkResult> results;	///< all measurements in run order
+
+		/** true if the case should run */
+		bool wants(const std::string& name) const
+		{
+			return nameFilter.empty() || name.find(nameFilter) != std::string::npos;
+		}
+
+		/** the test signal for a rate; generated once and cached */
+		const std::vector<float>& getTestSignal(double sampleRate)
+		{
+			std::vector<float>& signal = testSignals[sampleRate];
+			if (signal.empty())
+				signal = makeTestSignal(static_cast<uint32_t>(runLength_Sec * sampleRate), sampleRate);
+			return signal;
+		}
+
+		/** measure one case and record it; mode is "static" or "modulated" */
+		void run(const std::string& name, double sampleRate, const std::string& mode,
+				 const std::function<void(const float*, float*, uint32_t)>& processBlock, double divisor = 1.0)
+		{
+			if (!wants(name)) return;
+			record(name, sampleRate, mode, measure(getTestSignal(sampleRate), processBlock) / divisor);
+		}
+
+		/** record a measurement and print it */
+		void record(const std::string& name, double sampleRate, const std::string& mode, double nSecPerSample)
+		{
+			BenchmarkResult result;
+			result.name = name;
+			result.sampleRate = sampleRate;
+			result.mode = mode;
+			result.nSecPerSample = nSecPerSample;
+			results.push_back(result);
+
+			printf("%-40s %7.1fk  %-10s %10.2f ns/sample\n", name.c_str(), sampleRate / 1000.0, mode.c_str(), nSecPerSample);
+		}
+
+	protected:
+		std::map<double, std::vector<float>> testSignals;	///< test signal per rate
+	};
+
+	/**
+	\brief
+	Benchmark an IAudioSignalProcessor at every rate with static parameters and, when
+	modulate is supplied, with modulate called before every block.
+
+	\param setup prepares a fresh object for the sample rate
+	\param modulate changes the parameters for a modulation position between 0 and 1
+	*/
+	template <class T>
+	void benchmarkProcessor(Benchmark& bench, const std::string& name,
+							const std::function<void(T&, double)>& setup,
+							const std::function<void(T&, double)>& modulate = nullptr)
+	{
+		if (!bench.wants(name)) return;
+
+		for (const double sampleRate : bench.sampleRates)
+		{
+			// --- heap allocated; some objects hold large arrays
+			std::unique_ptr<T> object(new T);
+			setup(*object, sampleRate);
+			bench.run(name, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+			{
+				object->processAudioBlock(in, out, n);
+			});
+
+			if (!modulate) continue;
+
+			object.reset(new T);
+			setup(*object, sampleRate);
+			uint32_t block = 0;
+			bench.run(name, sampleRate, "modulated", [&](const float* in, float* out, uint32_t n)
+			{
+				modulate(*object, modulationPosition(block++));
+				object->processAudioBlock(in, out, n);
+			});
+		}
+	}
+
+	/** fc sweep used by the modulated filter cases */
+	double modulatedFc(double position)
+	{
+		return 200.0 * pow(25.0, position);	// --- 200Hz to 5kHz, exponential
+	}
+
+	/** AudioFilter: every algorithm */
+	void benchmarkAudioFilter(Benchmark& bench)
+	{
+		const char* algorithmNames[] = {
+			"kLPF1P", "kLPF1", "kHPF1", "kLPF2", "kHPF2", "kBPF2", "kBSF2", "kButterLPF2", "kButterHPF2", "kButterBPF2",
+			"kButterBSF2", "kMMALPF2", "kMMALPF2B", "kLowShelf", "kHiShelf", "kNCQParaEQ", "kCQParaEQ", "kLWRLPF2", "kLWRHPF2",
+			"kAPF1", "kAPF2", "kResonA", "kResonB", "kMatchLP2A", "kMatchLP2B", "kMatchBP2A", "kMatchBP2B",
+			"kImpInvLP1", "kImpInvLP2" };
+		const unsigned int numAlgorithms = sizeof(algorithmNames) / sizeof(algorithmNames[0]);
+
+		for (unsigned int i = 0; i < numAlgorithms; i++)
+		{
+			const filterAlgorithm algorithm = static_cast<filterAlgorithm>(i);
+			benchmarkProcessor<AudioFilter>(bench, std::string("AudioFilter ") + algorithmNames[i],
+				[algorithm](AudioFilter& filter, double sampleRate)
+				{
+					filter.reset(sampleRate);
+					AudioFilterParameters params = filter.getParameters();
+					params.algorithm = algorithm;
+					params.fc = 1000.0;
+					params.Q = 2.0;
+					params.boostCut_dB = 6.0;
+					filter.setParameters(params);
+				},
+				[](AudioFilter& filter, double position)
+				{
+					AudioFilterParameters params = filter.getParameters();
+					params.fc = modulatedFc(position);
+					filter.setParameters(params);
+				});
+		}
+	}
+
+	/** ZVAFilter */
+	void benchmarkZVAFilter(Benchmark& bench)
+	{
+		benchmarkProcessor<ZVAFilter>(bench, "ZVAFilter kSVF_LP",
+			[](ZVAFilter& filter, double sampleRate)
+			{
+				filter.reset(sampleRate);
+				ZVAFilterParameters params = filter.getParameters();
+				params.filterAlgorithm = vaFilterAlgorithm::kSVF_LP;
+				params.fc = 1000.0;
+				params.Q = 4.0;
+				filter.setParameters(params);
+			},
+			[](ZVAFilter& filter, double position)
+			{
+				ZVAFilterParameters params = filter.getParameters();
+				params.fc = modulatedFc(position);
+				filter.setParameters(params);
+			});
+	}
+
+	/** delays and reverb */
+	void benchmarkDelays(Benchmark& bench)
+	{
+		benchmarkProcessor<AudioDelay>(bench, "AudioDelay",
+			[](AudioDelay& delay, double sampleRate)
+			{
+				delay.reset(sampleRate);
+				delay.createDelayBuffers(sampleRate, 2000.0);
+				AudioDelayParameters params = delay.getParameters();
+				params.leftDelay_mSec = 250.0;
+				params.rightDelay_mSec = 250.0;
+				params.feedback_Pct = 50.0;
+				delay.setParameters(params);
+			},
+			[](AudioDelay& delay, double position)
+			{
+				AudioDelayParameters params = delay.getParameters();
+				params.leftDelay_mSec = 100.0 + 300.0 * position;
+				params.rightDelay_mSec = params.leftDelay_mSec;
+				delay.setParameters(params);
+			});
+
+		benchmarkProcessor<ModulatedDelay>(bench, "ModulatedDelay kChorus",
+			[](ModulatedDelay& delay, double sampleRate)
+			{
+				delay.reset(sampleRate);
+				ModulatedDelayParameters params = delay.getParameters();
+				params.algorithm = modDelaylgorithm::kChorus;
+				params.lfoRate_Hz = 0.5;
+				params.lfoDepth_Pct = 50.0;
+				delay.setParameters(params);
+			},
+			[](ModulatedDelay& delay, double position)
+			{
+				ModulatedDelayParameters params = delay.getParameters();
+				params.lfoRate_Hz = 0.1 + 4.9 * position;
+				delay.setParameters(params);
+			});
+
+		benchmarkProcessor<ReverbTank>(bench, "ReverbTank",
+			[](ReverbTank& reverb, double sampleRate)
+			{
+				reverb.reset(sampleRate);
+				ReverbTankParameters params = reverb.getParameters();
+				params.kRT = 0.7;
+				params.lpf_g = 0.3;
+				params.lowShelf_fc = 150.0;
+				params.highShelf_fc = 4000.0;
+				params.wetLevel_dB = -12.0;
+				params.dryLevel_dB = 0.0;
+				reverb.setParameters(params);
+			},
+			[](ReverbTank& reverb, double position)
+			{
+				ReverbTankParameters params = reverb.getParameters();
+				params.kRT = 0.5 + 0.4 * position;
+				reverb.setParameters(params);
+			});
+	}
+
+	/**
+	\brief
+	Decaying tails: the object is primed with a burst so small that its feedback state is already in the
+	denormal range (where a real tail ends up after it has decayed far enough), then silence is timed with
+	and without a DenormalGuard, as PluginBase runs processAudioBuffers( ). The "denormal" mode is only
+	slow when FXOBJECTS_CHECK_UNDERFLOW is 0, since the per-sample checks flush the state otherwise.
+	*/
+	template <class T>
+	void benchmarkDenormalTail(Benchmark& bench, const std::string& name, const std::function<void(T&, double)>& setup)
+	{
+		if (!bench.wants(name)) return;
+
+		for (const double sampleRate : bench.sampleRates)
+		{
+			const std::vector<float>& signal = bench.getTestSignal(sampleRate);
+			const std::vector<float> silence(signal.size(), 0.0f);
+
+			for (const bool flushDenormals : { false, true })
+			{
+				std::unique_ptr<T> object(new T);
+				setup(*object, sampleRate);
+
+				// --- prime: 1e-310 is below the smallest normal double (2.2e-308); float I/O cannot carry it
+				const uint32_t primeLength = static_cast<uint32_t>(0.1 * sampleRate);
+				for (uint32_t i = 0; i < primeLength; i++)
+					object->processAudioSample(1.0e-310 * signal[i] * 2.0);
+
+				std::unique_ptr<DenormalGuard> guard(flushDenormals ? new DenormalGuard : nullptr);
+				bench.record(name, sampleRate, flushDenormals ? "flushed" : "denormal", measure(silence, [&](const float* in, float* out, uint32_t n)
+				{
+					object->processAudioBlock(in, out, n);
+				}));
+			}
+		}
+	}
+
+	/** reverb and delay feedback tails, with and without flush-to-zero/denormals-are-zero */
+	void benchmarkDenormalTails(Benchmark& bench)
+	{
+		benchmarkDenormalTail<AudioDelay>(bench, "AudioDelay tail",
+			[](AudioDelay& delay, double sampleRate)
+			{
+				delay.reset(sampleRate);
+				delay.createDelayBuffers(sampleRate, 2000.0);
+				AudioDelayParameters params = delay.getParameters();
+				params.leftDelay_mSec = 250.0;
+				params.rightDelay_mSec = 250.0;
+				params.feedback_Pct = 90.0;
+				delay.setParameters(params);
+			});
+
+		benchmarkDenormalTail<ReverbTank>(bench, "ReverbTank tail",
+			[](ReverbTank& reverb, double sampleRate)
+			{
+				reverb.reset(sampleRate);
+				ReverbTankParameters params = reverb.getParameters();
+				params.kRT = 0.9;
+				params.lpf_g = 0.3;
+				params.lowShelf_fc = 150.0;
+				params.highShelf_fc = 4000.0;
+				params.wetLevel_dB = -12.0;
+				params.dryLevel_dB = 0.0;
+				reverb.setParameters(params);
+			});
+	}
+
+	/** Phaser setup shared by the timing cases and the per-sample LFO comparison */
+	void setupPhaser(Phaser& phaser, double sampleRate, uint32_t controlRateInterval)
+	{
+		phaser.reset(sampleRate);
+		PhaserParameters params = phaser.getParameters();
+		params.lfoRate_Hz = 0.5;
+		params.lfoDepth_Pct = 80.0;
+		params.intensity_Pct = 75.0;
+		params.controlRateInterval = controlRateInterval;
+		phaser.setParameters(params);
+	}
+
+	// --- the Phaser with a control rate interval of 1 runs the LFO and recalculates the APF coefficients
+	//     every sample, as it did before the control rate was added; it is the reference for the others
+	const uint32_t kPhaserIntervals[] = { 1, 8, 16, 32 };
+
+	// --- largest difference allowed between the control rate Phaser output and its per-sample LFO output
+	const double kPhaserControlRate_dBTolerance = -100.0;
+
+	/** phasers; the Phaser control rate cases are timed against its per-sample LFO path */
+	void benchmarkPhasers(Benchmark& bench)
+	{
+		benchmarkProcessor<PhaseShifter>(bench, "PhaseShifter",
+			[](PhaseShifter& phaseShifter, double sampleRate)
+			{
+				phaseShifter.reset(sampleRate);
+				PhaseShifterParameters params = phaseShifter.getParameters();
+				params.lfoRate_Hz = 0.5;
+				params.lfoDepth_Pct = 80.0;
+				params.intensity_Pct = 75.0;
+				phaseShifter.setParameters(params);
+			},
+			[](PhaseShifter& phaseShifter, double position)
+			{
+				PhaseShifterParameters params = phaseShifter.getParameters();
+				params.lfoRate_Hz = 0.1 + 4.9 * position;
+				phaseShifter.setParameters(params);
+			});
+
+		for (const uint32_t interval : kPhaserIntervals)
+		{
+			const std::string name = interval == 1 ? std::string("Phaser (per-sample LFO)") : "Phaser (control rate " + std::to_string(interval) + ")";
+			benchmarkProcessor<Phaser>(bench, name,
+				[interval](Phaser& phaser, double sampleRate) { setupPhaser(phaser, sampleRate, interval); },
+				[](Phaser& phaser, double position)
+				{
+					PhaserParameters params = phaser.getParameters();
+					params.lfoRate_Hz = 0.1 + 4.9 * position;
+					phaser.setParameters(params);
+				});
+		}
+
+		benchmarkProcessor<AutoQEnvelopeFollower>(bench, "AutoQEnvelopeFollower",
+			[](AutoQEnvelopeFollower& follower, double sampleRate)
+			{
+				follower.reset(sampleRate);
+				AutoQEnvelopeFollowerParameters params = follower.getParameters();
+				params.fc = 500.0;
+				params.Q = 5.0;
+				params.attackTime_mSec = 10.0;
+				params.releaseTime_mSec = 100.0;
+				params.threshold_dB = -20.0;
+				params.sensitivity = 2.0;
+				follower.setParameters(params);
+			},
+			[](AutoQEnvelopeFollower& follower, double position)
+			{
+				AutoQEnvelopeFollowerParameters params = follower.getParameters();
+				params.fc = modulatedFc(position);
+				follower.setParameters(params);
+			});
+	}
+
+	/**
+	\brief
+	Phaser control rate accuracy: runs the Phaser at each control rate interval and compares it with the
+	per-sample LFO output (interval 1). This is part of the regression gate: returns false when any interval
+	strays by more than kPhaserControlRate_dBTolerance, which main( ) reports with exit code 2.
+	*/
+	bool checkPhaserControlRate(Benchmark& bench)
+	{
+		const double sampleRate = bench.sampleRates[0];
+		const std::vector<float>& input = bench.getTestSignal(sampleRate);
+		std::vector<float> reference(input.size());
+		std::vector<float> output(input.size());
+
+		std::unique_ptr<Phaser> perSample(new Phaser);
+		setupPhaser(*perSample, sampleRate, 1);
+		perSample->processAudioBlock(&input[0], &reference[0], static_cast<uint32_t>(input.size()));
+
+		bool accurate = true;
+		for (const uint32_t interval : kPhaserIntervals)
+		{
+			if (interval == 1) continue;
+			std::unique_ptr<Phaser> controlRate(new Phaser);
+			setupPhaser(*controlRate, sampleRate, interval);
+			controlRate->processAudioBlock(&input[0], &output[0], static_cast<uint32_t>(output.size()));
+
+			double maxError = 0.0;
+			for (size_t i = 0; i < output.size(); i++)
+				maxError = std::max(maxError, fabs(static_cast<double>(output[i]) - reference[i]));
+
+			const double maxError_dB = raw2dB(maxError + 1.0e-12);
+			printf("Phaser (control rate %u): max difference from the per-sample LFO %.2e (%.1f dB, tolerance %.0f dB)\n",
+				   interval, maxError, maxError_dB, kPhaserControlRate_dBTolerance);
+			accurate = accurate && maxError_dB <= kPhaserControlRate_dBTolerance;
+		}
+		return accurate;
+	}
+
+	/** tube models */
+	void benchmarkTubes(Benchmark& bench)
+	{
+		benchmarkProcessor<TriodeClassA>(bench, "TriodeClassA",
+			[](TriodeClassA& triode, double sampleRate)
+			{
+				triode.reset(sampleRate);
+				TriodeClassAParameters params = triode.getParameters();
+				params.saturation = 2.0;
+				params.asymmetry = 0.5;
+				params.enableLSF = true;
+				triode.setParameters(params);
+			},
+			[](TriodeClassA& triode, double position)
+			{
+				TriodeClassAParameters params = triode.getParameters();
+				params.saturation = 1.0 + 4.0 * position;
+				triode.setParameters(params);
+			});
+
+		benchmarkProcessor<ClassATubePre>(bench, "ClassATubePre",
+			[](ClassATubePre& preamp, double sampleRate)
+			{
+				preamp.reset(sampleRate);
+				ClassATubePreParameters params = preamp.getParameters();
+				params.saturation = 3.0;
+				params.lowShelf_fc = 150.0;
+				params.highShelf_fc = 4000.0;
+				params.lowShelfBoostCut_dB = 3.0;
+				params.highShelfBoostCut_dB = -3.0;
+				preamp.setParameters(params);
+			},
+			[](ClassATubePre& preamp, double position)
+			{
+				ClassATubePreParameters params = preamp.getParameters();
+				params.saturation = 1.0 + 4.0 * position;
+				preamp.setParameters(params);
+			});
+	}
+
+	/** the objects with a useFastMath switch, run with the switch in both positions */
+	void benchmarkFastMathObjects(Benchmark& bench, bool useFastMath)
+	{
+		const std::string suffix = useFastMath ? " (fast math)" : " (exact math)";
+
+		benchmarkProcessor<DynamicsProcessor>(bench, "DynamicsProcessor" + suffix,
+			[useFastMath](DynamicsProcessor& compressor, double sampleRate)
+			{
+				compressor.reset(sampleRate);
+				DynamicsProcessorParameters params = compressor.getParameters();
+				params.ratio = 4.0;
+				params.threshold_dB = -20.0;
+				params.attackTime_mSec = 5.0;
+				params.releaseTime_mSec = 50.0;
+				params.outputGain_dB = 6.0;
+				params.useFastMath = useFastMath;
+				compressor.setParameters(params);
+			},
+			[](DynamicsProcessor& compressor, double position)
+			{
+				DynamicsProcessorParameters params = compressor.getParameters();
+				params.threshold_dB = -30.0 + 20.0 * position;
+				compressor.setParameters(params);
+			});
+
+		benchmarkProcessor<PeakLimiter>(bench, "PeakLimiter" + suffix,
+			[useFastMath](PeakLimiter& limiter, double sampleRate)
+			{
+				limiter.reset(sampleRate);
+				limiter.setThreshold_dB(-12.0);
+				limiter.setMakeUpGain_dB(6.0);
+				limiter.setUseFastMath(useFastMath);
+			});
+
+		benchmarkProcessor<EnvelopeFollower>(bench, "EnvelopeFollower" + suffix,
+			[useFastMath](EnvelopeFollower& follower, double sampleRate)
+			{
+				follower.reset(sampleRate);
+				EnvelopeFollowerParameters params = follower.getParameters();
+				params.fc = 500.0;
+				params.Q = 5.0;
+				params.attackTime_mSec = 10.0;
+				params.releaseTime_mSec = 100.0;
+				params.threshold_dB = -20.0;
+				params.sensitivity = 2.0;
+				params.useFastMath = useFastMath;
+				follower.setParameters(params);
+			});
+
+		benchmarkProcessor<AutoQEnvelopeFollower>(bench, "AutoQEnvelopeFollower" + suffix,
+			[useFastMath](AutoQEnvelopeFollower& follower, double sampleRate)
+			{
+				follower.reset(sampleRate);
+				AutoQEnvelopeFollowerParameters params = follower.getParameters();
+				params.fc = 500.0;
+				params.Q = 5.0;
+				params.threshold_dB = -20.0;
+				params.sensitivity = 2.0;
+				params.useFastMath = useFastMath;
+				follower.setParameters(params);
+			});
+
+		benchmarkProcessor<TriodeClassA>(bench, "TriodeClassA kArcTan" + suffix,
+			[useFastMath](TriodeClassA& triode, double sampleRate)
+			{
+				triode.reset(sampleRate);
+				TriodeClassAParameters params = triode.getParameters();
+				params.waveshaper = distortionModel::kArcTan;
+				params.saturation = 2.0;
+				params.useFastMath = useFastMath;
+				triode.setParameters(params);
+			});
+	}
+
+	/** DynamicsProcessor sidechain: the per-sample processAuxInputAudioSample( ) handshake versus the block aux input API */
+	void benchmarkSidechain(Benchmark& bench)
+	{
+		const std::string name = "DynamicsProcessor sidechain";
+		for (const double sampleRate : bench.sampleRates)
+		{
+			DynamicsProcessor compressor;
+			compressor.reset(sampleRate);
+			DynamicsProcessorParameters params = compressor.getParameters();
+			params.ratio = 4.0;
+			params.threshold_dB = -20.0;
+			params.attackTime_mSec = 5.0;
+			params.releaseTime_mSec = 50.0;
+			params.enableSidechain = true;
+			compressor.setParameters(params);
+
+			// --- the test signal is its own key so every mode does the same work
+			bench.run(name, sampleRate, "per sample", [&](const float* in, float* out, uint32_t n)
+			{
+				for (uint32_t i = 0; i < n; i++)
+				{
+					compressor.processAuxInputAudioSample(in[i]);
+					out[i] = static_cast<float>(compressor.processAudioSample(in[i]));
+				}
+			});
+
+			bench.run(name, sampleRate, "block aux", [&](const float* in, float* out, uint32_t n)
+			{
+				compressor.processAudioBlock(in, out, n, &in, 1);
+			});
+
+			params.lookAhead_mSec = 5.0;
+			compressor.setParameters(params);
+			bench.run(name, sampleRate, "aux look-ahead", [&](const float* in, float* out, uint32_t n)
+			{
+				compressor.processAudioBlock(in, out, n, &in, 1);
+			});
+		}
+	}
+
+	/**
+	\brief
+	DynamicsProcessor sidechain equivalence: keys one compressor per sample through processAuxInputAudioSample( )
+	and another with the block aux input API, for 1 and 2 aux channels, with and without look-ahead; the key
+	differs from the main input and each block starts part way into the aux buffers (sidechainStartIndex). Two
+	aux channels are averaged, so the per-sample key is averaged the same way. Returns false on any difference,
+	which main( ) reports with exit code 5.
+	*/
+	bool checkSidechain(Benchmark& bench)
+	{
+		const double sampleRate = bench.sampleRates[0];
+		const std::vector<float>& signal = bench.getTestSignal(sampleRate);
+		const uint32_t numSamples = static_cast<uint32_t>(signal.size());
+
+		// --- two keys that differ from the main input and from each other
+		std::vector<float> keys[2];
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			keys[channel].resize(numSamples);
+			for (uint32_t i = 0; i < numSamples; i++)
+				keys[channel][i] = signal[numSamples - 1 - i] * (channel == 0 ? 1.5f : 0.25f);
+		}
+		const float* keyInputs[2] = { &keys[0][0], &keys[1][0] };
+
+		bool exact = true;
+		for (uint32_t numKeyChannels = 1; numKeyChannels <= 2; numKeyChannels++)
+		{
+			for (const double lookAhead_mSec : { 0.0, 5.0 })
+			{
+				DynamicsProcessor perSample;
+				DynamicsProcessor block;
+				for (DynamicsProcessor* compressor : { &perSample, &block })
+				{
+					compressor->reset(sampleRate);
+					DynamicsProcessorParameters params = compressor->getParameters();
+					params.ratio = 4.0;
+					params.threshold_dB = -20.0;
+					params.attackTime_mSec = 5.0;
+					params.releaseTime_mSec = 50.0;
+					params.lookAhead_mSec = lookAhead_mSec;
+					params.enableSidechain = true;
+					compressor->setParameters(params);
+				}
+
+				std::vector<float> perSampleOutput(numSamples);
+				const double keyScale = 1.0 / numKeyChannels;
+				for (uint32_t i = 0; i < numSamples; i++)
+				{
+					double key = keys[0][i];
+					for (uint32_t channel = 1; channel < numKeyChannels; channel++)
+						key += keys[channel][i];
+					perSample.processAuxInputAudioSample(key * keyScale);
+					perSampleOutput[i] = static_cast<float>(perSample.processAudioSample(signal[i]));
+				}
+
+				std::vector<float> blockOutput(numSamples);
+				for (uint32_t start = 0; start < numSamples; start += kBlockSize)
+				{
+					const uint32_t count = std::min(kBlockSize, numSamples - start);
+					block.processAudioBlock(&signal[start], &blockOutput[start], count, keyInputs, numKeyChannels, start);
+				}
+
+				uint32_t mismatches = 0;
+				for (uint32_t i = 0; i < numSamples; i++)
+					if (blockOutput[i] != perSampleOutput[i])
+						mismatches++;
+
+				printf("DynamicsProcessor sidechain, %u aux channel%s%s: %u block samples differ from per sample (must be 0)\n",
+					   numKeyChannels, numKeyChannels > 1 ? "s" : "", lookAhead_mSec > 0.0 ? ", look-ahead" : "", mismatches);
+				exact = exact && mismatches == 0;
+			}
+		}
+		return exact;
+	}
+
+	// --- largest error allowed for fastDB2Raw( ) and fastRaw2dB( )
+	const double kFastMath_dBTolerance = 0.01;
+
+	/**
+	\brief
+	Fast math: measures the error of each fast function against its <math.h> version over its working range
+	and prints it next to the documented bound; returns false if a dB conversion is off by more than
+	kFastMath_dBTolerance, which main( ) reports with exit code 3. Then times both versions of each
+	function and of the objects that use them.
+	*/
+	bool checkFastMath(Benchmark& bench)
+	{
+		double dB2RawError_dB = 0.0;
+		for (double dB = -200.0; dB <= 200.0; dB += 0.0007)
+			dB2RawError_dB = std::max(dB2RawError_dB, fabs(raw2dB(fastDB2Raw(dB) / dB2Raw(dB))));
+
+		double raw2dBError_dB = 0.0;
+		for (double dB = -200.0; dB <= 200.0; dB += 0.0007)
+		{
+			const double raw = dB2Raw(dB);
+			raw2dBError_dB = std::max(raw2dBError_dB, fabs(fastRaw2dB(raw) - raw2dB(raw)));
+		}
+
+		double tanhError = 0.0;
+		double atanError = 0.0;
+		for (double x = -20.0; x <= 20.0; x += 0.00013)
+		{
+			tanhError = std::max(tanhError, fabs(fastTanh(x) - tanh(x)));
+			atanError = std::max(atanError, fabs(fastAtan(x) - atan(x)));
+		}
+
+		printf("fast math: dB2Raw %.2e dB, raw2dB %.2e dB (tolerance %.2f dB); tanh %.2e, atan %.2e\n",
+			   dB2RawError_dB, raw2dBError_dB, kFastMath_dBTolerance, tanhError, atanError);
+
+		// --- the conversions alone, on the test signal
+		for (const double sampleRate : bench.sampleRates)
+		{
+			bench.run("raw2dB", sampleRate, "exact", [](const float* in, float* out, uint32_t n)
+			{
+				for (uint32_t i = 0; i < n; i++)
+					out[i] = static_cast<float>(raw2dB(fabs(in[i]) + 1.0e-6));
+			});
+			bench.run("raw2dB", sampleRate, "fast", [](const float* in, float* out, uint32_t n)
+			{
+				for (uint32_t i = 0; i < n; i++)
+					out[i] = static_cast<float>(fastRaw2dB(fabs(in[i]) + 1.0e-6));
+			});
+			bench.run("dB2Raw", sampleRate, "exact", [](const float* in, float* out, uint32_t n)
+			{
+				for (uint32_t i = 0; i < n; i++)
+					out[i] = static_cast<float>(dB2Raw(60.0 * in[i]));
+			});
+			bench.run("dB2Raw", sampleRate, "fast", [](const float* in, float* out, uint32_t n)
+			{
+				for (uint32_t i = 0; i < n; i++)
+					out[i] = static_cast<float>(fastDB2Raw(60.0 * in[i]));
+			});
+		}
+
+		benchmarkFastMathObjects(bench, false);
+		benchmarkFastMathObjects(bench, true);
+
+		return dB2RawError_dB <= kFastMath_dBTolerance && raw2dBError_dB <= kFastMath_dBTolerance;
+	}
+
+	/** WDF ideal RLC filters share a parameter interface */
+	template <class T>
+	void benchmarkWDFIdealRLC(Benchmark& bench, const std::string& name)
+	{
+		benchmarkProcessor<T>(bench, name,
+			[](T& filter, double sampleRate)
+			{
+				filter.reset(sampleRate);
+				WDFParameters params = filter.getParameters();
+				params.fc = 1000.0;
+				params.Q = 2.0;
+				filter.setParameters(params);
+			},
+			[](T& filter, double position)
+			{
+				WDFParameters params = filter.getParameters();
+				params.fc = modulatedFc(position);
+				filter.setParameters(params);
+			});
+	}
+
+	/** wave digital filters; the fixed designs have no parameters to modulate */
+	void benchmarkWDF(Benchmark& bench)
+	{
+		const auto resetOnly = [](IAudioSignalProcessor& filter, double sampleRate) { filter.reset(sampleRate); };
+		benchmarkProcessor<WDFButterLPF3>(bench, "WDFButterLPF3", resetOnly);
+		benchmarkProcessor<WDFBesselBSF3>(bench, "WDFBesselBSF3", resetOnly);
+		benchmarkProcessor<WDFConstKBPF6>(bench, "WDFConstKBPF6", resetOnly);
+
+		benchmarkProcessor<WDFTunableButterLPF3>(bench, "WDFTunableButterLPF3",
+			[](WDFTunableButterLPF3& filter, double sampleRate)
+			{
+				filter.reset(sampleRate);
+				filter.setFilterFc(1000.0);
+			},
+			[](WDFTunableButterLPF3& filter, double position)
+			{
+				filter.setFilterFc(modulatedFc(position));
+			});
+
+		benchmarkWDFIdealRLC<WDFIdealRLCLPF>(bench, "WDFIdealRLCLPF");
+		benchmarkWDFIdealRLC<WDFIdealRLCHPF>(bench, "WDFIdealRLCHPF");
+		benchmarkWDFIdealRLC<WDFIdealRLCBPF>(bench, "WDFIdealRLCBPF");
+		benchmarkWDFIdealRLC<WDFIdealRLCBSF>(bench, "WDFIdealRLCBSF");
+	}
+
+	/** float versus double precision for the templated objects */
+	template <typename SampleType>
+	void benchmarkPrecision(Benchmark& bench, const std::string& suffix)
+	{
+		benchmarkProcessor<AudioFilterT<SampleType>>(bench, "AudioFilterT<" + suffix + "> kLPF2",
+			[](AudioFilterT<SampleType>& filter, double sampleRate)
+			{
+				filter.reset(sampleRate);
+				AudioFilterParameters params = filter.getParameters();
+				params.algorithm = filterAlgorithm::kLPF2;
+				params.fc = 1000.0;
+				params.Q = 2.0;
+				filter.setParameters(params);
+			});
+
+		benchmarkProcessor<ZVAFilterT<SampleType>>(bench, "ZVAFilterT<" + suffix + "> kSVF_LP",
+			[](ZVAFilterT<SampleType>& filter, double sampleRate)
+			{
+				filter.reset(sampleRate);
+				ZVAFilterParameters params = filter.getParameters();
+				params.fc = 1000.0;
+				params.Q = 4.0;
+				filter.setParameters(params);
+			});
+
+		benchmarkProcessor<AudioDelayT<SampleType>>(bench, "AudioDelayT<" + suffix + ">",
+			[](AudioDelayT<SampleType>& delay, double sampleRate)
+			{
+				delay.reset(sampleRate);
+				delay.createDelayBuffers(sampleRate, 2000.0);
+				AudioDelayParameters params = delay.getParameters();
+				params.leftDelay_mSec = 250.0;
+				params.feedback_Pct = 50.0;
+				delay.setParameters(params);
+			});
+	}
+
+	/** BiquadBank: N lanes in one pass versus N AudioFilters; costs are per sample per lane */
+	template <unsigned int N>
+	void benchmarkBiquadBank(Benchmark& bench)
+	{
+		const std::string filterName = "AudioFilter x " + std::to_string(N) + " (per lane)";
+		const std::string bankName = "BiquadBank<" + std::to_string(N) + "> (per lane)";
+
+		for (const double sampleRate : bench.sampleRates)
+		{
+			AudioFilter filters[N];
+			BiquadBank<N> bank;
+			for (unsigned int lane = 0; lane < N; lane++)
+			{
+				filters[lane].reset(sampleRate);
+				AudioFilterParameters params = filters[lane].getParameters();
+				params.algorithm = filterAlgorithm::kLPF2;
+				params.fc = 500.0 + 1000.0 * lane;
+				params.Q = 2.0;
+				filters[lane].setParameters(params);
+				bank.setCoefficients(lane, filters[lane].getCoefficients());
+			}
+
+			bench.run(filterName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+			{
+				for (unsigned int lane = 0; lane < N; lane++)
+					filters[lane].processAudioBlock(in, out, n);
+			}, N);
+
+			bench.run(bankName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+			{
+				const float* inputs[N];
+				float* outputs[N];
+				for (unsigned int lane = 0; lane < N; lane++)
+				{
+					inputs[lane] = in;
+					outputs[lane] = out;
+				}
+				bank.processAudioBlock(inputs, outputs, n);
+			}, N);
+		}
+	}
+
+	/**
+	\brief
+	BiquadBank bit-exactness: runs the same coefficients and input through N AudioFilters and a BiquadBank<N>,
+	with a different filter type, fc and input level in each lane, and requires identical output from
+	processAudioFrame( ) against AudioFilter::processAudioSample( ) and from the float processAudioBlock( )
+	against AudioFilter::processAudioBlock( ); returns false on any difference, which main( ) reports with
+	exit code 4.
+	*/
+	template <unsigned int N>
+	bool checkBiquadBank(Benchmark& bench)
+	{
+		const filterAlgorithm algorithms[] = { filterAlgorithm::kLPF2, filterAlgorithm::kHPF2, filterAlgorithm::kBPF2,
+											   filterAlgorithm::kLowShelf, filterAlgorithm::kHiShelf, filterAlgorithm::kCQParaEQ,
+											   filterAlgorithm::kAPF1, filterAlgorithm::kButterLPF2 };
+		const uint32_t numAlgorithms = sizeof(algorithms) / sizeof(algorithms[0]);
+		const double sampleRate = bench.sampleRates[0];
+		const std::vector<float>& signal = bench.getTestSignal(sampleRate);
+		const uint32_t numSamples = static_cast<uint32_t>(signal.size());
+
+		// --- frame API, double precision
+		AudioFilter filters[N];
+		BiquadBank<N> bank;
+		for (unsigned int lane = 0; lane < N; lane++)
+		{
+			filters[lane].reset(sampleRate);
+			AudioFilterParameters params = filters[lane].getParameters();
+			params.algorithm = algorithms[lane % numAlgorithms];
+			params.fc = 200.0 + 900.0 * lane;
+			params.Q = 0.7 + 0.5 * lane;
+			params.boostCut_dB = lane % 2 ? 6.0 : -9.0;
+			filters[lane].setParameters(params);
+			bank.setCoefficients(lane, filters[lane].getCoefficients());
+		}
+
+		uint32_t frameMismatches = 0;
+		double input[N];
+		double output[N];
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			for (unsigned int lane = 0; lane < N; lane++)
+				input[lane] = signal[i] * (1.0 + 0.25 * lane);
+			bank.processAudioFrame(input, output);
+			for (unsigned int lane = 0; lane < N; lane++)
+			{
+				if (output[lane] != filters[lane].processAudioSample(input[lane]))
+					frameMismatches++;
+			}
+		}
+
+		// --- block API, float
+		std::vector<float> laneInputs[N];
+		std::vector<float> filterOutputs[N];
+		std::vector<float> bankOutputs[N];
+		const float* inputs[N];
+		float* outputs[N];
+		for (unsigned int lane = 0; lane < N; lane++)
+		{
+			filters[lane].reset(sampleRate);
+			laneInputs[lane].resize(numSamples);
+			filterOutputs[lane].resize(numSamples);
+			bankOutputs[lane].resize(numSamples);
+			for (uint32_t i = 0; i < numSamples; i++)
+				laneInputs[lane][i] = static_cast<float>(signal[i] * (1.0 + 0.25 * lane));
+		}
+		bank.reset();
+
+		for (uint32_t start = 0; start < numSamples; start += kBlockSize)
+		{
+			const uint32_t count = std::min(kBlockSize, numSamples - start);
+			for (unsigned int lane = 0; lane < N; lane++)
+			{
+				filters[lane].processAudioBlock(&laneInputs[lane][start], &filterOutputs[lane][start], count);
+				inputs[lane] = &laneInputs[lane][start];
+				outputs[lane] = &bankOutputs[lane][start];
+			}
+			bank.processAudioBlock(inputs, outputs, count);
+		}
+
+		uint32_t blockMismatches = 0;
+		for (unsigned int lane = 0; lane < N; lane++)
+			for (uint32_t i = 0; i < numSamples; i++)
+				if (bankOutputs[lane][i] != filterOutputs[lane][i])
+					blockMismatches++;
+
+		printf("BiquadBank<%u> vs %u AudioFilters: %u frame and %u block samples differ (must be 0)\n",
+			   N, N, frameMismatches, blockMismatches);
+		return frameMismatches == 0 && blockMismatches == 0;
+	}
+
+	/** AudioDetectorBank: N lanes in one pass versus N AudioDetectors, both writing kBlockSize envelopes; costs are per sample per lane */
+	template <unsigned int N>
+	void benchmarkDetectorBank(Benchmark& bench)
+	{
+		const std::string detectorName = "AudioDetector x " + std::to_string(N) + " (per lane)";
+		const std::string bankName = "AudioDetectorBank<" + std::to_string(N) + "> (per lane)";
+
+		for (const double sampleRate : bench.sampleRates)
+		{
+			AudioDetectorParameters params;
+			params.attackTime_mSec = 5.0;
+			params.releaseTime_mSec = 50.0;
+			params.detectMode = TLD_AUDIO_DETECT_MODE_RMS;
+			params.detect_dB = true;
+
+			AudioDetector detectors[N];
+			AudioDetectorBank<N> bank;
+			for (unsigned int lane = 0; lane < N; lane++)
+			{
+				detectors[lane].reset(sampleRate);
+				detectors[lane].setParameters(params);
+			}
+			bank.reset(sampleRate);
+			bank.setParameters(params);
+
+			double envelopes[N][kBlockSize];
+			bench.run(detectorName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+			{
+				for (unsigned int lane = 0; lane < N; lane++)
+					for (uint32_t i = 0; i < n; i++)
+						envelopes[lane][i] = detectors[lane].processAudioSample(in[i]);
+				out[0] = static_cast<float>(envelopes[N - 1][0]);
+			}, N);
+
+			bench.run(bankName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+			{
+				const float* inputs[N];
+				double* outputs[N];
+				for (unsigned int lane = 0; lane < N; lane++)
+				{
+					inputs[lane] = in;
+					outputs[lane] = envelopes[lane];
+				}
+				bank.processAudioBlock(inputs, outputs, n);
+				out[0] = static_cast<float>(envelopes[N - 1][0]);
+			}, N);
+		}
+	}
+
+	/** direct form polyphase and half-band sample rate converters; costs are per base rate sample */
+	void benchmarkRateConverters(Benchmark& bench)
+	{
+		const unsigned int firLength = 128;
+		const std::string interpolatorName = "Interpolator 4x (" + std::to_string(firLength) + " taps)";
+		const std::string decimatorName = "Decimator 4x (" + std::to_string(firLength) + " taps)";
+		for (const double sampleRate : bench.sampleRates)
+		{
+			const unsigned int fs = static_cast<unsigned int>(sampleRate);
+			if (bench.wants(interpolatorName))
+			{
+				std::unique_ptr<Interpolator> interpolator(new Interpolator);
+				interpolator->initialize(firLength, rateConversionRatio::k4x, fs);
+				bench.run(interpolatorName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+				{
+					for (uint32_t i = 0; i < n; i++)
+						out[i] = static_cast<float>(interpolator->interpolateAudio(in[i]).audioData[0]);
+				});
+			}
+
+			if (bench.wants(decimatorName))
+			{
+				std::unique_ptr<Decimator> decimator(new Decimator);
+				decimator->initialize(firLength, rateConversionRatio::k4x, fs);
+				bench.run(decimatorName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+				{
+					DecimatorInput data;
+					for (uint32_t i = 0; i < n; i++)
+					{
+						for (unsigned int j = 0; j < data.count; j++)
+							data.audioData[j] = in[i];
+						out[i] = static_cast<float>(decimator->decimateAudio(data));
+					}
+				});
+			}
+		}
+
+		const unsigned int halfBandLength = 31;
+		const std::string halfBandInterpolatorName = "Interpolator 4x half-band (" + std::to_string(halfBandLength) + " taps)";
+		const std::string halfBandDecimatorName = "Decimator 4x half-band (" + std::to_string(halfBandLength) + " taps)";
+		for (const double sampleRate : bench.sampleRates)
+		{
+			if (bench.wants(halfBandInterpolatorName))
+			{
+				std::unique_ptr<Interpolator> interpolator(new Interpolator);
+				interpolator->initializeHalfBand(halfBandLength, rateConversionRatio::k4x);
+				bench.run(halfBandInterpolatorName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+				{
+					for (uint32_t i = 0; i < n; i++)
+						out[i] = static_cast<float>(interpolator->interpolateAudio(in[i]).audioData[0]);
+				});
+			}
+
+			if (bench.wants(halfBandDecimatorName))
+			{
+				std::unique_ptr<Decimator> decimator(new Decimator);
+				decimator->initializeHalfBand(halfBandLength, rateConversionRatio::k4x);
+				bench.run(halfBandDecimatorName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+				{
+					DecimatorInput data;
+					for (uint32_t i = 0; i < n; i++)
+					{
+						for (unsigned int j = 0; j < data.count; j++)
+							data.audioData[j] = in[i];
+						out[i] = static_cast<float>(decimator->decimateAudio(data));
+					}
+				});
+			}
+		}
+	}
+
+#ifdef HAVE_FFTW
+	/** windowed-sinc lowpass IR for the convolver cases */
+	std::vector<double> makeLowpassIR(unsigned int length)
+	{
+		std::vector<double> ir(length);
+		const double fc = 0.1;	// --- normalized to fs
+		for (unsigned int i = 0; i < length; i++)
+		{
+			const double n = i - (length - 1) / 2.0;
+			const double sinc = n == 0.0 ? 2.0 * fc : sin(kTwoPi * fc * n) / (kPi * n);
+			const double window = 0.5 - 0.5 * cos(kTwoPi * i / (length - 1));
+			ir[i] = sinc * window;
+		}
+		return ir;
+	}
+
+	/** FFT based objects: convolvers, pitch shifter and sample rate converters */
+	void benchmarkFFTW(Benchmark& bench)
+	{
+		const unsigned int irLength = 512;
+		std::vector<double> ir = makeLowpassIR(irLength);
+		const std::string fastConvolverName = "FastConvolver (" + std::to_string(irLength) + " taps)";
+		const std::string partitionedName = "PartitionedConvolver (" + std::to_string(irLength) + " taps)";
+
+		for (const double sampleRate : bench.sampleRates)
+		{
+			if (bench.wants(fastConvolverName))
+			{
+				std::unique_ptr<FastConvolver> convolver(new FastConvolver);
+				convolver->initialize(irLength);
+				convolver->setFilterIR(&ir[0]);
+				bench.run(fastConvolverName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+				{
+					for (uint32_t i = 0; i < n; i++)
+						out[i] = static_cast<float>(convolver->processAudioSample(in[i]));
+				});
+			}
+
+			if (bench.wants(partitionedName))
+			{
+				std::unique_ptr<PartitionedConvolver> convolver(new PartitionedConvolver);
+				convolver->initialize(64);
+				convolver->setImpulseResponse(&ir[0], irLength);
+				convolver->reset(sampleRate);
+				bench.run(partitionedName, sampleRate, "static", [&](const float* in, float* out, uint32_t n)
+				{
+					convolver->processAudioBlock(in, out, n);
+				});
+			}
+		}
+
+		benchmarkProcessor<PSMVocoder>(bench, "PSMVocoder",
+			[](PSMVocoder& vocoder, double sampleRate)
+			{
+				vocoder.reset(sampleRate);
+				PSMVocoderParameters params = vocoder.getParameters();
+				params.pitchShiftSemitones = 5.0;
+				vocoder.setParameters(params);
+			},
+			[](PSMVocoder& vocoder, double position)
+			{
+				PSMVocoderParameters params = vocoder.getParameters();
+				params.pitchShiftSemitones = -6.0 + 12.0 * position;
+				vocoder.setParameters(params);
+			});
+	}
+
+	// --- largest pitch error allowed for the PSMVocoder shifts
+	const double kPSMPitch_CentsTolerance = 1.0;
+
+	/**
+	\brief
+	PSMVocoder pitch accuracy: shifts a sine up and down an octave, up a fifth and down a fourth, with and
+	without peak phase locking, and finds the dominant frequency of the settled output from a Hann windowed
+	FFT (parabolic interpolation on the log magnitude of the peak bin). The sine sits a quarter bin off the
+	vocoder's bin grid at any sample rate; exactly half way between two bins the tone is split over both and
+	the dominant frequency is not a fair measure. Returns false when any output is more than
+	kPSMPitch_CentsTolerance from the shifted pitch, which main( ) reports with exit code 6.
+	*/
+	bool checkPSMVocoderPitch(Benchmark& bench)
+	{
+		const double sampleRate = bench.sampleRates[0];
+		const double inputFrequency_Hz = 85.25 * sampleRate / PSM_FFT_LEN;
+		const unsigned int analysisLength = 65536;	// --- long enough to resolve the hop rate sidebands
+		const unsigned int settleLength = PSM_FFT_LEN * 4;	// --- past the latency and the first overlap-adds
+
+		std::unique_ptr<FastFFT> fft(new FastFFT);
+		fft->initialize(analysisLength, windowType::kNoWindow);
+		std::vector<double> frame(analysisLength);
+
+		bool accurate = true;
+		for (const double semitones : { 12.0, -12.0, 7.0, -5.0 })
+		{
+			for (const bool phaseLocking : { false, true })
+			{
+				std::unique_ptr<PSMVocoder> vocoder(new PSMVocoder);
+				vocoder->reset(sampleRate);
+				PSMVocoderParameters params = vocoder->getParameters();
+				params.pitchShiftSemitones = semitones;
+				params.enablePeakPhaseLocking = phaseLocking;
+				vocoder->setParameters(params);
+
+				for (unsigned int i = 0; i < settleLength + analysisLength; i++)
+				{
+					const double yn = vocoder->processAudioSample(0.5 * sin(kTwoPi * inputFrequency_Hz * i / sampleRate));
+					if (i >= settleLength)
+					{
+						const unsigned int n = i - settleLength;
+						frame[n] = yn * (0.5 - 0.5 * cos(kTwoPi * n / analysisLength));
+					}
+				}
+
+				// --- dominant bin, skipping DC
+				fftw_complex* spectrum = fft->doFFT(&frame[0]);
+				unsigned int peakBin = 1;
+				double peakMagnitude = 0.0;
+				for (unsigned int k = 1; k < analysisLength / 2; k++)
+				{
+					const double magnitude = getMagnitude(spectrum[k][0], spectrum[k][1]);
+					if (magnitude > peakMagnitude)
+					{
+						peakMagnitude = magnitude;
+						peakBin = k;
+					}
+				}
+
+				const double below = log(getMagnitude(spectrum[peakBin - 1][0], spectrum[peakBin - 1][1]) + 1e-30);
+				const double peak = log(peakMagnitude + 1e-30);
+				const double above = log(getMagnitude(spectrum[peakBin + 1][0], spectrum[peakBin + 1][1]) + 1e-30);
+				const double curvature = below - 2.0 * peak + above;
+				const double offset = curvature < 0.0 ? 0.5 * (below - above) / curvature : 0.0;
+				const double frequency_Hz = (peakBin + offset) * sampleRate / analysisLength;
+
+				const double expected_Hz = inputFrequency_Hz * pow(2.0, semitones / 12.0);
+				const double error_Cents = 1200.0 * log2(frequency_Hz / expected_Hz);
+				printf("PSMVocoder pitch, %+.0f semitones%s: %.2f Hz, expected %.2f Hz (%+.2f cents, tolerance %.1f)\n",
+					   semitones, phaseLocking ? ", phase locking" : "", frequency_Hz, expected_Hz, error_Cents, kPSMPitch_CentsTolerance);
+				accurate = accurate && fabs(error_Cents) <= kPSMPitch_CentsTolerance;
+			}
+		}
+		return accurate;
+	}
+#endif
+
+	/** write the results as CSV; returns false if the file cannot be written */
+	bool writeResults(const char* path, const std::vector<BenchmarkResult>& results)
+	{
+		FILE* file = fopen(path, "w");
+		if (!file) return false;
+
+		fprintf(file, "name,sample_rate,mode,ns_per_sample\n");
+		for (const BenchmarkResult& result : results)
+			fprintf(file, "%s,%.0f,%s,%.3f\n", result.name.c_str(), result.sampleRate, result.mode.c_str(), result.nSecPerSample);
+
+		fclose(file);
+		return true;
+	}
+
+	/** read a CSV written by writeResults into key -> ns/sample; returns false if the file cannot be read */
+	bool readResults(const char* path, std::map<std::string, double>& baseline)
+	{
+		FILE* file = fopen(path, "r");
+		if (!file) return false;
+
+		char line[512];
+		while (fgets(line, sizeof(line), file))
+		{
+			// --- fields are split from the right; names may not contain commas but need not be quoted
+			std::string text(line);
+			while (!text.empty() && (text.back() == '\n' || text.back() == '\r'))
+				text.pop_back();
+
+			const size_t valueComma = text.rfind(',');
+			if (valueComma == std::string::npos) continue;
+			const size_t modeComma = text.rfind(',', valueComma - 1);
+			if (modeComma == std::string::npos || modeComma == 0) continue;
+			const size_t rateComma = text.rfind(',', modeComma - 1);
+			if (rateComma == std::string::npos) continue;
+
+			const std::string name = text.substr(0, rateComma);
+			const std::string rate = text.substr(rateComma + 1, modeComma - rateComma - 1);
+			const std::string mode = text.substr(modeComma + 1, valueComma - modeComma - 1);
+			char* end = nullptr;
+			const double value = strtod(text.c_str() + valueComma + 1, &end);
+			if (end == text.c_str() + valueComma + 1) continue;	// --- header
+
+			baseline[resultKey(name, atof(rate.c_str()), mode)] = value;
+		}
+
+		fclose(file);
+		return true;
+	}
+
+	/** compare against the baseline; returns the number of cases slower than the tolerance allows */
+	uint32_t checkRegressions(const std::vector<BenchmarkResult>& results, const std::map<std::string, double>& baseline, double tolerance_Pct)
+	{
+		uint32_t regressions = 0;
+		for (const BenchmarkResult& result : results)
+		{
+			const auto it = baseline.find(resultKey(result.name, result.sampleRate, result.mode));
+			if (it == baseline.end() || it->second <= 0.0) continue;
+
+			const double change_Pct = 100.0 * (result.nSecPerSample - it->second) / it->second;
+			if (change_Pct > tolerance_Pct)
+			{
+				if (regressions == 0)
+					printf("\nregressions (tolerance %.1f%%):\n", tolerance_Pct);
+				printf("%-40s %7.1fk  %-10s %10.2f -> %.2f ns/sample (+%.1f%%)\n", result.name.c_str(), result.sampleRate / 1000.0,
+					   result.mode.c_str(), it->second, result.nSecPerSample, change_Pct);
+				regressions++;
+			}
+		}
+		return regressions;
+	}
+
+	void printUsage()
+	{
+		fprintf(stderr, "usage: fxbench [--rate Hz] [--filter text] [--length sec] [--output file.csv]\n"
+						"               [--baseline file.csv] [--tolerance pct]\n");
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Benchmark bench;
+	const char* outputPath = nullptr;
+	const char* baselinePath = nullptr;
+	double tolerance_Pct = 10.0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const bool hasValue = i + 1 < argc;
+		if (hasValue && strcmp(argv[i], "--rate") == 0)
+			bench.sampleRates = { atof(argv[++i]) };
+		else if (hasValue && strcmp(argv[i], "--filter") == 0)
+			bench.nameFilter = argv[++i];
+		else if (hasValue && strcmp(argv[i], "--length") == 0)
+			bench.runLength_Sec = atof(argv[++i]);
+		else if (hasValue && strcmp(argv[i], "--output") == 0)
+			outputPath = argv[++i];
+		else if (hasValue && strcmp(argv[i], "--baseline") == 0)
+			baselinePath = argv[++i];
+		else if (hasValue && strcmp(argv[i], "--tolerance") == 0)
+			tolerance_Pct = atof(argv[++i]);
+		else
+		{
+			printUsage();
+			return 1;
+		}
+	}
+
+	if (bench.sampleRates[0] <= 0.0 || bench.runLength_Sec <= 0.0)
+	{
+		printUsage();
+		return 1;
+	}
+
+	// --- read the baseline first so a bad path fails before the long run
+	std::map<std::string, double> baseline;
+	if (baselinePath && !readResults(baselinePath, baseline))
+	{
+		fprintf(stderr, "fxbench: cannot read baseline %s\n", baselinePath);
+		return 1;
+	}
+
+	printf("fxbench: %u sample blocks, %.1f sec per case (mono; double for stereo)\n", kBlockSize, bench.runLength_Sec);
+	benchmarkAudioFilter(bench);
+	benchmarkZVAFilter(bench);
+	benchmarkPrecision<double>(bench, "double");
+	benchmarkPrecision<float>(bench, "float");
+	benchmarkBiquadBank<2>(bench);
+	benchmarkBiquadBank<8>(bench);
+	const bool biquadBankExact = checkBiquadBank<2>(bench) && checkBiquadBank<8>(bench);
+	benchmarkDetectorBank<2>(bench);
+	benchmarkDetectorBank<8>(bench);
+	benchmarkDelays(bench);
+	benchmarkDenormalTails(bench);
+	benchmarkPhasers(bench);
+	const bool phaserAccurate = checkPhaserControlRate(bench);
+	benchmarkTubes(bench);
+	const bool fastMathAccurate = checkFastMath(bench);
+	benchmarkSidechain(bench);
+	const bool sidechainExact = checkSidechain(bench);
+	benchmarkWDF(bench);
+	benchmarkRateConverters(bench);
+#ifdef HAVE_FFTW
+	benchmarkFFTW(bench);
+	const bool psmPitchAccurate = checkPSMVocoderPitch(bench);
+#else
+	printf("(built without FFTW: FastConvolver, PartitionedConvolver and PSMVocoder not run)\n");
+#endif
+
+	if (outputPath && !writeResults(outputPath, bench.results))
+	{
+		fprintf(stderr, "fxbench: cannot write %s\n", outputPath);
+		return 1;
+	}
+
+	if (baselinePath && checkRegressions(bench.results, baseline, tolerance_Pct) > 0)
+		return 2;
+
+	if (!phaserAccurate)
+	{
+		fprintf(stderr, "fxbench: control rate Phaser strays from its per-sample LFO output by more than %.0f dB\n", kPhaserControlRate_dBTolerance);
+		return 2;
+	}
+
+	if (!fastMathAccurate)
+	{
+		fprintf(stderr, "fxbench: fast math dB conversions are outside the %.2f dB tolerance\n", kFastMath_dBTolerance);
+		return 3;
+	}
+
+	if (!biquadBankExact)
+	{
+		fprintf(stderr, "fxbench: BiquadBank output differs from AudioFilter\n");
+		return 4;
+	}
+
+	if (!sidechainExact)
+	{
+		fprintf(stderr, "fxbench: DynamicsProcessor block aux input output differs from the per-sample sidechain\n");
+		return 5;
+	}
+
+#ifdef HAVE_FFTW
+	if (!psmPitchAccurate)
+	{
+		fprintf(stderr, "fxbench: PSMVocoder pitch shifts are outside the %.1f cent tolerance\n", kPSMPitch_CentsTolerance);
+		return 6;
+	}
+#endif
+
+	return 0;
+}
@@ -0,0 +1,476 @@
+// -----------------------------------------------------------------------------
+//    fxrender.cpp
+//
+/**
+    \file   fxrender.cpp
+    \author Steve Dwyer
+    \brief  headless offline render host; streams a WAV file through a project's
+    		PluginCore via PluginBase::processAudioBuffers( ) and writes the result
+
+    		usage: fxrender [options] <input.wav> <output.wav>
+
+    		options:
+    		  -r, --rate <Hz>          run the plugin at this sample rate (default: the input file's);
+    		                           no resampling is done, the output is simply tagged with this rate
+    		  -b, --buffer <frames>    host buffer size (default: 512)
+    		  -a, --automation <file>  parameter automation file, see below
+    		  -p, --param <id>=<value> set a parameter before rendering; may be repeated
+    		  -t, --tail <seconds>     append this much silence to let delays and reverbs ring out
+    		  -l, --list               list the plugin parameters and exit
+
+    		automation file: one event per line, '#' starts a comment
+
+    		  <time in seconds>  <controlID>  <value>
+
+    		events are applied at the top of the host buffer that contains them, as a host without
+    		sample accurate automation would; parameter smoothing then works as it does in a DAW
+*/
+// -----------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "plugincore.h"
+
+namespace
+{
+	// --- defaults
+	const uint32_t kDefaultBufferSize = 512;
+	const uint32_t kMaxFileChannels = 2;
+
+	// --- WAV format tags
+	const uint16_t kWavFormatPCM = 1;
+	const uint16_t kWavFormatFloat = 3;
+	const uint16_t kWavFormatExtensible = 0xFFFE;
+
+	/** de-interleaved audio and its format */
+	struct AudioFile
+	{
+		double sampleRate = 44100.0;
+		std::vector<std::vector<float>> channels;
+
+		uint32_t getNumChannels() const { return static_cast<uint32_t>(channels.size()); }
+		uint32_t getNumFrames() const { return channels.empty() ? 0 : static_cast<uint32_t>(channels[0].size()); }
+	};
+
+	/** a single automation event */
+	struct AutomationEvent
+	{
+		uint64_t frame = 0;
+		int32_t controlID = 0;
+		double value = 0.0;
+	};
+
+	/** command line settings */
+	struct RenderSettings
+	{
+		std::string inputPath;
+		std::string outputPath;
+		std::string automationPath;
+		double sampleRate = 0.0;	// --- 0 = use the input file's rate
+		uint32_t bufferSize = kDefaultBufferSize;
+		double tail_Sec = 0.0;
+		bool listParameters = false;
+		std::vector<std::pair<int32_t, double>> parameters;
+	};
+
+	/** the plugin never sees MIDI here */
+	class NullMidiEventQueue : public IMidiEventQueue
+	{
+	public:
+		uint32_t getEventCount() override { return 0; }
+		bool fireMidiEvents(uint32_t uSampleOffset) override { return true; }
+	};
+
+	uint32_t readLE(const unsigned char* bytes, uint32_t numBytes)
+	{
+		uint32_t value = 0;
+		for (uint32_t i = 0; i < numBytes; i++)
+			value |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+		return value;
+	}
+
+	void writeLE(std::ofstream& file, uint32_t value, uint32_t numBytes)
+	{
+		for (uint32_t i = 0; i < numBytes; i++)
+			file.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+	}
+
+	/** read a PCM (16/24/32 bit) or IEEE float (32/64 bit) WAV file */
+	bool readWavFile(const std::string& path, AudioFile& audio)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+		{
+			fprintf(stderr, "fxrender: cannot open %s\n", path.c_str());
+			return false;
+		}
+
+		std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		if (bytes.size() < 12 || memcmp(&bytes[0], "RIFF", 4) != 0 || memcmp(&bytes[8], "WAVE", 4) != 0)
+		{
+			fprintf(stderr, "fxrender: %s is not a RIFF/WAVE file\n", path.c_str());
+			return false;
+		}
+
+		uint16_t format = 0;
+		uint32_t numChannels = 0;
+		uint32_t bitsPerSample = 0;
+		const unsigned char* data = nullptr;
+		uint32_t dataSize = 0;
+
+		// --- walk the chunks; chunks are word aligned
+		size_t pos = 12;
+		while (pos + 8 <= bytes.size())
+		{
+			const uint32_t chunkSize = readLE(&bytes[pos + 4], 4);
+			const size_t chunkStart = pos + 8;
+			const size_t available = std::min<size_t>(chunkSize, bytes.size() - chunkStart);
+
+			if (memcmp(&bytes[pos], "fmt ", 4) == 0 && available >= 16)
+			{
+				format = static_cast<uint16_t>(readLE(&bytes[chunkStart], 2));
+				numChannels = readLE(&bytes[chunkStart + 2], 2);
+				audio.sampleRate = readLE(&bytes[chunkStart + 4], 4);
+				bitsPerSample = readLE(&bytes[chunkStart + 14], 2);
+
+				// --- the sub-format GUID starts with the format tag
+				if (format == kWavFormatExtensible && available >= 26)
+					format = static_cast<uint16_t>(readLE(&bytes[chunkStart + 24], 2));
+			}
+			else if (memcmp(&bytes[pos], "data", 4) == 0)
+			{
+				data = &bytes[chunkStart];
+				dataSize = static_cast<uint32_t>(available);
+			}
+			pos = chunkStart + chunkSize + (chunkSize & 1);
+		}
+
+		const bool isPCM = format == kWavFormatPCM && (bitsPerSample == 16 || bitsPerSample == 24 || bitsPerSample == 32);
+		const bool isFloat = format == kWavFormatFloat && (bitsPerSample == 32 || bitsPerSample == 64);
+		if (!data || numChannels == 0 || (!isPCM && !isFloat))
+		{
+			fprintf(stderr, "fxrender: %s: unsupported WAV format (tag %u, %u bits)\n", path.c_str(), format, bitsPerSample);
+			return false;
+		}
+
+		const uint32_t bytesPerSample = bitsPerSample / 8;
+		const uint32_t numFrames = dataSize / (bytesPerSample * numChannels);
+		audio.channels.assign(numChannels, std::vector<float>(numFrames));
+
+		for (uint32_t frame = 0; frame < numFrames; frame++)
+		{
+			for (uint32_t channel = 0; channel < numChannels; channel++)
+			{
+				const unsigned char* sample = data + (static_cast<size_t>(frame) * numChannels + channel) * bytesPerSample;
+				float value = 0.f;
+				if (isFloat && bitsPerSample == 32)
+				{
+					const uint32_t bits = readLE(sample, 4);
+					memcpy(&value, &bits, sizeof(float));
+				}
+				else if (isFloat)
+				{
+					const uint64_t bits = readLE(sample, 4) | static_cast<uint64_t>(readLE(sample + 4, 4)) << 32;
+					double dValue = 0.0;
+					memcpy(&dValue, &bits, sizeof(double));
+					value = static_cast<float>(dValue);
+				}
+				else
+				{
+					// --- sign extend from the top byte
+					const uint32_t shift = 32 - bitsPerSample;
+					const int32_t iValue = static_cast<int32_t>(readLE(sample, bytesPerSample) << shift) >> shift;
+					value = static_cast<float>(iValue / static_cast<double>(1u << (bitsPerSample - 1)));
+				}
+				audio.channels[channel][frame] = value;
+			}
+		}
+		return true;
+	}
+
+	/** write a 32-bit IEEE float WAV file */
+	bool writeWavFile(const std::string& path, const AudioFile& audio)
+	{
+		std::ofstream file(path, std::ios::binary);
+		if (!file)
+		{
+			fprintf(stderr, "fxrender: cannot create %s\n", path.c_str());
+			return false;
+		}
+
+		const uint32_t numChannels = audio.getNumChannels();
+		const uint32_t numFrames = audio.getNumFrames();
+		const uint32_t sampleRate = static_cast<uint32_t>(audio.sampleRate + 0.5);
+		const uint32_t dataSize = numFrames * numChannels * 4;
+
+		file.write("RIFF", 4);
+		writeLE(file, 36 + dataSize, 4);
+		file.write("WAVE", 4);
+
+		file.write("fmt ", 4);
+		writeLE(file, 16, 4);
+		writeLE(file, kWavFormatFloat, 2);
+		writeLE(file, numChannels, 2);
+		writeLE(file, sampleRate, 4);
+		writeLE(file, sampleRate * numChannels * 4, 4);
+		writeLE(file, numChannels * 4, 2);
+		writeLE(file, 32, 2);
+
+		file.write("data", 4);
+		writeLE(file, dataSize, 4);
+		for (uint32_t frame = 0; frame < numFrames; frame++)
+		{
+			for (uint32_t channel = 0; channel < numChannels; channel++)
+			{
+				uint32_t bits = 0;
+				memcpy(&bits, &audio.channels[channel][frame], sizeof(float));
+				writeLE(file, bits, 4);
+			}
+		}
+		return static_cast<bool>(file);
+	}
+
+	/** parse the automation file; events are returned sorted by time */
+	bool readAutomationFile(const std::string& path, double sampleRate, std::vector<AutomationEvent>& events)
+	{
+		std::ifstream file(path);
+		if (!file)
+		{
+			fprintf(stderr, "fxrender: cannot open %s\n", path.c_str());
+			return false;
+		}
+
+		std::string line;
+		uint32_t lineNumber = 0;
+		while (std::getline(file, line))
+		{
+			lineNumber++;
+			line = line.substr(0, line.find('#'));
+			if (line.find_first_not_of(" \t\r") == std::string::npos)
+				continue;
+
+			std::istringstream fields(line);
+			double time_Sec = 0.0;
+			AutomationEvent event;
+			if (!(fields >> time_Sec >> event.controlID >> event.value) || time_Sec < 0.0)
+			{
+				fprintf(stderr, "fxrender: %s:%u: expected <time in seconds> <controlID> <value>\n", path.c_str(), lineNumber);
+				return false;
+			}
+			event.frame = static_cast<uint64_t>(time_Sec * sampleRate + 0.5);
+			events.push_back(event);
+		}
+
+		std::stable_sort(events.begin(), events.end(),
+						 [](const AutomationEvent& a, const AutomationEvent& b) { return a.frame < b.frame; });
+		return true;
+	}
+
+	/** set a parameter the way a host does between buffers */
+	bool setParameter(PluginCore& plugin, int32_t controlID, double value)
+	{
+		if (!plugin.getPluginParameterByControlID(controlID))
+		{
+			fprintf(stderr, "fxrender: unknown controlID %d (use --list)\n", controlID);
+			return false;
+		}
+
+		ParameterUpdateInfo info;
+		info.bufferProcUpdate = true;
+		plugin.updatePluginParameter(controlID, value, info);
+		return true;
+	}
+
+	void listParameters(PluginCore& plugin)
+	{
+		printf("%s parameters:\n", PluginCore::getPluginName());
+		printf("%9s  %-24s %12s %12s %12s\n", "controlID", "name", "min", "max", "default");
+		for (size_t i = 0; i < plugin.getPluginParameterCount(); i++)
+		{
+			PluginParameter* piParam = plugin.getPluginParameterByIndex(static_cast<int32_t>(i));
+			if (!piParam)
+				continue;
+
+			printf("%9u  %-24s %12g %12g %12g %s\n", piParam->getControlID(), piParam->getControlName(),
+				   piParam->getMinValue(), piParam->getMaxValue(), piParam->getDefaultValue(), piParam->getControlUnits());
+		}
+	}
+
+	void printUsage()
+	{
+		fprintf(stderr,
+				"usage: fxrender [options] <input.wav> <output.wav>\n"
+				"  -r, --rate <Hz>          plugin sample rate (default: input file rate, no resampling)\n"
+				"  -b, --buffer <frames>    host buffer size (default: %u)\n"
+				"  -a, --automation <file>  automation file: <time in seconds> <controlID> <value> per line\n"
+				"  -p, --param <id>=<value> set a parameter before rendering; may be repeated\n"
+				"  -t, --tail <seconds>     append silence to let the effect ring out\n"
+				"  -l, --list               list the plugin parameters and exit\n",
+				kDefaultBufferSize);
+	}
+
+	bool parseCommandLine(int argc, char* argv[], RenderSettings& settings)
+	{
+		std::vector<std::string> paths;
+		for (int i = 1; i < argc; i++)
+		{
+			const std::string arg = argv[i];
+			const bool hasValue = i + 1 < argc;
+
+			if ((arg == "-r" || arg == "--rate") && hasValue)
+				settings.sampleRate = atof(argv[++i]);
+			else if ((arg == "-b" || arg == "--buffer") && hasValue)
+				settings.bufferSize = static_cast<uint32_t>(atoi(argv[++i]));
+			else if ((arg == "-a" || arg == "--automation") && hasValue)
+				settings.automationPath = argv[++i];
+			else if ((arg == "-t" || arg == "--tail") && hasValue)
+				settings.tail_Sec = atof(argv[++i]);
+			else if ((arg == "-p" || arg == "--param") && hasValue)
+			{
+				const std::string setting = argv[++i];
+				const size_t equals = setting.find('=');
+				if (equals == std::string::npos)
+					return false;
+				settings.parameters.emplace_back(atoi(setting.substr(0, equals).c_str()), atof(setting.substr(equals + 1).c_str()));
+			}
+			else if (arg == "-l" || arg == "--list")
+				settings.listParameters = true;
+			else if (!arg.empty() && arg[0] == '-')
+				return false;
+			else
+				paths.push_back(arg);
+		}
+
+		if (settings.listParameters)
+			return true;
+
+		if (paths.size() != 2 || settings.bufferSize == 0 || settings.sampleRate < 0.0 || settings.tail_Sec < 0.0)
+			return false;
+
+		settings.inputPath = paths[0];
+		settings.outputPath = paths[1];
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	RenderSettings settings;
+	if (!parseCommandLine(argc, argv, settings))
+	{
+		printUsage();
+		return 1;
+	}
+
+	PluginCore plugin;
+	if (settings.listParameters)
+	{
+		listParameters(plugin);
+		return 0;
+	}
+
+	AudioFile input;
+	if (!readWavFile(settings.inputPath, input))
+		return 1;
+
+	if (input.getNumChannels() > kMaxFileChannels)
+	{
+		fprintf(stderr, "fxrender: only mono and stereo files are supported\n");
+		return 1;
+	}
+
+	const double sampleRate = settings.sampleRate > 0.0 ? settings.sampleRate : input.sampleRate;
+
+	std::vector<AutomationEvent> automation;
+	if (!settings.automationPath.empty() && !readAutomationFile(settings.automationPath, sampleRate, automation))
+		return 1;
+
+	// --- the tail is rendered from silence
+	const uint32_t numFrames = input.getNumFrames() + static_cast<uint32_t>(settings.tail_Sec * sampleRate + 0.5);
+	const uint32_t numChannels = input.getNumChannels();
+	for (auto& channel : input.channels)
+		channel.resize(numFrames, 0.f);
+
+	AudioFile output;
+	output.sampleRate = sampleRate;
+	output.channels.assign(numChannels, std::vector<float>(numFrames, 0.f));
+
+	// --- same call sequence as the plugin shells: initialize, then reset for the stream
+	PluginInfo pluginInfo;
+	pluginInfo.pathToDLL = "";
+	plugin.initialize(pluginInfo);
+
+	ResetInfo resetInfo(sampleRate, 32);
+	plugin.reset(resetInfo);
+
+	for (const auto& parameter : settings.parameters)
+	{
+		if (!setParameter(plugin, parameter.first, parameter.second))
+			return 1;
+	}
+
+	const uint32_t ioFormat = numChannels == 1 ? kCFMono : kCFStereo;
+	HostInfo hostInfo;
+	hostInfo.dBPM = 120.0;
+	hostInfo.fTimeSigNumerator = 4.f;
+	hostInfo.uTimeSigDenomintor = 4;
+	NullMidiEventQueue midiEventQueue;
+
+	float* inputs[kMaxFileChannels] = { nullptr };
+	float* outputs[kMaxFileChannels] = { nullptr };
+	size_t nextEvent = 0;
+
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t frame = 0; frame < numFrames; frame += settings.bufferSize)
+	{
+		const uint32_t bufferSize = std::min(settings.bufferSize, numFrames - frame);
+
+		// --- automation due in this buffer is applied at its top
+		while (nextEvent < automation.size() && automation[nextEvent].frame < frame + bufferSize)
+		{
+			if (!setParameter(plugin, automation[nextEvent].controlID, automation[nextEvent].value))
+				return 1;
+			nextEvent++;
+		}
+
+		for (uint32_t channel = 0; channel < numChannels; channel++)
+		{
+			inputs[channel] = &input.channels[channel][frame];
+			outputs[channel] = &output.channels[channel][frame];
+		}
+
+		hostInfo.uAbsoluteFrameBufferIndex = frame;
+		hostInfo.dAbsoluteFrameBufferTime = frame / sampleRate;
+
+		ProcessBufferInfo processBufferInfo;
+		processBufferInfo.inputs = inputs;
+		processBufferInfo.outputs = outputs;
+		processBufferInfo.numAudioInChannels = numChannels;
+		processBufferInfo.numAudioOutChannels = numChannels;
+		processBufferInfo.numFramesToProcess = bufferSize;
+		processBufferInfo.channelIOConfig.inputChannelFormat = ioFormat;
+		processBufferInfo.channelIOConfig.outputChannelFormat = ioFormat;
+		processBufferInfo.hostInfo = &hostInfo;
+		processBufferInfo.midiEventQueue = &midiEventQueue;
+
+		plugin.processAudioBuffers(processBufferInfo);
+	}
+	const auto end = std::chrono::steady_clock::now();
+
+	if (!writeWavFile(settings.outputPath, output))
+		return 1;
+
+	const double render_Sec = std::chrono::duration<double>(end - start).count();
+	const double audio_Sec = numFrames / sampleRate;
+	printf("%s: rendered %.2f sec of audio in %.3f sec (%.1fx realtime)\n", PluginCore::getPluginName(),
+		   audio_Sec, render_Sec, render_Sec > 0.0 ? audio_Sec / render_Sec : 0.0);
+
+	return 0;
+}
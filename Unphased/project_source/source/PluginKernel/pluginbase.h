@@ -85,6 +85,12 @@ public:
 	/** Buffer Proc Cycle: III connects meter variables to outbound GUI control changes (part of ASPiK output variable binding option) */
 	bool updateOutBoundVariables();
 
+	/** feed the bound meter variables into their MeterAccumulators; called after each frame or block */
+	void accumulateOutBoundVariables(uint32_t numSamples);
+
+	/** get the MeterAccumulator of a meter parameter for feeding it directly; nullptr if none */
+	MeterAccumulator* getMeterAccumulator(int32_t controlID);
+
 	/** notification that a GUI parameter changed. NOT for updating internal states or variables; unused at base class level */
 	virtual bool guiParameterChanged(int32_t controlID, double actualValue) { return true; }
 
@@ -383,6 +389,13 @@ public:
 	*/
 	bool wantsVST3SampleAccurateAutomation() { return apiSpecificInfo.enableVST3SampleAccurateAutomation; }
 
+	/**
+	\brief Description query: 64-bit (double precision) audio buffers
+
+	\return true if plugin accepts 64-bit buffers from hosts that support them (VST3 kSample64)
+	*/
+	bool wantsDoublePrecision() { return pluginDescriptor.processDoublePrecision; }
+
 	/**
 	\brief Description query: VST Sample Accurate Automation granularity
 
@@ -425,6 +438,7 @@ protected:
 
 	// --- block info struct (optional for block processing, if enabled)
 	ProcessBlockInfo processBlockInfo;
+	uint32_t smoothingBlockSize = 1;	///< samples per smoothing step; the block size when the smoothers are clocked once per block
 
 	// --- ultra-fast access ***for real-time audio processing***
 	PluginParameter** pluginParameterArray = nullptr;			///< old-fashioned C-arrays of pointers for ultra-fast access for real-time audio processing
@@ -439,6 +453,16 @@ protected:
 	PluginParameter** outboundPluginParameters = nullptr;		///< old-fashioned C-arrays of pointers for outbound (meter) parameters
 	uint32_t numOutboundPluginParameters = 0;					///< total number of outbound (meter) parameters
 
+	// --- change tracking: only the parameters that actually moved are synced or smoothed
+	ParameterDirtySet dirtyParameters;							///< control value written since the last syncInBoundVariables( )
+	ParameterDirtySet dirtySmoothingParameters;					///< smoothing target written since the last smoothing pass
+	PluginParameter** activeSmoothingPluginParameters = nullptr;	///< parameters still moving toward their smoothing target
+	uint32_t numActiveSmoothingPluginParameters = 0;			///< number of actively smoothing parameters
+	bool* isActiveSmoothingParameter = nullptr;					///< active list membership, by parameter index
+
+	/** move parameters with a new smoothing target into the active smoothing list */
+	void activateSmoothingParameters();
+
     // --- vectorized version of pluginParameterMap for faster iteration that the map version below
     std::vector<PluginParameter*> pluginParameters;				///< vector version of parameter list
 
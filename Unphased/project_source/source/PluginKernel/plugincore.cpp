@@ -277,7 +277,7 @@ bool PluginCore::preProcessAudioBlock(IMidiEventQueue* midiEventQueue)
 	//     for the DSP algorithm at hand
 	//     NOTE: updating (cooking) only once per block usually SAVES CPU cycles
 	//           updating (cooking) once per sample period usually EATS CPU cycles, potentially unnecessarily
-	// updateParameters();
+	updateParameters();
 
 	return true;
 }
@@ -337,7 +337,39 @@ bool PluginCore::processAudioBlock(ProcessBlockInfo& processBlockInfo)
 
 	// --- or FX
 	else if (getPluginType() == kFXPlugin)
-		renderFXPassThrough(processBlockInfo);
+	{
+		if (fx_On)
+		{
+			// --- each phaser runs on its channel directly in the host buffers; a mono input feeds
+			//     both channels, so go in reverse order to overwrite an in-place channel 0 last
+			const uint32_t start = processBlockInfo.blockStartIndex;
+			for (unsigned int i = NUM_CHANNELS; i-- > 0;)
+			{
+				if (i >= processBlockInfo.numAudioOutChannels)
+					continue;
+
+				const uint32_t inputChannel = i < processBlockInfo.numAudioInChannels ? i : 0;
+				if (processBlockInfo.outputs64)
+				{
+					// --- 64-bit host: stay in double precision end-to-end
+					phasers[i].processAudioBlock(&processBlockInfo.inputs64[inputChannel][start],
+												 &processBlockInfo.outputs64[i][start],
+												 processBlockInfo.blockSize);
+				}
+				else
+				{
+					phasers[i].processAudioBlock(&processBlockInfo.inputs[inputChannel][start],
+												 &processBlockInfo.outputs[i][start],
+												 processBlockInfo.blockSize);
+				}
+			}
+		}
+		else
+		{
+			// --- Bypass
+			renderFXPassThrough(processBlockInfo);
+		}
+	}
 
 	return true;
 }
@@ -378,7 +410,10 @@ bool PluginCore::renderSynthSilence(ProcessBlockInfo& blockInfo)
 		for (uint32_t channel = 0; channel < blockInfo.numAudioOutChannels; channel++)
 		{
 			// --- silence (or, your synthesized block of samples)
-			blockInfo.outputs[channel][sample] = 0.0;
+			if (blockInfo.outputs64)
+				blockInfo.outputs64[channel][sample] = 0.0;
+			else
+				blockInfo.outputs[channel][sample] = 0.0;
 		}
 	}
 	return true;
@@ -405,8 +440,14 @@ bool PluginCore::renderFXPassThrough(ProcessBlockInfo& blockInfo)
 		// --- handles multiple channels, but up to you for bookkeeping
 		for (uint32_t channel = 0; channel < blockInfo.numAudioOutChannels; channel++)
 		{
+			// --- a mono input feeds all of the output channels
+			const uint32_t inputChannel = channel < blockInfo.numAudioInChannels ? channel : 0;
+
 			// --- pass through code, or your processed FX version
-			blockInfo.outputs[channel][sample] = blockInfo.inputs[channel][sample];
+			if (blockInfo.outputs64)
+				blockInfo.outputs64[channel][sample] = blockInfo.inputs64[inputChannel][sample];
+			else
+				blockInfo.outputs[channel][sample] = blockInfo.inputs[inputChannel][sample];
 		}
 	}
 	return true;
@@ -840,6 +881,10 @@ bool PluginCore::initPluginDescriptors()
 	//     false: process audio blocks --- most efficient, but somewhat more complex code
 	pluginDescriptor.processFrames = kProcessFrames;
 
+	// --- kProcessDoublePrecision: accept 64-bit buffers from hosts that offer them (VST3 only);
+	//     processAudioBlock( ) must then handle the inputs64/outputs64 pointers
+	pluginDescriptor.processDoublePrecision = kProcessDoublePrecision;
+
 	// --- for block processing (if pluginDescriptor.processFrame == false),
 	//     this is the block size
 	processBlockInfo.blockSize = kBlockSize;
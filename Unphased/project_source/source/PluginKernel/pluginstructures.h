@@ -20,6 +20,7 @@
 #include <sstream>
 #include <vector>
 #include <stdint.h>
+#include <cstring>
 
 #include "readerwriterqueue.h"
 #include "atomicops.h"
@@ -1068,6 +1069,13 @@ struct ProcessBlockInfo
 	float** auxInputs = nullptr;			///< aux (sidechain) input buffers
 	float** auxOutputs = nullptr;			///< aux outputs - for future use
 
+	// --- 64-bit audio; non-null only when the host is running double precision
+	//     (see PluginDescriptor::processDoublePrecision), otherwise use the float pointers
+	double** inputs64 = nullptr;		///< 64-bit audio input buffers
+	double** outputs64 = nullptr;		///< 64-bit audio output buffers
+	double** auxInputs64 = nullptr;		///< 64-bit aux (sidechain) input buffers
+	double** auxOutputs64 = nullptr;	///< 64-bit aux outputs - for future use
+
 	uint32_t numAudioInChannels = 0;		///< audio input channel count
 	uint32_t numAudioOutChannels = 0;		///< audio input channel count
 	uint32_t numAuxAudioInChannels = 0;		///< audio input channel count
@@ -1142,6 +1150,14 @@ struct ProcessBufferInfo
 	float** outputs = nullptr;		///< audio output buffers
 	float** auxInputs = nullptr;	///< aux (sidechain) input buffers
 	float** auxOutputs = nullptr;	///< aux outputs - for future use
+
+	// --- 64-bit audio (VST3 kSample64 only); non-null only when the host is running
+	//     double precision, in which case the float pointers above are nullptr
+	double** inputs64 = nullptr;		///< 64-bit audio input buffers
+	double** outputs64 = nullptr;		///< 64-bit audio output buffers
+	double** auxInputs64 = nullptr;		///< 64-bit aux (sidechain) input buffers
+	double** auxOutputs64 = nullptr;	///< 64-bit aux outputs - for future use
+
 	uint32_t numAudioInChannels = 0;		///< audio input channel count
 	uint32_t numAudioOutChannels = 0;		///< audio output channel count
 	uint32_t numAuxAudioInChannels = 0;		///< aux input channel count
@@ -1259,6 +1275,7 @@ struct PluginDescriptor
     , pluginTypeCode(pluginType::kFXPlugin) // FX or synth
     , hasSidechain(0)
     , processFrames(1)                  /* default operation */
+    , processDoublePrecision(0)         /* default operation */
     , wantsMIDI(1)                      /* default operation */
     , hasCustomGUI(1)
     , latencyInSamples(0)
@@ -1278,6 +1295,7 @@ struct PluginDescriptor
 
     bool hasSidechain = false;		///< sidechain flag
 	bool processFrames = true;		///< want frames (default)
+	bool processDoublePrecision = false;	///< accept 64-bit buffers (VST3 kSample64)
 	bool wantsMIDI = true;			///< want MIDI (don't need to actually use it)
     bool hasCustomGUI = true;		///< default on
     uint32_t latencyInSamples = 0;	///< latency
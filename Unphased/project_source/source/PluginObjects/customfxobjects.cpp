@@ -22,6 +22,9 @@ AutoQEnvelopeFollower::AutoQEnvelopeFollower()
 	adParams.detect_dB = true;
 	adParams.clampToUnityMax = false;
 	detector.setParameters(adParams);
+
+	// --- calc threshold
+	threshValue = pow(10.0, parameters.threshold_dB / 20.0);
 } /* C-TOR */
 
 AutoQEnvelopeFollower::~AutoQEnvelopeFollower() = default; /* D-TOR */
@@ -40,6 +43,9 @@ void AutoQEnvelopeFollower::setParameters(const AutoQEnvelopeFollowerParameters&
 	updateFilterParameters(params);
 	updateDetectorParameters(params);
 
+	// --- calc threshold
+	threshValue = pow(10.0, params.threshold_dB / 20.0);
+
 	// --- save
 	parameters = params;
 }
@@ -48,17 +54,12 @@ bool AutoQEnvelopeFollower::canProcessAudioFrame() { return false; }
 
 double AutoQEnvelopeFollower::processAudioSample(double xn)
 {
-	// --- calc threshold
-	const double threshValue = pow(10.0, parameters.threshold_dB / 20.0);
-
 	// --- detect the signal
 	const double detect_dB = detector.processAudioSample(xn);
-	const double detectValue = pow(10.0, detect_dB / 20.0);
+	const double detectValue = parameters.useFastMath ? fastDB2Raw(detect_dB) : pow(10.0, detect_dB / 20.0);
 	const double deltaValue = detectValue - threshValue;
 
-	ZVAFilterParameters filterParams = filter.getParameters();
-	filterParams.fc = parameters.fc;
-	filterParams.Q = parameters.Q;
+	double fc = parameters.fc;
 
 	// --- if above the threshold, modulate the filter fc
 	if (deltaValue > 0.0) // || delta_dB > 0.0)
@@ -68,11 +69,11 @@ double AutoQEnvelopeFollower::processAudioSample(double xn)
 		const double modulatorValue = (deltaValue * parameters.sensitivity);
 
 		// --- calculate modulated frequency
-		filterParams.fc = doUnipolarModulationFromMin(modulatorValue, parameters.fc, kMaxFilterFrequency);
+		fc = doUnipolarModulationFromMin(modulatorValue, parameters.fc, kMaxFilterFrequency);
 	}
 
-	// --- update with new modulated frequency
-	filter.setParameters(filterParams);
+	// --- update with new modulated frequency; only the fc dependent coefficients are re-calculated
+	filter.setModulatedFc(fc);
 
 	// --- perform the filtering operation
 	return filter.processAudioSample(xn);
@@ -87,12 +88,17 @@ bool AutoQEnvelopeFollower::filterParametersUpdated(const ZVAFilterParameters fi
 		!isFloatEqual(filterParams.filterOutputGain_dB, params.filterOutputGain_dB) ||
 		filterParams.matchAnalogNyquistLPF != params.matchAnalogNyquistLPF ||
 		filterParams.enableNLP != params.enableNLP ||
-		filterParams.selfOscillate != params.selfOscillate;
+		filterParams.selfOscillate != params.selfOscillate ||
+		filterParams.useFastMath != params.useFastMath;
 }
 
 void AutoQEnvelopeFollower::updateFilterParameters(const AutoQEnvelopeFollowerParameters& params)
 {
 	ZVAFilterParameters filterParams = filter.getParameters();
+
+	// --- the filter fc is modulated in processAudioSample( ), so compare against the un-modulated value
+	filterParams.fc = parameters.fc;
+
 	if (filterParametersUpdated(filterParams, params))
 	{
 		filterParams.filterAlgorithm = params.filterAlgorithm;
@@ -103,13 +109,15 @@ void AutoQEnvelopeFollower::updateFilterParameters(const AutoQEnvelopeFollowerPa
 		filterParams.matchAnalogNyquistLPF = params.matchAnalogNyquistLPF;
 		filterParams.enableNLP = params.enableNLP;
 		filterParams.selfOscillate = params.selfOscillate;
+		filterParams.useFastMath = params.useFastMath;
 		filter.setParameters(filterParams);
 	}
 }
 bool AutoQEnvelopeFollower::detectorParametersUpdated(const AudioDetectorParameters adParams, const AutoQEnvelopeFollowerParameters& params)
 {
 	return !isFloatEqual(adParams.attackTime_mSec, params.attackTime_mSec) ||
-		!isFloatEqual(adParams.releaseTime_mSec, params.releaseTime_mSec);
+		!isFloatEqual(adParams.releaseTime_mSec, params.releaseTime_mSec) ||
+		adParams.useFastMath != params.useFastMath;
 }
 
 void AutoQEnvelopeFollower::updateDetectorParameters(const AutoQEnvelopeFollowerParameters& params)
@@ -120,6 +128,7 @@ void AutoQEnvelopeFollower::updateDetectorParameters(const AutoQEnvelopeFollower
 	{
 		adParams.attackTime_mSec = params.attackTime_mSec;
 		adParams.releaseTime_mSec = params.releaseTime_mSec;
+		adParams.useFastMath = params.useFastMath;
 		detector.setParameters(adParams);
 	}
 }
@@ -164,22 +173,29 @@ Phaser::~Phaser() = default;
 
 bool Phaser::reset(double _sampleRate)
 {
-	// --- reset LFO
-	lfo.reset(_sampleRate);
+	sampleRate = _sampleRate;
+
+	// --- reset LFO; it runs at the control rate
+	lfo.reset(sampleRate / controlRateInterval);
 
 	// --- reset APFs
-	for (auto& apf : apfs)
+	for (uint32_t i = 0; i < PHASER_STAGES; i++)
 	{
-		apf.reset(_sampleRate);
+		apfs[i].reset(_sampleRate);
+
+		// --- start the ramps from the current coefficients
+		memcpy(apfCoeffs[i], apfs[i].getCoefficients(), sizeof(double) * numCoeffs);
 	}
 
+	// --- force an update on the next sample, priming the LFO one control step ahead first
+	controlRateCounter = 0;
+	lfoPrimed = false;
+
 	return true;
 }
 
-double Phaser::processAudioSample(double xn)
+void Phaser::modulateApfs(const SignalGenData& lfoData)
 {
-	const SignalGenData lfoData = lfo.renderAudioOutput();
-
 	// --- create the bipolar modulator value
 	double lfoValue = lfoData.normalOutput;
 	if (parameters.quadPhaseLFO)
@@ -189,15 +205,64 @@ double Phaser::processAudioSample(double xn)
 	const double modulatorValue = lfoValue * depth;
 
 	const PhaserApfParameters* apfParams = getPhaserApfParameters();
-	double gammas[PHASER_STAGES];
-	double gamma = 1;
 	for (uint32_t i = 0; i < PHASER_STAGES; i++)
 	{
 		// --- calculate modulated values for each APF; note they have different ranges
 		AudioFilterParameters params = apfs[i].getParameters();
 		params.fc = doBipolarModulation(modulatorValue, apfParams[i].minF, apfParams[i].maxF);
 		apfs[i].setParameters(params);
+	}
+}
+
+void Phaser::updateModulation()
+{
+	// --- first update after a reset: the LFO value for now is where the ramps start, and from here on
+	//     the LFO is rendered one control step ahead, so each ramp ends on the value due when the next starts
+	if (!lfoPrimed)
+	{
+		modulateApfs(lfo.renderAudioOutput());
+		for (uint32_t i = 0; i < PHASER_STAGES; i++)
+			memcpy(apfCoeffs[i], apfs[i].getCoefficients(), sizeof(double) * numCoeffs);
+		lfoPrimed = true;
+	}
+
+	modulateApfs(lfo.renderAudioOutput());
+
+	const double rampScalar = 1.0 / controlRateInterval;
+	for (uint32_t i = 0; i < PHASER_STAGES; i++)
+	{
+		// --- ramp from the current coefficients to the new targets over the interval
+		const double* targetCoeffs = apfs[i].getCoefficients();
+		for (uint32_t j = 0; j < numCoeffs; j++)
+		{
+			apfCoeffsInc[i][j] = (targetCoeffs[j] - apfCoeffs[i][j]) * rampScalar;
+		}
+	}
+
+	controlRateCounter = controlRateInterval;
+}
+
+double Phaser::processAudioSample(double xn)
+{
+	// --- control rate update
+	if (controlRateCounter == 0)
+		updateModulation();
+	controlRateCounter--;
+
+	double gammas[PHASER_STAGES];
+	double gamma = 1;
+	for (uint32_t i = 0; i < PHASER_STAGES; i++)
+	{
+		// --- use the coefficients for this sample, then step them along their ramps for the next one
+		apfs[i].setCoefficients(apfCoeffs[i]);
+		for (uint32_t j = 0; j < numCoeffs; j++)
+		{
+			apfCoeffs[i][j] += apfCoeffsInc[i][j];
+		}
+	}
 
+	for (uint32_t i = 0; i < PHASER_STAGES; i++)
+	{
 		// --- calculate gamma values
 		gamma = apfs[PHASER_STAGES - (i + 1)].getG_value() * gamma;
 		gammas[i] = gamma;
@@ -243,6 +308,16 @@ bool Phaser::parametersUpdated(const OscillatorParameters lfoparams, const Phase
 
 void Phaser::updateParameters(const PhaserParameters& params)
 {
+	// --- a new control rate changes the LFO sample rate
+	const uint32_t interval = std::max(params.controlRateInterval, 1u);
+	if (interval != controlRateInterval)
+	{
+		controlRateInterval = interval;
+		lfo.reset(sampleRate / controlRateInterval);
+		controlRateCounter = 0;
+		lfoPrimed = false;
+	}
+
 	OscillatorParameters lfoparams = lfo.getParameters();
 
 	if (parametersUpdated(lfoparams, params))
@@ -1,3 +1,19 @@
+// -----------------------------------------------------------------------------
+//    customfxobjects.h
+//
+/**
+    \file   customfxobjects.h
+    \author Steve Dwyer
+    \brief  local copy of the custom FX objects (AutoQEnvelopeFollower, Phaser)
+
+    		NOTE: the plugins do not build this copy; AutoQ and Unphased include
+    		and compile ASPiKCommon/dsp/customfxobjects.h/.cpp, which lives
+    		outside this repository (see plugincore.h and cmake/<x>_cmake/CMakeLists.txt).
+    		Tools/fxbench and Tools/fxrender build this copy, so changes made here
+    		(e.g. setModulatedFc( ) in AutoQEnvelopeFollower, the control rate
+    		Phaser LFO) only reach the plugins once they are ported to ASPiKCommon.
+*/
+// -----------------------------------------------------------------------------
 #pragma once
 #include "fxobjects.h"
 
@@ -43,6 +59,7 @@ struct AutoQEnvelopeFollowerParameters
 		releaseTime_mSec = params.releaseTime_mSec;
 		threshold_dB = params.threshold_dB;
 		sensitivity = params.sensitivity;
+		useFastMath = params.useFastMath;
 
 		return *this;
 	}
@@ -66,6 +83,8 @@ struct AutoQEnvelopeFollowerParameters
 	double releaseTime_mSec = 500.0; ///< detector release time
 	double threshold_dB = -6.0; ///< detector threshold in dB
 	double sensitivity = 1.0; ///< detector sensitivity
+
+	bool useFastMath = true; ///< fast dB conversions and NLP in the detector and filter; false for the <math.h> versions
 };
 
 /**
@@ -86,7 +105,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2021/ 09 / 06
 */
-class AutoQEnvelopeFollower : public IAudioSignalProcessor
+class AutoQEnvelopeFollower : public BlockProcessorMixin<AutoQEnvelopeFollower>
 {
 public:
 	AutoQEnvelopeFollower(); /* C-TOR */
@@ -132,6 +151,8 @@ protected:
 	ZVAFilter filter; ///< filter to modulate
 	AudioDetector detector; ///< detector to track input signal
 
+	double threshValue = 0.0; ///< detector threshold as a raw value
+
 private:
 	virtual bool filterParametersUpdated(ZVAFilterParameters filterParams, const AutoQEnvelopeFollowerParameters& params);
 
@@ -173,6 +194,7 @@ struct PhaserParameters
 		lfoDepth_Pct = params.lfoDepth_Pct;
 		intensity_Pct = params.intensity_Pct;
 		quadPhaseLFO = params.quadPhaseLFO;
+		controlRateInterval = params.controlRateInterval;
 		return *this;
 	}
 
@@ -181,7 +203,8 @@ struct PhaserParameters
 		  lfoRate_Hz{params.lfoRate_Hz},
 		  lfoDepth_Pct{params.lfoDepth_Pct},
 		  intensity_Pct{params.intensity_Pct},
-		  quadPhaseLFO{params.quadPhaseLFO}
+		  quadPhaseLFO{params.quadPhaseLFO},
+		  controlRateInterval{params.controlRateInterval}
 	{
 	}
 
@@ -194,6 +217,7 @@ struct PhaserParameters
 	double lfoDepth_Pct = 0.0;	///< phaser LFO depth in %
 	double intensity_Pct = 0.0;	///< phaser feedback in %
 	bool quadPhaseLFO = false;	///< quad phase LFO flag
+	uint32_t controlRateInterval = 16;	///< LFO update interval in samples; APF coefficients are interpolated in between
 };
 
 struct PhaserApfParameters
@@ -221,12 +245,19 @@ Control I/F:
 - Use BiquadParameters structure to get/set object params.
 Custom parameter structure for the PhaserParameters object.
 
+Modulation:
+- The LFO runs at a control rate of one update every controlRateInterval samples; at each update the
+  APF coefficients are calculated for the new LFO value and then linearly interpolated, per sample,
+  until the next update.
+- The LFO is primed one control step ahead after a reset, so each ramp starts on the LFO value due at
+  its first sample and ends on the value due when the next ramp starts; the sweep does not lag the LFO.
+
 \author Steve Dwyer - Adapted from Will Pirkle http://www.willpirkle.com
 \remark This object is based on the PhaseShifter class included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
 \date Date : 2021 / 09 / 06
 */
-class Phaser : public IAudioSignalProcessor
+class Phaser : public BlockProcessorMixin<Phaser>
 {
 public:
 	Phaser();	/* C-TOR */
@@ -269,7 +300,17 @@ public:
 protected:
 	PhaserParameters parameters;  ///< the object parameters
 	AudioFilter apfs[PHASER_STAGES];		///< six APF objects
-	LFO lfo;							///< the one and only LFO
+	LFO lfo;							///< the one and only LFO, running at the control rate
+
+	double sampleRate = 44100.0;		///< current sample rate
+	uint32_t controlRateInterval = 16;	///< LFO update interval in samples
+	uint32_t controlRateCounter = 0;	///< samples remaining until the next LFO update
+	double apfCoeffs[PHASER_STAGES][numCoeffs] = {};	///< interpolated APF coefficients
+	double apfCoeffsInc[PHASER_STAGES][numCoeffs] = {};	///< per-sample APF coefficient increments
+	bool lfoPrimed = false;				///< cleared by a reset; the next update renders the ramp start first
+
+	/** set the APF cutoffs for an LFO output, with the current depth */
+	void modulateApfs(const SignalGenData& lfoData);
 
 private:
 	// --- these are the ideal band definitions
@@ -294,6 +335,8 @@ private:
 
 	virtual void updateParameters(const PhaserParameters& params);
 
+	virtual void updateModulation();
+
 	virtual const PhaserApfParameters* getPhaserApfParameters();
 
 	virtual PhaserMixCoeffs getPhaserMixCoeffs();
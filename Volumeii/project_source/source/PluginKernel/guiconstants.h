@@ -19,8 +19,21 @@
 #include <stdlib.h>
 #include <vector>
 #include <string>
+#include <atomic>
+#include <memory>
 #include <math.h>
 
+// --- flush-to-zero/denormals-are-zero control for DenormalGuard
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#include <xmmintrin.h>
+	#define DENORMAL_GUARD_SSE 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+	#endif
+	#define DENORMAL_GUARD_ARM64 1
+#endif
+
 // --- RESERVED PARAMETER ID VALUES
 const unsigned int PLUGIN_SIDE_BYPASS = 131072; ///<RESERVED PARAMETER ID VALUE
 const unsigned int XY_TRACKPAD = 131073;		///<RESERVED PARAMETER ID VALUE
@@ -332,6 +345,12 @@ public:
 		a = exp(-kTwoPi / (smoothingTimeInMSec * 0.001 * sampleRate));
 		b = 1.0 - a;
 
+		// --- a^1..a^4 for the block smoother
+		aPowers[0] = a;
+		aPowers[1] = a * a;
+		aPowers[2] = aPowers[1] * a;
+		aPowers[3] = aPowers[1] * aPowers[1];
+
 		// --- for linear smoother
 		linInc = (maxVal - minVal) / (smoothingTimeInMSec * 0.001 * sampleRate);
 	}
@@ -355,6 +374,7 @@ public:
 		maxVal = maxControlValue;
 		sampleRate = samplingRate;
 		smoothingTimeInMSec = smoothingTimeInMs;
+		smootherType = smoother;
 
 		setSampleRate(samplingRate);
 
@@ -369,10 +389,112 @@ public:
 	\return true if smoothing occurred, false otherwise (e.g. once control has assumed final value, smoothing is turned off)
 	*/
 	inline bool smoothParameter(T in, T& out)
+	{
+		return smoothStep(in, out, a, b, linInc);
+	}
+
+	/**perform a partial smoothing operation, e.g. for the short last block of a buffer when the smoother is
+	clocked once per block; the LPF moves by a^stepFraction and the linear smoother by stepFraction*linInc
+	\param in input sample
+	\param out smoothed value
+	\param stepFraction fraction of a full step, e.g. samples in the block / the full block size
+	\return true if smoothing occurred, false otherwise
+	*/
+	inline bool smoothParameter(T in, T& out, T stepFraction)
+	{
+		if (stepFraction >= 1.0)
+			return smoothStep(in, out, a, b, linInc);
+
+		const T aStep = pow(a, stepFraction);
+		return smoothStep(in, out, aStep, 1.0 - aStep, linInc * stepFraction);
+	}
+
+	/**perform the smoothing operation for a block of samples, writing one smoothed value per sample into ramp;
+	this is the block version of smoothParameter( ) for objects that consume per-sample parameter arrays (gain,
+	delay time, fc...), with the smoother clocked at the audio sample rate
+	- the number of steps to the target is calculated up front, so the end of the ramp is exact: the final step
+	  lands on in, after which the smoother is idle; the LPF smoother ends once it is within 1e-7 of the control
+	  range of the target, below the resolution of the (float) control value
+	- the linear and target fills have no branches or loop-carried dependencies so the compiler can vectorize
+	  them; the LPF fill carries one multiply per four samples (d *= a^4), with the four stores of a pass
+	  independent of each other, instead of the per-sample z = a*z recurrence of smoothParameter( )
+	\param in target value
+	\param ramp array of at least numSamples values to fill
+	\param numSamples number of samples
+	\return the number of samples before the target was reached: ramp[i] == in for every i >= the return value;
+	        numSamples means the ramp may continue into the next block
+	*/
+	inline uint32_t smoothParameterBlock(T in, T* ramp, uint32_t numSamples)
+	{
+		// --- steps to the target; step k (k = 1...) lands in ramp[k - 1]
+		const T distance = in - z;
+		const T absDistance = distance < 0.0 ? -distance : distance;
+		double steps = 0.0;
+		if (absDistance > 0.0)
+		{
+			if (smootherType == smoothingMethod::kLPFSmoother)
+			{
+				// --- z(k) = in - distance*a^k
+				const T threshold = (maxVal - minVal) * 1.0e-7;
+				if (absDistance <= threshold || a <= 0.0)
+					steps = 1.0;
+				else if (a >= 1.0)
+					steps = (double)numSamples + 1.0; // --- frozen; never arrives
+				else
+					steps = ceil(log(threshold / absDistance) / log(a));
+			}
+			else
+				steps = linInc > 0.0 ? ceil(absDistance / linInc) : 1.0;
+		}
+
+		// --- samples that are still moving; step 'steps' is the target itself
+		const uint32_t moving = steps - 1.0 < (double)numSamples ? (uint32_t)(steps > 1.0 ? steps - 1.0 : 0.0) : numSamples;
+
+		if (smootherType == smoothingMethod::kLPFSmoother)
+		{
+			// --- four samples per pass from a^1..a^4, then advance the distance by a^4
+			T d = distance;
+			uint32_t i = 0;
+			for (; i + 4 <= moving; i += 4)
+			{
+				ramp[i] = in - d * aPowers[0];
+				ramp[i + 1] = in - d * aPowers[1];
+				ramp[i + 2] = in - d * aPowers[2];
+				ramp[i + 3] = in - d * aPowers[3];
+				d *= aPowers[3];
+			}
+			for (; i < moving; i++)
+			{
+				d *= a;
+				ramp[i] = in - d;
+			}
+		}
+		else
+		{
+			const T step = distance < 0.0 ? -linInc : linInc;
+			for (uint32_t i = 0; i < moving; i++)
+				ramp[i] = z + step * (T)(i + 1);
+		}
+
+		// --- the rest of the block sits on the target
+		for (uint32_t i = moving; i < numSamples; i++)
+			ramp[i] = in;
+
+		// --- update state
+		if (numSamples > 0)
+			z = ramp[numSamples - 1];
+		z2 = z;
+
+		return moving;
+	}
+
+private:
+	/** one smoothing step with the given LPF coefficients and linear increment */
+	inline bool smoothStep(T in, T& out, T aStep, T bStep, T linStep)
 	{
 		if (smootherType == smoothingMethod::kLPFSmoother)
 		{
-			z = (in * b) + (z * a);
+			z = (in * bStep) + (z * aStep);
 			if (z == z2)
 			{
 				out = in;
@@ -391,12 +513,12 @@ public:
 			}
 			if (in > z)
 			{
-				z += linInc;
+				z += linStep;
 				if (z > in) z = in;
 			}
 			else if (in < z)
 			{
-				z -= linInc;
+				z -= linStep;
 				if (z < in) z = in;
 			}
 			out = z;
@@ -404,9 +526,9 @@ public:
 		}
 	}
 
-private:
 	T a = 0.0;		///< a coefficient for smoothing
 	T b = 0.0;		///< b coefficient for smoothing
+	T aPowers[4] = { 0.0, 0.0, 0.0, 0.0 };	///< a^1, a^2, a^3, a^4 for the block smoother
 	T z = 0.0;		///< storage register
 	T z2 = 0.0;		///< storage register
 
@@ -421,5 +543,316 @@ private:
 	smoothingMethod smootherType = smoothingMethod::kLPFSmoother; ///< smoothing type
 };
 
+/**
+\class MeterAccumulator
+\ingroup ASPiK-Core
+\brief
+The MeterAccumulator object collects the peak of a meter signal on the audio thread so that transients
+between GUI repaints are not lost. It tracks windows of GUI_METER_UPDATE_INTERVAL_MSEC and reports the peak
+of the current window merged with the last complete one, so every peak stays visible for at least one
+repaint interval.
+
+It does no envelope detection: the published value is the raw peak level, and the meter view's own detector
+applies the parameter's detector mode (peak, MS, RMS) and ballistics at the repaint rate, as it did with the
+bound variable. Detecting here as well would square an MS meter twice.
+
+There are no atomics here; PluginParameter publishes getMeterValue( ) with one atomic store per buffer.
+A plugin may feed it directly with accumulate( ) or accumulateBlock( ); otherwise PluginBase feeds it
+the bound meter variable once per frame, or once per block held for the block length.
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+class MeterAccumulator
+{
+public:
+	MeterAccumulator() {}
+
+	/** set the sample rate and clear the windows
+	\param sampleRate the audio sample rate (not the block rate)
+	*/
+	void reset(double sampleRate)
+	{
+		double windowLength_Samples = GUI_METER_UPDATE_INTERVAL_MSEC * 0.001 * sampleRate;
+		windowLength = windowLength_Samples > 1.0 ? (uint32_t)windowLength_Samples : 1;
+
+		peak = 0.0;
+		count = 0;
+		lastPeak = 0.0;
+		directInput = false;
+	}
+
+	/** add one sample (or one frame's summed value) */
+	inline void accumulate(double xn)
+	{
+		directInput = true;
+
+		double magnitude = fabs(xn);
+		if (magnitude > peak)
+			peak = magnitude;
+
+		if (++count >= windowLength)
+			closeWindow();
+	}
+
+	/** add a block of multichannel audio, e.g. the outputs of ProcessBlockInfo; each frame counts once, with the
+	    peak taken across the channels
+	\param channels array of channel pointers; float, or double for 64-bit host buffers
+	\param numChannels number of channels
+	\param startIndex first sample in each channel
+	\param numSamples number of frames
+	*/
+	template <typename ChannelType>
+	void accumulateBlock(ChannelType** channels, uint32_t numChannels, uint32_t startIndex, uint32_t numSamples)
+	{
+		if (numChannels == 0)
+			return;
+
+		directInput = true;
+
+		uint32_t sample = startIndex;
+		const uint32_t endIndex = startIndex + numSamples;
+		while (sample < endIndex)
+		{
+			// --- run up to the end of the block or of the window, whichever is first
+			const uint32_t windowEnd = sample + (windowLength - count);
+			const uint32_t stop = windowEnd < endIndex ? windowEnd : endIndex;
+			double blockPeak = peak;
+			for (uint32_t channel = 0; channel < numChannels; channel++)
+			{
+				const ChannelType* x = channels[channel];
+				for (uint32_t i = sample; i < stop; i++)
+				{
+					double magnitude = fabs(x[i]);
+					blockPeak = magnitude > blockPeak ? magnitude : blockPeak;
+				}
+			}
+
+			peak = blockPeak;
+			count += stop - sample;
+			sample = stop;
+
+			if (count >= windowLength)
+				closeWindow();
+		}
+	}
+
+	/** add a value held for numSamples; used by PluginBase for bound meter variables */
+	void accumulateHeld(double xn, uint32_t numSamples)
+	{
+		double magnitude = fabs(xn);
+		while (numSamples > 0)
+		{
+			uint32_t n = windowLength - count;
+			if (n > numSamples)
+				n = numSamples;
+
+			if (magnitude > peak)
+				peak = magnitude;
+			count += n;
+			numSamples -= n;
+
+			if (count >= windowLength)
+				closeWindow();
+		}
+	}
+
+	/** true if accumulate( ) or accumulateBlock( ) was called since the last call; clears the flag */
+	bool takeDirectInput()
+	{
+		bool direct = directInput;
+		directInput = false;
+		return direct;
+	}
+
+	/** read the meter; the peak |x| over the current and last windows, before envelope detection
+	\return the meter value
+	*/
+	double getMeterValue()
+	{
+		return peak > lastPeak ? peak : lastPeak;
+	}
+
+private:
+	/** the current window becomes the last one */
+	void closeWindow()
+	{
+		lastPeak = peak;
+		peak = 0.0;
+		count = 0;
+	}
+
+	double peak = 0.0;				///< peak |x| in current window
+	uint32_t count = 0;				///< samples in current window
+	double lastPeak = 0.0;			///< peak |x| in last complete window
+	uint32_t windowLength = 2205;	///< window length = GUI_METER_UPDATE_INTERVAL_MSEC in samples
+	bool directInput = false;		///< plugin fed the accumulator since the last takeDirectInput( )
+};
+
+/**
+\class ParameterDirtySet
+\ingroup ASPiK-Core
+\brief
+The ParameterDirtySet object is a lock-free bitset of parameter indexes, one bit per parameter. Any thread
+may mark a parameter with set( ); the audio thread drains the set with takeAll( ), which atomically takes
+and clears one 64-bit word at a time and visits only the set bits, so per-buffer work is proportional to the
+number of parameters that moved rather than the total parameter count.
+
+A value written with a relaxed store before set( ) is visible to the function called by takeAll( ) (the
+word update is release/acquire). resize( ) allocates and must not be called while audio is running.
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+class ParameterDirtySet
+{
+public:
+	ParameterDirtySet() {}
+
+	/** allocate the bitset (all bits clear); not real-time safe
+	\param _numBits the number of parameters
+	*/
+	void resize(uint32_t _numBits)
+	{
+		numBits = _numBits;
+		numWords = (numBits + 63) / 64;
+		words.reset(numWords > 0 ? new std::atomic<uint64_t>[numWords] : nullptr);
+		for (uint32_t i = 0; i < numWords; i++)
+			words[i].store(0, std::memory_order_relaxed);
+	}
+
+	/** mark one index; lock-free, callable from any thread */
+	inline void set(uint32_t index)
+	{
+		if (index < numBits)
+			words[index >> 6].fetch_or(uint64_t(1) << (index & 63), std::memory_order_release);
+	}
+
+	/** mark every index, e.g. to force a full sync after a reset */
+	void setAll()
+	{
+		for (uint32_t i = 0; i < numWords; i++)
+		{
+			const uint32_t bitsInWord = i == numWords - 1 && (numBits & 63) ? (numBits & 63) : 64;
+			words[i].fetch_or(bitsInWord == 64 ? ~uint64_t(0) : (uint64_t(1) << bitsInWord) - 1, std::memory_order_release);
+		}
+	}
+
+	/** take and clear the set, calling function(index) once for each marked index in ascending order;
+	    an index marked while this runs is either visited now or left set for the next call
+	\param function the callable to invoke with each marked index
+	*/
+	template <class Function>
+	inline void takeAll(Function function)
+	{
+		for (uint32_t i = 0; i < numWords; i++)
+		{
+			// --- cheap test before the read-modify-write
+			if (words[i].load(std::memory_order_relaxed) == 0)
+				continue;
+
+			uint64_t bits = words[i].exchange(0, std::memory_order_acquire);
+			while (bits)
+			{
+				function((i << 6) + lowestBitIndex(bits));
+				bits &= bits - 1;
+			}
+		}
+	}
+
+	/** \return the number of indexes */
+	uint32_t size() const { return numBits; }
+
+private:
+	std::unique_ptr<std::atomic<uint64_t>[]> words;	///< the bits, 64 parameters per word
+	uint32_t numWords = 0;							///< number of words
+	uint32_t numBits = 0;							///< number of parameters
+
+	/** index of the lowest set bit (bits != 0); de Bruijn multiply so there are no compiler intrinsics */
+	static inline uint32_t lowestBitIndex(uint64_t bits)
+	{
+		static const uint32_t deBruijnIndex[64] = {
+			 0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+			62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+			63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+			46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6 };
+
+		return deBruijnIndex[((bits & (~bits + 1)) * 0x03f79d71b4cb0a89ULL) >> 58];
+	}
+};
+
+/**
+\class DenormalGuard
+\ingroup ASPiK-Core
+\brief
+The DenormalGuard object sets flush-to-zero and denormals-are-zero for the current thread while it is
+in scope and restores the previous state when it goes out of scope. PluginBase holds one around
+processAudioBuffers( ), so decaying feedback (reverb and delay tails, filter states) never drops into
+the slow denormal range and the FX objects do not need per-sample underflow checks.
+
+- x86/x64: MXCSR FTZ (bit 15) and DAZ (bit 6)
+- ARM64: FPCR FZ (bit 24), which covers both
+- other targets: does nothing; fxobjects.h then keeps its per-sample checks (FXOBJECTS_CHECK_UNDERFLOW)
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+class DenormalGuard
+{
+public:
+	DenormalGuard()
+	{
+#if defined(DENORMAL_GUARD_SSE)
+		previousState = _mm_getcsr();
+		_mm_setcsr(previousState | 0x8040);
+#elif defined(DENORMAL_GUARD_ARM64)
+		previousState = readFPCR();
+		writeFPCR(previousState | (1ULL << 24));
+#endif
+	}
+
+	~DenormalGuard()
+	{
+#if defined(DENORMAL_GUARD_SSE)
+		_mm_setcsr(previousState);
+#elif defined(DENORMAL_GUARD_ARM64)
+		writeFPCR(previousState);
+#endif
+	}
+
+	DenormalGuard(const DenormalGuard&) = delete;
+	DenormalGuard& operator=(const DenormalGuard&) = delete;
+
+private:
+#if defined(DENORMAL_GUARD_SSE)
+	unsigned int previousState = 0;	///< MXCSR on entry
+#elif defined(DENORMAL_GUARD_ARM64)
+	uint64_t previousState = 0;		///< FPCR on entry
+
+	static inline uint64_t readFPCR()
+	{
+	#if defined(_MSC_VER) && !defined(__clang__)
+		return (uint64_t)_ReadStatusReg(ARM64_FPCR);
+	#else
+		uint64_t fpcr = 0;
+		__asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+		return fpcr;
+	#endif
+	}
+
+	static inline void writeFPCR(uint64_t fpcr)
+	{
+	#if defined(_MSC_VER) && !defined(__clang__)
+		_WriteStatusReg(ARM64_FPCR, (__int64)fpcr);
+	#else
+		__asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+	#endif
+	}
+#endif
+};
+
 
 #endif
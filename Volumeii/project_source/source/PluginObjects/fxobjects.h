@@ -20,11 +20,44 @@
 #pragma once
 
 #include <memory>
+#include <new>
+#include <cstring>
+#include <type_traits>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 #include <math.h>
 #include "guiconstants.h"
-#include "filters.h"
 #include <time.h>       /* time */
 
+// --- SIMD support for the bank objects; define FXOBJECTS_NO_SIMD to force the scalar code
+#if !defined(FXOBJECTS_NO_SIMD)
+	#if defined(__AVX__)
+		#include <immintrin.h>
+		#define FXOBJECTS_AVX 1
+		#define FXOBJECTS_SSE2 1
+	#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#include <emmintrin.h>
+		#define FXOBJECTS_SSE2 1
+	#elif defined(__aarch64__) || defined(_M_ARM64)
+		#include <arm_neon.h>
+		#define FXOBJECTS_NEON 1
+	#endif
+#endif
+
+// --- per-sample underflow checks in the recursive loops; off by default where the plugin kernel's
+//     DenormalGuard can set flush-to-zero/denormals-are-zero (guiconstants.h), define as 1 to force them
+#if !defined(FXOBJECTS_CHECK_UNDERFLOW)
+	#if defined(DENORMAL_GUARD_SSE) || defined(DENORMAL_GUARD_ARM64)
+		#define FXOBJECTS_CHECK_UNDERFLOW 0
+	#else
+		#define FXOBJECTS_CHECK_UNDERFLOW 1
+	#endif
+#endif
+
 /** @file fxobjects.h
 \brief FX Objects File
 */
@@ -72,6 +105,50 @@ inline bool checkFloatUnderflow(double& value)
 	return retValue;
 }
 
+/**
+@checkFloatUnderflow
+\ingroup FX-Functions
+
+@brief Perform underflow check on a float; returns true if we did underflow (user may not care)
+
+\param value - the value to check for underflow
+\return true if overflowed, false otherwise
+*/
+inline bool checkFloatUnderflow(float& value)
+{
+	bool retValue = false;
+	if (value > 0.0f && value < (float)kSmallestPositiveFloatValue)
+	{
+		value = 0;
+		retValue = true;
+	}
+	else if (value < 0.0f && value > (float)kSmallestNegativeFloatValue)
+	{
+		value = 0;
+		retValue = true;
+	}
+	return retValue;
+}
+
+/**
+@checkOptionalFloatUnderflow
+\ingroup FX-Functions
+
+@brief Underflow check for the recursive per-sample loops; compiled out when FXOBJECTS_CHECK_UNDERFLOW is 0,
+where the plugin runs with flush-to-zero/denormals-are-zero set instead (see DenormalGuard)
+
+\param value - the value to check for underflow
+*/
+template <typename T>
+inline void checkOptionalFloatUnderflow(T& value)
+{
+#if FXOBJECTS_CHECK_UNDERFLOW
+	checkFloatUnderflow(value);
+#else
+	(void)value;
+#endif
+}
+
 /**
 @doLinearInterpolation
 \ingroup FX-Functions
@@ -316,6 +393,31 @@ inline double dBPeakGainFor_Q(double Q)
 	return raw2dB(peakGainFor_Q(Q));
 }
 
+/**
+@fastTan
+\ingroup FX-Functions
+
+@brief fast tan( ) approximation for bilinear prewarping; uses a [5/4] Pade approximant on [0, pi/4]
+and reflects the upper half of the range with tan(x) = 1/tan(pi/2 - x)
+
+- relative error is less than 2e-8 on the range [0, pi/2)
+
+\param x - the argument in radians on the range [0, pi/2)
+\return the approximated tan(x)
+*/
+inline double fastTan(double x)
+{
+	if (x > kPi / 4.0)
+	{
+		double y = kPi / 2.0 - x;
+		double y2 = y*y;
+		return (945.0 - 420.0*y2 + 15.0*y2*y2) / (y*(945.0 - 105.0*y2 + y2*y2));
+	}
+
+	double x2 = x*x;
+	return x*(945.0 - 105.0*x2 + x2*x2) / (945.0 - 420.0*x2 + 15.0*x2*x2);
+}
+
 /**
 @doWhiteNoise
 \ingroup FX-Functions
@@ -432,6 +534,227 @@ inline double fuzzExp1WaveShaper(double xn, double saturation, double asymmetry)
 	return sgn(xn)*(1.0 - exp(-fabs(wsGain*xn))) / (1.0 - exp(-wsGain));
 }
 
+// --- fast math
+//
+// --- exp2/log2 based replacements for the transcendental calls in the per-sample paths. Every function
+//     is branch free and uses no tables or int64 <-> double conversions, so loops over them auto-vectorize
+//     (GCC needs -fno-trapping-math to turn the selects into blends). Scalar they are 1.2 to 3 times faster
+//     than <math.h>, vectorized with AVX 5 to 10 times. The error bounds below were measured against the
+//     <math.h> versions over the stated ranges. Objects that use them have a useFastMath switch (default
+//     true) to select the exact versions instead.
+const double kLog2Of10Over20 = 0.16609640474436811;		///< log2(10)/20: dB -> log2
+const double k20Log10Of2 = 6.0205999132796239;			///< 20*log10(2): log2 -> dB
+const double kLog2OfE = 1.4426950408889634;				///< log2(e)
+const double kLn2 = 0.69314718055994531;				///< ln(2)
+const double kFastMathMinRaw = 2.2250738585072014e-308;	///< smallest normal double; fastRaw2dB( ) input floor
+
+/**
+@fastExp2
+\ingroup FX-Functions
+
+@brief fast 2^x; the integer part of x is built directly into the exponent bits and 2^f for the
+remainder f on [-0.5, +0.5] is a degree 7 Taylor polynomial of e^(f*ln2)
+
+- relative error is less than 1e-8 (1e-7 dB)
+- x is clamped to [-1022, +1023] so the result is always a normal number (no inf, no denormals)
+
+\param x - the exponent
+\return the approximated 2^x
+*/
+inline double fastExp2(double x)
+{
+	// --- selects rather than fmin( )/fmax( ), which are calls unless NaN handling is relaxed
+	x = x > -1022.0 ? x : -1022.0;
+	x = x < 1023.0 ? x : 1023.0;
+
+	// --- round to nearest with the 1.5*2^52 trick: n is in the low bits of shifted, then split off the remainder
+	const double shifted = x + 6755399441055744.0;
+	const double n = shifted - 6755399441055744.0;
+	const double g = (x - n)*kLn2;
+
+	// --- e^g on [-ln2/2, +ln2/2]
+	const double p = 1.0 + g*(1.0 + g*(1.0 / 2.0 + g*(1.0 / 6.0 + g*(1.0 / 24.0 + g*(1.0 / 120.0 + g*(1.0 / 720.0 + g*(1.0 / 5040.0)))))));
+
+	// --- scale by 2^n; the shift keeps only the (biased) n from the bits of shifted, so there is no
+	//     double -> int64 conversion (which has no SIMD instruction before AVX-512)
+	uint64_t scaleBits = 0;
+	memcpy(&scaleBits, &shifted, sizeof(double));
+	scaleBits = (scaleBits + 1023) << 52;
+	double scale = 0.0;
+	memcpy(&scale, &scaleBits, sizeof(double));
+	return p*scale;
+}
+
+/**
+@fastLog2
+\ingroup FX-Functions
+
+@brief fast log2(x); the exponent is read from the bits of x with the mantissa m normalized to
+[sqrt(0.5), sqrt(2)) and log2(m) is the atanh series 2*atanh(s)/ln2, s = (m - 1)/(m + 1), to s^9
+
+- absolute error is less than 2e-9 (1.2e-8 dB)
+- x must be a positive, finite, normal number; see fastRaw2dB( ) for a safe version
+
+\param x - the argument
+\return the approximated log2(x)
+*/
+inline double fastLog2(double x)
+{
+	uint64_t bits = 0;
+	memcpy(&bits, &x, sizeof(double));
+
+	// --- subtracting the bits of sqrt(0.5) puts the exponent of x/sqrt(0.5) in the top bits
+	const int64_t exponent = (int64_t)(bits - 0x3fe6a09e667f3bcdULL) >> 52;
+	bits -= (uint64_t)exponent << 52;
+	double m = 0.0;
+	memcpy(&m, &bits, sizeof(double));
+
+	const double s = (m - 1.0) / (m + 1.0);
+	const double s2 = s*s;
+	const double lnM = 2.0*s*(1.0 + s2*(1.0 / 3.0 + s2*(1.0 / 5.0 + s2*(1.0 / 7.0 + s2*(1.0 / 9.0)))));
+
+	// --- the exponent to double with the 1.5*2^52 trick in reverse (no int64 -> double conversion)
+	const uint64_t exponentBits = (uint64_t)exponent + 0x4338000000000000ULL;
+	double e = 0.0;
+	memcpy(&e, &exponentBits, sizeof(double));
+
+	return (e - 6755399441055744.0) + lnM*kLog2OfE;
+}
+
+/**
+@fastDB2Raw
+\ingroup FX-Functions
+
+@brief fast dB2Raw( ) using fastExp2( )
+
+- relative error is less than 1e-8 (1e-7 dB) for dB on [-6000, +6000]; below that the result is
+  clamped to 2^-1022 where dB2Raw( ) returns 0.0
+
+\param dB - value to convert to raw
+\return the raw value
+*/
+inline double fastDB2Raw(double dB)
+{
+	return fastExp2(dB*kLog2Of10Over20);
+}
+
+/**
+@fastRaw2dB
+\ingroup FX-Functions
+
+@brief fast raw2dB( ) using fastLog2( )
+
+- absolute error is less than 1.2e-8 dB
+- raw values below the smallest normal double, including 0.0, negative values and NaN, return
+  about -6153 dB where raw2dB( ) returns -inf or NaN
+
+\param raw - value to convert to dB
+\return the dB value
+*/
+inline double fastRaw2dB(double raw)
+{
+	return k20Log10Of2*fastLog2(raw > kFastMathMinRaw ? raw : kFastMathMinRaw);
+}
+
+/**
+@fastTanh
+\ingroup FX-Functions
+
+@brief fast tanh( ) from fastExp2( ): tanh(|x|) = (e - 1)/(e + 1) with e = exp(2|x|)
+
+- absolute error is less than 5e-9 for all x; the output saturates to exactly +/-1.0
+
+\param x - the argument
+\return the approximated tanh(x)
+*/
+inline double fastTanh(double x)
+{
+	const double e = fastExp2(2.0*kLog2OfE*fabs(x));
+	return copysign((e - 1.0) / (e + 1.0), x);
+}
+
+/**
+@fastAtan
+\ingroup FX-Functions
+
+@brief fast atan( ) using the degree 17 odd polynomial from Abramowitz and Stegun 4.4.49 on [0, 1]
+and atan(x) = pi/2 - atan(1/x) above that
+
+- absolute error is less than 2e-8 radians for all x
+
+\param x - the argument
+\return the approximated atan(x)
+*/
+inline double fastAtan(double x)
+{
+	const double absX = fabs(x);
+	const double z = absX > 1.0 ? 1.0 / absX : absX;
+	const double z2 = z*z;
+	const double atanZ = z*(1.0 + z2*(-0.3333314528 + z2*(0.1999355085 + z2*(-0.1420889944 + z2*(0.1065626393 +
+						 z2*(-0.0752896400 + z2*(0.0429096138 + z2*(-0.0161657367 + z2*0.0028662257))))))));
+
+	return copysign(absX > 1.0 ? kPi / 2.0 - atanZ : atanZ, x);
+}
+
+/**
+@fastAtanWaveShaper
+\ingroup FX-Functions
+
+@brief atanWaveShaper( ) using fastAtan( )
+\param xn - the input value
+\param saturation  - the saturation control
+\return the waveshaped output value
+*/
+inline double fastAtanWaveShaper(double xn, double saturation)
+{
+	return fastAtan(saturation*xn) / fastAtan(saturation);
+}
+
+/**
+@fastTanhWaveShaper
+\ingroup FX-Functions
+
+@brief tanhWaveShaper( ) using fastTanh( )
+\param xn - the input value
+\param saturation  - the saturation control
+\return the waveshaped output value
+*/
+inline double fastTanhWaveShaper(double xn, double saturation)
+{
+	return fastTanh(saturation*xn) / fastTanh(saturation);
+}
+
+/**
+@fastSoftClipWaveShaper
+\ingroup FX-Functions
+
+@brief softClipWaveShaper( ) using fastExp2( )
+\param xn - the input value
+\param saturation  - the saturation control
+\return the waveshaped output value
+*/
+inline double fastSoftClipWaveShaper(double xn, double saturation)
+{
+	return sgn(xn)*(1.0 - fastExp2(-kLog2OfE*fabs(saturation*xn)));
+}
+
+/**
+@fastFuzzExp1WaveShaper
+\ingroup FX-Functions
+
+@brief fuzzExp1WaveShaper( ) using fastExp2( )
+\param xn - the input value
+\param saturation  - the saturation control
+\param asymmetry  - the degree of asymmetry
+\return the waveshaped output value
+*/
+inline double fastFuzzExp1WaveShaper(double xn, double saturation, double asymmetry)
+{
+	// --- setup gain
+	double wsGain = calcWSGain(xn, saturation, asymmetry);
+	return sgn(xn)*(1.0 - fastExp2(-kLog2OfE*fabs(wsGain*xn))) / (1.0 - fastExp2(-kLog2OfE*wsGain));
+}
+
 
 /**
 @getMagResponse
@@ -992,6 +1315,108 @@ inline void freqSample(int N, double A[], double h[], int symm)
 	}
 }
 
+/**
+@fftRadix2
+\ingroup FX-Functions
+
+@brief in-place radix-2 complex FFT that does not need FFTW; unnormalized in both directions
+
+\param re - the real parts, N values
+\param im - the imaginary parts, N values
+\param N - the FFT length, a power of 2
+\param inverse - true for the inverse transform
+*/
+inline void fftRadix2(double* re, double* im, unsigned int N, bool inverse)
+{
+	// --- bit reversed ordering
+	for (unsigned int i = 1, j = 0; i < N; i++)
+	{
+		unsigned int bit = N >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+
+		if (i < j)
+		{
+			std::swap(re[i], re[j]);
+			std::swap(im[i], im[j]);
+		}
+	}
+
+	// --- butterflies; the twiddle factors are rotated with the trig recurrence, one sin( ) pair per stage
+	for (unsigned int span = 1; span < N; span <<= 1)
+	{
+		const double theta = (inverse ? kPi : -kPi) / span;
+		const double halfSin = sin(0.5 * theta);
+		const double wpr = -2.0 * halfSin * halfSin;
+		const double wpi = sin(theta);
+
+		double wr = 1.0;
+		double wi = 0.0;
+		for (unsigned int k = 0; k < span; k++)
+		{
+			for (unsigned int i = k; i < N; i += 2 * span)
+			{
+				const unsigned int j = i + span;
+				const double tr = wr * re[j] - wi * im[j];
+				const double ti = wr * im[j] + wi * re[j];
+				re[j] = re[i] - tr;
+				im[j] = im[i] - ti;
+				re[i] += tr;
+				im[i] += ti;
+			}
+
+			const double wtemp = wr;
+			wr += wr * wpr - wi * wpi;
+			wi += wi * wpr + wtemp * wpi;
+		}
+	}
+}
+
+/**
+@freqSampleFFT
+\ingroup FX-Functions
+
+@brief the same design as freqSample( ) with POSITIVE symmetry, using an inverse FFT instead of the
+O(N^2) cosine sums: h(n) = (1/N)[A(0) + 2 sum A(k) cos(2pi k (n - M)/N)], M = (N - 1)/2, is the inverse
+DFT of the Hermitian spectrum A(k) e^(-j 2pi k M/N)
+
+\param N - Number of filter coefficients, a power of 2
+\param A[] - Sample points of desired response [N/2]
+\param h[] - the output array of impulse response
+\param scratch - working memory for 2N values
+\return true if the IR was designed, false if N is not a power of 2
+*/
+inline bool freqSampleFFT(unsigned int N, const double A[], double h[], double* scratch)
+{
+	if (N < 2 || (N & (N - 1)) != 0)
+		return false;
+
+	double* re = scratch;
+	double* im = scratch + N;
+	const double M = (N - 1.0) / 2.0;
+
+	re[0] = A[0];
+	im[0] = 0.0;
+	re[N / 2] = 0.0;
+	im[N / 2] = 0.0;
+	for (unsigned int k = 1; k < N / 2; k++)
+	{
+		const double phase = -kTwoPi * k * M / N;
+		re[k] = A[k] * cos(phase);
+		im[k] = A[k] * sin(phase);
+		re[N - k] = re[k];
+		im[N - k] = -im[k];
+	}
+
+	fftRadix2(re, im, N, true);
+
+	for (unsigned int n = 0; n < N; n++)
+		h[n] = re[n] / N;
+
+	return true;
+}
+
 /**
 @getMagnitude
 \ingroup FX-Functions
@@ -1200,6 +1625,88 @@ public:
 		// --- do nothing
 		return false; // NOT handled
 	}
+
+	/** process a block of mono samples in and out
+	--- optional processing function
+		the default implementation calls processAudioSample( ) once per sample through the vtable;
+		derived objects with nothing better than a per-sample loop inherit BlockProcessorMixin,
+		which makes the call non-virtual so it can be inlined, and objects with a real block kernel
+		override both versions themselves
+		NOTE: there is no aux input here; objects keyed by processAuxInputAudioSample( ) need it once
+		per sample, so process those with processAudioSample( ) or the object's own sidechain block API */
+	/**
+	\param inputBlock ptr to numSamples input samples
+	\param outputBlock ptr to numSamples output samples; may be the same buffer as inputBlock
+	\param numSamples number of samples to process
+	\return true if handled
+	*/
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+			outputBlock[i] = (float)processAudioSample(inputBlock[i]);
+
+		return true; // handled
+	}
+
+	/** process a block of 64-bit samples in and out
+	--- optional processing function, used by hosts running double precision (VST3 kSample64);
+		derived objects that override the float version override this one too, so no
+		float conversions are made anywhere in the chain */
+	/**
+	\param inputBlock ptr to numSamples input samples
+	\param outputBlock ptr to numSamples output samples; may be the same buffer as inputBlock
+	\param numSamples number of samples to process
+	\return true if handled
+	*/
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+			outputBlock[i] = processAudioSample(inputBlock[i]);
+
+		return true; // handled
+	}
+};
+
+/**
+\class BlockProcessorMixin
+\ingroup Interfaces
+\brief
+Implements both processAudioBlock( ) versions for an object whose block processing is simply a loop over its
+own processAudioSample( ). The CRTP parameter lets the loop call Derived::processAudioSample( ) by its qualified
+name, so the per-sample call is non-virtual and can be inlined. Derive from BlockProcessorMixin<YourClass> in
+place of IAudioSignalProcessor; an object that extends another processor passes it as Base, e.g.
+BlockProcessorMixin<NestedDelayAPF, DelayAPF>. Objects with a real block kernel (e.g. AudioFilter, DynamicsProcessor)
+override processAudioBlock( ) directly instead.
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+template <class Derived, class Base = IAudioSignalProcessor>
+class BlockProcessorMixin : public Base
+{
+public:
+	using Base::Base;
+
+	/** process a block of mono samples */
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples)
+	{
+		Derived* derived = static_cast<Derived*>(this);
+		for (uint32_t i = 0; i < numSamples; i++)
+			outputBlock[i] = (float)derived->Derived::processAudioSample(inputBlock[i]);
+
+		return true;
+	}
+
+	/** process a block of 64-bit samples (VST3 kSample64); same as the float version, without the conversions */
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples)
+	{
+		Derived* derived = static_cast<Derived*>(this);
+		for (uint32_t i = 0; i < numSamples; i++)
+			outputBlock[i] = derived->Derived::processAudioSample(inputBlock[i]);
+
+		return true;
+	}
 };
 
 /**
@@ -1250,6 +1757,17 @@ public:
 
 	/** render the generator output */
 	virtual const SignalGenData renderAudioOutput() = 0;
+
+	/** render a block of generator outputs; default implementation calls renderAudioOutput( ) once per sample */
+	/**
+	\param outputBlock ptr to numSamples output structures
+	\param numSamples number of samples to render
+	*/
+	virtual void renderAudioBlock(SignalGenData* outputBlock, uint32_t numSamples)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+			outputBlock[i] = renderAudioOutput();
+	}
 };
 
 
@@ -1352,11 +1870,15 @@ struct BiquadParameters
 };
 
 /**
-\class Biquad
+\class BiquadT
 \ingroup FX-Objects
 \brief
 The Biquad object implements a first or second order H(z) transfer function using one of four standard structures: Direct, Canonical, Transpose Direct, Transpose Canonical.
 
+SampleType (float or double) sets the precision of the coefficients, the state registers and the arithmetic; Biquad is
+the double precision version. The float version halves the footprint and doubles the SIMD width, but the quantized
+coefficients move the poles of low fc filters (poles close to z = 1), so keep double for those.
+
 Audio I/O:
 - Processes mono input to mono output.
 
@@ -1368,18 +1890,21 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class Biquad : public IAudioSignalProcessor
+template <typename SampleType>
+class BiquadT : public IAudioSignalProcessor
 {
+	static_assert(std::is_floating_point<SampleType>::value, "BiquadT requires float or double");
+
 public:
-	Biquad() {}		/* C-TOR */
-	~Biquad() {}	/* D-TOR */
+	BiquadT() {}	/* C-TOR */
+	~BiquadT() {}	/* D-TOR */
 
 	// --- IAudioSignalProcessor FUNCTIONS --- //
 	//
 	/** reset: clear out the state array (flush delays); can safely ignore sampleRate argument - we don't need/use it */
 	virtual bool reset(double _sampleRate)
 	{
-		memset(&stateArray[0], 0, sizeof(double)*numStates);
+		memset(&stateArray[0], 0, sizeof(SampleType)*numStates);
 		return true;  // handled = true
 	}
 
@@ -1393,6 +1918,12 @@ public:
 	*/
 	virtual double processAudioSample(double xn);
 
+	/** process a block of samples through the biquad; see fxobjects.cpp */
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples);
+
+	/** process a block of 64-bit samples (VST3 kSample64) through the biquad; see fxobjects.cpp */
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples);
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return BiquadParameters custom data structure
@@ -1406,21 +1937,22 @@ public:
 	void setParameters(const BiquadParameters& _parameters){ parameters = _parameters; }
 
 	// --- MUTATORS & ACCESSORS --- //
-	/** set the coefficient array NOTE: passing by pointer to array; allows us to use "array notation" with pointers i.e. [ ] */
-	void setCoefficients(double* coeffs){
-		// --- fast block memory copy:
-		memcpy(&coeffArray[0], &coeffs[0], sizeof(double)*numCoeffs);
+	/** set the coefficient array NOTE: passing by pointer to array; allows us to use "array notation" with pointers i.e. [ ]
+	    the coefficients are always designed in double precision and converted here */
+	void setCoefficients(const double* coeffs){
+		for (uint32_t i = 0; i < numCoeffs; i++)
+			coeffArray[i] = static_cast<SampleType>(coeffs[i]);
 	}
 
 	/** get the coefficient array for read/write access to the array (not used in current objects) */
-	double* getCoefficients()
+	SampleType* getCoefficients()
 	{
 		// --- read/write access to the array (not used)
 		return &coeffArray[0];
 	}
 
 	/** get the state array for read/write access to the array (used only in direct form oscillator) */
-	double* getStateArray()
+	SampleType* getStateArray()
 	{
 		// --- read/write access to the array (used only in direct form oscillator)
 		return &stateArray[0];
@@ -1434,18 +1966,29 @@ public:
 
 protected:
 	/** array of coefficients */
-	double coeffArray[numCoeffs] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	SampleType coeffArray[numCoeffs] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
 
 	/** array of state (z^-1) registers */
-	double stateArray[numStates] = { 0.0, 0.0, 0.0, 0.0 };
+	SampleType stateArray[numStates] = { 0.0, 0.0, 0.0, 0.0 };
 
 	/** type of calculation (algorithm  structure) */
 	BiquadParameters parameters;
 
 	/** for Harma loop resolution */
-	double storageComponent = 0.0;
+	SampleType storageComponent = 0.0;
+
+	/** block loop shared by the float and double processAudioBlock( ) versions; see fxobjects.cpp */
+	template <typename BlockType>
+	bool processBlock(const BlockType* inputBlock, BlockType* outputBlock, uint32_t numSamples);
 };
 
+// --- the out-of-line members are compiled for float and double in fxobjects.cpp
+extern template class BiquadT<float>;
+extern template class BiquadT<double>;
+
+/** the double precision Biquad used throughout the FX objects */
+using Biquad = BiquadT<double>;
+
 
 /**
 \enum filterAlgorithm
@@ -1503,11 +2046,14 @@ struct AudioFilterParameters
 };
 
 /**
-\class AudioFilter
+\class AudioFilterT
 \ingroup FX-Objects
 \brief
 The AudioFilter object implements all filters in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 
+The coefficients are always calculated in double precision; SampleType (float or double) sets the precision of the
+biquad that runs them (see BiquadT). AudioFilter is the double precision version.
+
 Audio I/O:
 - Processes mono input to mono output.
 
@@ -1519,11 +2065,12 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class AudioFilter : public IAudioSignalProcessor
+template <typename SampleType>
+class AudioFilterT : public IAudioSignalProcessor
 {
 public:
-	AudioFilter() {}		/* C-TOR */
-	~AudioFilter() {}		/* D-TOR */
+	AudioFilterT() {}		/* C-TOR */
+	~AudioFilterT() {}		/* D-TOR */
 
 	// --- IAudioSignalProcessor
 	/** --- set sample rate, then update coeffs */
@@ -1550,6 +2097,12 @@ public:
 	*/
 	virtual double processAudioSample(double xn);
 
+	/** process a block of samples through the filter; see fxobjects.cpp */
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples);
+
+	/** process a block of 64-bit samples (VST3 kSample64) through the filter; see fxobjects.cpp */
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples);
+
 	/** --- sample rate change necessarily requires recalculation */
 	virtual void setSampleRate(double _sampleRate)
 	{
@@ -1588,9 +2141,20 @@ public:
 	/** --- helper for Harma filters (phaser) */
 	double getS_value() { return biquad.getS_value(); }
 
+	/** --- get the double precision coefficient array; e.g. for ramping between coefficient sets */
+	const double* getCoefficients() { return &coeffArray[0]; }
+
+	/** --- set the coefficients directly, bypassing calculateFilterCoeffs( ); e.g. for control rate
+	        modulation where the coefficients are interpolated between updates */
+	void setCoefficients(const double* coeffs)
+	{
+		memcpy(&coeffArray[0], &coeffs[0], sizeof(double)*numCoeffs);
+		biquad.setCoefficients(coeffArray);
+	}
+
 protected:
 	// --- our calculator
-	Biquad biquad; ///< the biquad object
+	BiquadT<SampleType> biquad; ///< the biquad object
 
 	// --- array to hold coeffs (we need them too)
 	double coeffArray[numCoeffs] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }; ///< our local copy of biquad coeffs
@@ -1601,14 +2165,221 @@ protected:
 
 	/** --- function to recalculate coefficients due to a change in filter parameters */
 	bool calculateFilterCoeffs();
+
+	/** block loop shared by the float and double processAudioBlock( ) versions; see fxobjects.cpp */
+	template <typename BlockType>
+	bool processBlock(const BlockType* inputBlock, BlockType* outputBlock, uint32_t numSamples);
 };
 
+// --- the out-of-line members are compiled for float and double in fxobjects.cpp
+extern template class AudioFilterT<float>;
+extern template class AudioFilterT<double>;
+
+/** the double precision AudioFilter used throughout the FX objects */
+using AudioFilter = AudioFilterT<double>;
 
 /**
-\struct FilterBankOutput
+\class BiquadBank
 \ingroup FX-Objects
 \brief
-Custom output structure for filter bank objects that split the inptu into multiple frequency channels (bands)
+The BiquadBank object runs N independent filters in lockstep, e.g. the left and right channels of a stereo
+filter or parallel sections, using a structure-of-arrays layout so that SSE2/AVX (x86) or NEON (arm64) can
+process 2 or 4 filters per instruction. There is a scalar fallback for the remaining lanes and for other
+targets; define FXOBJECTS_NO_SIMD to force it.
+
+Each lane is equivalent to an AudioFilter: the transposed canonical biquad plus the c0/d0 wet/dry
+coefficients. The results are bit-exact with AudioFilter::processAudioSample( ) provided the compiler does
+not contract the scalar code into fused multiply-adds.
+
+Audio I/O:
+- Processes N input channels to N output channels.
+
+Control I/F:
+- Use setCoefficients( ) with a coefficient array, e.g. from AudioFilter::getCoefficients( ).
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+template <unsigned int N>
+class BiquadBank
+{
+public:
+	BiquadBank() {
+		// --- default pass-through
+		memset(&coeffs[0][0], 0, sizeof(coeffs));
+		for (unsigned int lane = 0; lane < N; lane++)
+		{
+			coeffs[a0][lane] = 1.0;
+			coeffs[c0][lane] = 1.0;
+		}
+		reset();
+	}		/* C-TOR */
+	~BiquadBank() {}	/* D-TOR */
+
+	/** flush the state registers of all lanes */
+	void reset()
+	{
+		memset(&z1[0], 0, sizeof(double) * N);
+		memset(&z2[0], 0, sizeof(double) * N);
+	}
+
+	/** set the coefficients of one lane */
+	/**
+	\param lane the lane (filter) index
+	\param coeffArray array of numCoeffs coefficients, indexed with the filterCoeff enum
+	*/
+	void setCoefficients(unsigned int lane, const double* coeffArray)
+	{
+		for (unsigned int i = 0; i < numCoeffs; i++)
+			coeffs[i][lane] = coeffArray[i];
+	}
+
+	/** process one sample per lane */
+	/**
+	\param input N input samples, one per lane
+	\param output N output samples, one per lane
+	*/
+	void processAudioFrame(const double* input, double* output)
+	{
+		unsigned int lane = 0;
+
+#if defined(FXOBJECTS_AVX)
+#if FXOBJECTS_CHECK_UNDERFLOW
+		const __m256d minValue4 = _mm256_set1_pd(kSmallestPositiveFloatValue);
+		const __m256d signMask4 = _mm256_set1_pd(-0.0);
+#endif
+		for (; lane + 4 <= N; lane += 4)
+		{
+			__m256d xn = _mm256_loadu_pd(&input[lane]);
+			__m256d yn = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(&coeffs[a0][lane]), xn), _mm256_loadu_pd(&z1[lane]));
+
+#if FXOBJECTS_CHECK_UNDERFLOW
+			// --- underflow check: flush non-zero values smaller than the smallest float
+			__m256d absYn = _mm256_andnot_pd(signMask4, yn);
+			__m256d tiny = _mm256_and_pd(_mm256_cmp_pd(absYn, minValue4, _CMP_LT_OQ),
+										 _mm256_cmp_pd(absYn, _mm256_setzero_pd(), _CMP_GT_OQ));
+			yn = _mm256_andnot_pd(tiny, yn);
+#endif
+
+			// --- shuffle/update
+			_mm256_storeu_pd(&z1[lane], _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(_mm256_loadu_pd(&coeffs[a1][lane]), xn),
+																   _mm256_mul_pd(_mm256_loadu_pd(&coeffs[b1][lane]), yn)),
+													 _mm256_loadu_pd(&z2[lane])));
+			_mm256_storeu_pd(&z2[lane], _mm256_sub_pd(_mm256_mul_pd(_mm256_loadu_pd(&coeffs[a2][lane]), xn),
+													 _mm256_mul_pd(_mm256_loadu_pd(&coeffs[b2][lane]), yn)));
+
+			// --- (dry) + (processed): x(n)*d0 + y(n)*c0
+			_mm256_storeu_pd(&output[lane], _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(&coeffs[d0][lane]), xn),
+														  _mm256_mul_pd(_mm256_loadu_pd(&coeffs[c0][lane]), yn)));
+		}
+#endif
+#if defined(FXOBJECTS_SSE2)
+#if FXOBJECTS_CHECK_UNDERFLOW
+		const __m128d minValue2 = _mm_set1_pd(kSmallestPositiveFloatValue);
+		const __m128d signMask2 = _mm_set1_pd(-0.0);
+#endif
+		for (; lane + 2 <= N; lane += 2)
+		{
+			__m128d xn = _mm_loadu_pd(&input[lane]);
+			__m128d yn = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(&coeffs[a0][lane]), xn), _mm_loadu_pd(&z1[lane]));
+
+#if FXOBJECTS_CHECK_UNDERFLOW
+			// --- underflow check: flush non-zero values smaller than the smallest float
+			__m128d absYn = _mm_andnot_pd(signMask2, yn);
+			__m128d tiny = _mm_and_pd(_mm_cmplt_pd(absYn, minValue2), _mm_cmpgt_pd(absYn, _mm_setzero_pd()));
+			yn = _mm_andnot_pd(tiny, yn);
+#endif
+
+			// --- shuffle/update
+			_mm_storeu_pd(&z1[lane], _mm_add_pd(_mm_sub_pd(_mm_mul_pd(_mm_loadu_pd(&coeffs[a1][lane]), xn),
+														  _mm_mul_pd(_mm_loadu_pd(&coeffs[b1][lane]), yn)),
+											   _mm_loadu_pd(&z2[lane])));
+			_mm_storeu_pd(&z2[lane], _mm_sub_pd(_mm_mul_pd(_mm_loadu_pd(&coeffs[a2][lane]), xn),
+											   _mm_mul_pd(_mm_loadu_pd(&coeffs[b2][lane]), yn)));
+
+			// --- (dry) + (processed): x(n)*d0 + y(n)*c0
+			_mm_storeu_pd(&output[lane], _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(&coeffs[d0][lane]), xn),
+													_mm_mul_pd(_mm_loadu_pd(&coeffs[c0][lane]), yn)));
+		}
+#elif defined(FXOBJECTS_NEON)
+#if FXOBJECTS_CHECK_UNDERFLOW
+		const float64x2_t minValue2 = vdupq_n_f64(kSmallestPositiveFloatValue);
+#endif
+		for (; lane + 2 <= N; lane += 2)
+		{
+			float64x2_t xn = vld1q_f64(&input[lane]);
+			float64x2_t yn = vaddq_f64(vmulq_f64(vld1q_f64(&coeffs[a0][lane]), xn), vld1q_f64(&z1[lane]));
+
+#if FXOBJECTS_CHECK_UNDERFLOW
+			// --- underflow check: flush non-zero values smaller than the smallest float
+			float64x2_t absYn = vabsq_f64(yn);
+			uint64x2_t tiny = vandq_u64(vcltq_f64(absYn, minValue2), vcgtq_f64(absYn, vdupq_n_f64(0.0)));
+			yn = vreinterpretq_f64_u64(vbicq_u64(vreinterpretq_u64_f64(yn), tiny));
+#endif
+
+			// --- shuffle/update
+			vst1q_f64(&z1[lane], vaddq_f64(vsubq_f64(vmulq_f64(vld1q_f64(&coeffs[a1][lane]), xn),
+													 vmulq_f64(vld1q_f64(&coeffs[b1][lane]), yn)),
+										   vld1q_f64(&z2[lane])));
+			vst1q_f64(&z2[lane], vsubq_f64(vmulq_f64(vld1q_f64(&coeffs[a2][lane]), xn),
+										   vmulq_f64(vld1q_f64(&coeffs[b2][lane]), yn)));
+
+			// --- (dry) + (processed): x(n)*d0 + y(n)*c0
+			vst1q_f64(&output[lane], vaddq_f64(vmulq_f64(vld1q_f64(&coeffs[d0][lane]), xn),
+											   vmulq_f64(vld1q_f64(&coeffs[c0][lane]), yn)));
+		}
+#endif
+		// --- scalar fallback for the remaining lanes
+		for (; lane < N; lane++)
+		{
+			double xn = input[lane];
+			double yn = coeffs[a0][lane] * xn + z1[lane];
+			checkOptionalFloatUnderflow(yn);
+
+			z1[lane] = coeffs[a1][lane] * xn - coeffs[b1][lane] * yn + z2[lane];
+			z2[lane] = coeffs[a2][lane] * xn - coeffs[b2][lane] * yn;
+
+			output[lane] = coeffs[d0][lane] * xn + coeffs[c0][lane] * yn;
+		}
+	}
+
+	/** process a block of samples, one channel per lane */
+	/**
+	\param inputs N input channel pointers
+	\param outputs N output channel pointers; may be the same buffers as the inputs
+	\param numSamples number of samples per channel
+	\return true: block processed
+	*/
+	bool processAudioBlock(const float* const* inputs, float* const* outputs, uint32_t numSamples)
+	{
+		double xn[N];
+		double yn[N];
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			for (unsigned int lane = 0; lane < N; lane++)
+				xn[lane] = inputs[lane][i];
+
+			processAudioFrame(xn, yn);
+
+			for (unsigned int lane = 0; lane < N; lane++)
+				outputs[lane][i] = (float)yn[lane];
+		}
+		return true;
+	}
+
+protected:
+	double coeffs[numCoeffs][N];	///< coefficients, [filterCoeff][lane]
+	double z1[N];					///< first state register per lane
+	double z2[N];					///< second state register per lane
+};
+
+
+/**
+\struct FilterBankOutput
+\ingroup FX-Objects
+\brief
+Custom output structure for filter bank objects that split the inptu into multiple frequency channels (bands)
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
@@ -1677,7 +2448,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class LRFilterBank : public IAudioSignalProcessor
+class LRFilterBank : public BlockProcessorMixin<LRFilterBank>
 {
 public:
 	LRFilterBank()		/* C-TOR */
@@ -1801,6 +2572,7 @@ struct AudioDetectorParameters
 		detectMode = params.detectMode;
 		detect_dB = params.detect_dB;
 		clampToUnityMax = params.clampToUnityMax;
+		useFastMath = params.useFastMath;
 		return *this;
 	}
 
@@ -1810,15 +2582,19 @@ struct AudioDetectorParameters
 	unsigned int  detectMode = 0;///< detect mode, see TLD_ constants above
 	bool detect_dB = false;	///< detect in dB  DEFAULT  = false (linear NOT log)
 	bool clampToUnityMax = true;///< clamp output to 1.0 (set false for true log detectors)
+	bool useFastMath = true;///< dB output with fastRaw2dB( ) (error < 1.2e-8 dB); false for log10( )
 };
 
 /**
-\class AudioDetector
+\class AudioDetectorT
 \ingroup FX-Objects
 \brief
 The AudioDetector object implements the audio detector defined in the book source below.
 NOTE: this detector can receive signals and transmit detection values that are both > 0dBFS
 
+SampleType (float or double) sets the precision of the envelope and the time constants; AudioDetector
+is the double precision version.
+
 Audio I/O:
 - Processes mono input to a detected signal output.
 
@@ -1830,11 +2606,14 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class AudioDetector : public IAudioSignalProcessor
+template <typename SampleType>
+class AudioDetectorT : public BlockProcessorMixin<AudioDetectorT<SampleType>>
 {
+	static_assert(std::is_floating_point<SampleType>::value, "AudioDetectorT requires float or double");
+
 public:
-	AudioDetector() {}	/* C-TOR */
-	~AudioDetector() {}	/* D-TOR */
+	AudioDetectorT() {}	/* C-TOR */
+	~AudioDetectorT() {}	/* D-TOR */
 
 public:
 	/** set sample rate dependent time constants and clear last envelope output value */
@@ -1856,38 +2635,33 @@ public:
 	virtual double processAudioSample(double xn)
 	{
 		// --- all modes do Full Wave Rectification
-		double input = fabs(xn);
+		SampleType input = static_cast<SampleType>(fabs(xn));
 
 		// --- square it for MS and RMS
 		if (audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_MS ||
 			audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_RMS)
 			input *= input;
 
-		// --- to store current
-		double currEnvelope = 0.0;
-
-		// --- do the detection with attack or release applied
-		if (input > lastEnvelope)
-			currEnvelope = attackTime * (lastEnvelope - input) + input;
-		else
-			currEnvelope = releaseTime * (lastEnvelope - input) + input;
+		// --- do the detection with attack or release applied; a select rather than a branch on the signal
+		const SampleType coeff = input > lastEnvelope ? attackTime : releaseTime;
+		SampleType currEnvelope = coeff * (lastEnvelope - input) + input;
 
 		// --- we are recursive so need to check underflow
-		checkFloatUnderflow(currEnvelope);
+		checkOptionalFloatUnderflow(currEnvelope);
 
 		// --- bound them; can happen when using pre-detector gains of more than 1.0
 		if (audioDetectorParameters.clampToUnityMax)
-			currEnvelope = fmin(currEnvelope, 1.0);
+			currEnvelope = static_cast<SampleType>(fmin(currEnvelope, 1.0));
 
 		// --- can not be (-)
-		currEnvelope = fmax(currEnvelope, 0.0);
+		currEnvelope = static_cast<SampleType>(fmax(currEnvelope, 0.0));
 
 		// --- store envelope prior to sqrt for RMS version
 		lastEnvelope = currEnvelope;
 
 		// --- if RMS, do the SQRT
 		if (audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_RMS)
-			currEnvelope = pow(currEnvelope, 0.5);
+			currEnvelope = sqrt(currEnvelope);
 
 		// --- if not dB, we are done
 		if (!audioDetectorParameters.detect_dB)
@@ -1900,7 +2674,10 @@ public:
 		}
 
 		// --- true log output in dB, can go above 0dBFS!
-		return 20.0*log10(currEnvelope);
+		if (audioDetectorParameters.useFastMath)
+			return fastRaw2dB(static_cast<double>(currEnvelope));
+
+		return 20.0*log10(static_cast<double>(currEnvelope));
 	}
 
 	/** get parameters: note use of custom structure for passing param data */
@@ -1941,10 +2718,10 @@ public:
 
 protected:
 	AudioDetectorParameters audioDetectorParameters; ///< parameters for object
-	double attackTime = 0.0;	///< attack time coefficient
-	double releaseTime = 0.0;	///< release time coefficient
+	SampleType attackTime = 0.0;	///< attack time coefficient
+	SampleType releaseTime = 0.0;	///< release time coefficient
 	double sampleRate = 44100;	///< stored sample rate
-	double lastEnvelope = 0.0;	///< output register
+	SampleType lastEnvelope = 0.0;	///< output register
 
 	/** set our internal atack time coefficients based on times and sample rate */
 	void setAttackTime(double attack_in_ms, bool forceCalc = false);
@@ -1953,6 +2730,309 @@ protected:
 	void setReleaseTime(double release_in_ms, bool forceCalc = false);
 };
 
+// --- the out-of-line members are compiled for float and double in fxobjects.cpp
+extern template class AudioDetectorT<float>;
+extern template class AudioDetectorT<double>;
+
+/** the double precision AudioDetector used throughout the FX objects */
+using AudioDetector = AudioDetectorT<double>;
+
+/**
+\class AudioDetectorBank
+\ingroup FX-Objects
+\brief
+The AudioDetectorBank object runs N AudioDetectors in lockstep, e.g. the channels of a linked compressor or
+a bank of envelope followers, with the envelopes in a structure-of-arrays layout so that SSE2/AVX (x86) or
+NEON (arm64) can process 2 or 4 detectors per instruction. There is a scalar fallback for the remaining lanes
+and for other targets; define FXOBJECTS_NO_SIMD to force it.
+
+Each lane is equivalent to an AudioDetector with the same parameters: the attack or release coefficient is
+selected with a compare and blend instead of a branch and the RMS root is sqrt( ). The dB conversion runs
+as a separate pass over a whole block so that it can use (and auto-vectorize) fastRaw2dB( ).
+
+Audio I/O:
+- Processes N input channels to N detector outputs (envelopes).
+
+Control I/F:
+- Use AudioDetectorParameters structure to get/set object params; all lanes share them.
+- processAudioBlock( ) returns the envelopes for a block so that gain curves can be calculated over
+  the block, see DynamicsProcessor.
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+template <unsigned int N>
+class AudioDetectorBank
+{
+public:
+	AudioDetectorBank() {
+		calculateTimeConstants();
+		memset(&lastEnvelope[0], 0, sizeof(double) * N);
+	}		/* C-TOR */
+	~AudioDetectorBank() {}	/* D-TOR */
+
+	/** set sample rate dependent time constants and clear the envelopes */
+	bool reset(double _sampleRate)
+	{
+		setSampleRate(_sampleRate);
+		memset(&lastEnvelope[0], 0, sizeof(double) * N);
+		return true;
+	}
+
+	/** get parameters: note use of custom structure for passing param data */
+	/**
+	\return AudioDetectorParameters custom data structure
+	*/
+	AudioDetectorParameters getParameters() { return audioDetectorParameters; }
+
+	/** set parameters for all lanes: note use of custom structure for passing param data */
+	/**
+	\param AudioDetectorParameters custom data structure
+	*/
+	void setParameters(const AudioDetectorParameters& parameters)
+	{
+		audioDetectorParameters = parameters;
+		calculateTimeConstants();
+	}
+
+	/** set sample rate - our time constants depend on it */
+	void setSampleRate(double _sampleRate)
+	{
+		if (sampleRate == _sampleRate)
+			return;
+
+		sampleRate = _sampleRate;
+		calculateTimeConstants();
+	}
+
+	/** detect one sample per lane */
+	/**
+	\param input N input samples, one per lane
+	\param output N detector outputs, one per lane, in dB if detect_dB is set
+	*/
+	void processAudioFrame(const double* input, double* output)
+	{
+		detectFrame(input, output);
+
+		if (audioDetectorParameters.detect_dB)
+		{
+			for (unsigned int lane = 0; lane < N; lane++)
+				output[lane] = toDetector_dB(output[lane]);
+		}
+	}
+
+	/** detect a block of samples, one channel per lane */
+	/**
+	\param inputs N input channel pointers
+	\param envelopes N envelope buffers of numSamples each; in dB if detect_dB is set
+	\param numSamples number of samples per channel
+	\return true: block processed
+	*/
+	bool processAudioBlock(const float* const* inputs, double* const* envelopes, uint32_t numSamples)
+	{
+		return processBlock(inputs, envelopes, numSamples);
+	}
+
+	/** detect a block of 64-bit samples (VST3 kSample64), one channel per lane */
+	bool processAudioBlock(const double* const* inputs, double* const* envelopes, uint32_t numSamples)
+	{
+		return processBlock(inputs, envelopes, numSamples);
+	}
+
+protected:
+	AudioDetectorParameters audioDetectorParameters; ///< parameters for all lanes
+	double attackTime = 0.0;		///< attack time coefficient
+	double releaseTime = 0.0;		///< release time coefficient
+	double sampleRate = 44100.0;	///< stored sample rate
+	double lastEnvelope[N];			///< output register per lane, before the RMS root
+
+	/** calculate the attack and release coefficients as AudioDetector does */
+	void calculateTimeConstants()
+	{
+		attackTime = exp(TLD_AUDIO_ENVELOPE_ANALOG_TC / (audioDetectorParameters.attackTime_mSec * sampleRate * 0.001));
+		releaseTime = exp(TLD_AUDIO_ENVELOPE_ANALOG_TC / (audioDetectorParameters.releaseTime_mSec * sampleRate * 0.001));
+	}
+
+	/** linear (or squared for MS) envelope to the detector output in dB */
+	inline double toDetector_dB(double envelope)
+	{
+		// --- the select (rather than a branch) keeps the block conversion loop vectorizable
+		const double detect_dB = audioDetectorParameters.useFastMath ? fastRaw2dB(envelope) : 20.0*log10(envelope);
+		return envelope > 0.0 ? detect_dB : -96.0;
+	}
+
+	/** block loop shared by the float and double processAudioBlock( ) versions */
+	template <typename BlockType>
+	bool processBlock(const BlockType* const* inputs, double* const* envelopes, uint32_t numSamples)
+	{
+		// --- linear envelopes, one frame at a time
+		double xn[N];
+		double yn[N];
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			for (unsigned int lane = 0; lane < N; lane++)
+				xn[lane] = inputs[lane][i];
+
+			detectFrame(xn, yn);
+
+			for (unsigned int lane = 0; lane < N; lane++)
+				envelopes[lane][i] = yn[lane];
+		}
+
+		// --- then the dB conversion per channel over the whole block
+		if (audioDetectorParameters.detect_dB)
+		{
+			for (unsigned int lane = 0; lane < N; lane++)
+			{
+				double* envelope = envelopes[lane];
+				if (audioDetectorParameters.useFastMath)
+				{
+					for (uint32_t i = 0; i < numSamples; i++)
+						envelope[i] = envelope[i] > 0.0 ? fastRaw2dB(envelope[i]) : -96.0;
+				}
+				else
+				{
+					for (uint32_t i = 0; i < numSamples; i++)
+						envelope[i] = toDetector_dB(envelope[i]);
+				}
+			}
+		}
+		return true;
+	}
+
+	/** detect one sample per lane to the linear envelope (the RMS root is taken, the dB conversion is not) */
+	void detectFrame(const double* input, double* output)
+	{
+		const bool square = audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_MS ||
+							audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_RMS;
+		const bool root = audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_RMS;
+		const bool clampToUnity = audioDetectorParameters.clampToUnityMax;
+		unsigned int lane = 0;
+
+#if defined(FXOBJECTS_AVX)
+		const __m256d attack4 = _mm256_set1_pd(attackTime);
+		const __m256d release4 = _mm256_set1_pd(releaseTime);
+		const __m256d signMask4 = _mm256_set1_pd(-0.0);
+#if FXOBJECTS_CHECK_UNDERFLOW
+		const __m256d minValue4 = _mm256_set1_pd(kSmallestPositiveFloatValue);
+#endif
+		for (; lane + 4 <= N; lane += 4)
+		{
+			// --- full wave rectification; square it for MS and RMS
+			__m256d xn = _mm256_andnot_pd(signMask4, _mm256_loadu_pd(&input[lane]));
+			if (square)
+				xn = _mm256_mul_pd(xn, xn);
+
+			// --- attack when rising, release when falling
+			__m256d last = _mm256_loadu_pd(&lastEnvelope[lane]);
+			__m256d coeff = _mm256_blendv_pd(release4, attack4, _mm256_cmp_pd(xn, last, _CMP_GT_OQ));
+			__m256d env = _mm256_add_pd(_mm256_mul_pd(coeff, _mm256_sub_pd(last, xn)), xn);
+
+#if FXOBJECTS_CHECK_UNDERFLOW
+			// --- underflow check: flush non-zero values smaller than the smallest float (env is not negative)
+			__m256d tiny = _mm256_and_pd(_mm256_cmp_pd(env, minValue4, _CMP_LT_OQ),
+										 _mm256_cmp_pd(env, _mm256_setzero_pd(), _CMP_GT_OQ));
+			env = _mm256_andnot_pd(tiny, env);
+#endif
+
+			// --- bound them
+			if (clampToUnity)
+				env = _mm256_min_pd(env, _mm256_set1_pd(1.0));
+			env = _mm256_max_pd(env, _mm256_setzero_pd());
+
+			_mm256_storeu_pd(&lastEnvelope[lane], env);
+			_mm256_storeu_pd(&output[lane], root ? _mm256_sqrt_pd(env) : env);
+		}
+#endif
+#if defined(FXOBJECTS_SSE2)
+		const __m128d attack2 = _mm_set1_pd(attackTime);
+		const __m128d release2 = _mm_set1_pd(releaseTime);
+		const __m128d signMask2 = _mm_set1_pd(-0.0);
+#if FXOBJECTS_CHECK_UNDERFLOW
+		const __m128d minValue2 = _mm_set1_pd(kSmallestPositiveFloatValue);
+#endif
+		for (; lane + 2 <= N; lane += 2)
+		{
+			// --- full wave rectification; square it for MS and RMS
+			__m128d xn = _mm_andnot_pd(signMask2, _mm_loadu_pd(&input[lane]));
+			if (square)
+				xn = _mm_mul_pd(xn, xn);
+
+			// --- attack when rising, release when falling; SSE2 has no blend, so and/andnot/or
+			__m128d last = _mm_loadu_pd(&lastEnvelope[lane]);
+			__m128d rising = _mm_cmpgt_pd(xn, last);
+			__m128d coeff = _mm_or_pd(_mm_and_pd(rising, attack2), _mm_andnot_pd(rising, release2));
+			__m128d env = _mm_add_pd(_mm_mul_pd(coeff, _mm_sub_pd(last, xn)), xn);
+
+#if FXOBJECTS_CHECK_UNDERFLOW
+			// --- underflow check: flush non-zero values smaller than the smallest float (env is not negative)
+			__m128d tiny = _mm_and_pd(_mm_cmplt_pd(env, minValue2), _mm_cmpgt_pd(env, _mm_setzero_pd()));
+			env = _mm_andnot_pd(tiny, env);
+#endif
+
+			// --- bound them
+			if (clampToUnity)
+				env = _mm_min_pd(env, _mm_set1_pd(1.0));
+			env = _mm_max_pd(env, _mm_setzero_pd());
+
+			_mm_storeu_pd(&lastEnvelope[lane], env);
+			_mm_storeu_pd(&output[lane], root ? _mm_sqrt_pd(env) : env);
+		}
+#elif defined(FXOBJECTS_NEON)
+		const float64x2_t attack2 = vdupq_n_f64(attackTime);
+		const float64x2_t release2 = vdupq_n_f64(releaseTime);
+#if FXOBJECTS_CHECK_UNDERFLOW
+		const float64x2_t minValue2 = vdupq_n_f64(kSmallestPositiveFloatValue);
+#endif
+		for (; lane + 2 <= N; lane += 2)
+		{
+			// --- full wave rectification; square it for MS and RMS
+			float64x2_t xn = vabsq_f64(vld1q_f64(&input[lane]));
+			if (square)
+				xn = vmulq_f64(xn, xn);
+
+			// --- attack when rising, release when falling
+			float64x2_t last = vld1q_f64(&lastEnvelope[lane]);
+			float64x2_t coeff = vbslq_f64(vcgtq_f64(xn, last), attack2, release2);
+			float64x2_t env = vaddq_f64(vmulq_f64(coeff, vsubq_f64(last, xn)), xn);
+
+#if FXOBJECTS_CHECK_UNDERFLOW
+			// --- underflow check: flush non-zero values smaller than the smallest float (env is not negative)
+			uint64x2_t tiny = vandq_u64(vcltq_f64(env, minValue2), vcgtq_f64(env, vdupq_n_f64(0.0)));
+			env = vreinterpretq_f64_u64(vbicq_u64(vreinterpretq_u64_f64(env), tiny));
+#endif
+
+			// --- bound them
+			if (clampToUnity)
+				env = vminq_f64(env, vdupq_n_f64(1.0));
+			env = vmaxq_f64(env, vdupq_n_f64(0.0));
+
+			vst1q_f64(&lastEnvelope[lane], env);
+			vst1q_f64(&output[lane], root ? vsqrtq_f64(env) : env);
+		}
+#endif
+		// --- scalar fallback for the remaining lanes
+		for (; lane < N; lane++)
+		{
+			double xn = fabs(input[lane]);
+			if (square)
+				xn *= xn;
+
+			const double coeff = xn > lastEnvelope[lane] ? attackTime : releaseTime;
+			double env = coeff*(lastEnvelope[lane] - xn) + xn;
+			checkOptionalFloatUnderflow(env);
+
+			if (clampToUnity)
+				env = env < 1.0 ? env : 1.0;
+			env = env > 0.0 ? env : 0.0;
+
+			lastEnvelope[lane] = env;
+			output[lane] = root ? sqrt(env) : env;
+		}
+	}
+};
+
 
 /**
 \enum dynamicsProcessorType
@@ -1973,6 +3053,9 @@ Use this strongly typed enum to set the dynamics processor type.
 // --- processorType
 enum class dynamicsProcessorType { kCompressor, kDownwardExpander };
 
+// --- longest DynamicsProcessor look-ahead; the delay line is sized for this in reset( )
+const double kMaxDynamicsLookAhead_mSec = 20.0;
+
 
 /**
 \struct DynamicsProcessorParameters
@@ -2004,6 +3087,8 @@ struct DynamicsProcessorParameters
 		attackTime_mSec = params.attackTime_mSec;
 		releaseTime_mSec = params.releaseTime_mSec;
 		outputGain_dB = params.outputGain_dB;
+		useFastMath = params.useFastMath;
+		lookAhead_mSec = params.lookAhead_mSec;
 		// --- NOTE: do not set outbound variables??
 		gainReduction = params.gainReduction;
 		gainReduction_dB = params.gainReduction_dB;
@@ -2021,6 +3106,8 @@ struct DynamicsProcessorParameters
 	double attackTime_mSec = 0.0;		///< attack mSec
 	double releaseTime_mSec = 0.0;		///< release mSec
 	double outputGain_dB = 0.0;			///< make up gain
+	bool useFastMath = true;			///< fastRaw2dB( )/fastDB2Raw( ) for the detector and gain computer; false for log10( )/pow( )
+	double lookAhead_mSec = 0.0;		///< main path delay so the gain moves before the transient arrives; 0 = off, max kMaxDynamicsLookAhead_mSec
 
 	// --- outbound values, for owner to use gain-reduction metering
 	double gainReduction = 1.0;			///< output value for gain reduction that occurred
@@ -2035,14 +3122,20 @@ The DynamicsProcessor object implements a dynamics processor suite: compressor,
 
 Audio I/O:
 - Processes mono input to mono output.
+- Sidechain: either one sample at a time with processAuxInputAudioSample( ) before each processAudioSample( ),
+  or a block at a time by passing the host's aux input channel pointers (ProcessBlockInfo::auxInputs or
+  auxInputs64, with blockStartIndex) to processAudioBlock( ); several aux channels are averaged to a mono key.
+- The processAudioBlock( ) versions without aux pointers key the whole block from the last
+  processAuxInputAudioSample( ) value, so do not use them with a per-sample sidechain.
 
 Control I/F:
 - Use DynamicsProcessorParameters structure to get/set object params.
+- lookAhead_mSec delays the main path only; report getLookAheadSamples( ) to the host as latency.
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\version Revision : 1.1 block sidechain input, look-ahead delay (Steve Dwyer)
+\date Date : 2026 / 10 / 17
 */
 class DynamicsProcessor : public IAudioSignalProcessor
 {
@@ -2060,6 +3153,20 @@ public:
 		detectorParams.clampToUnityMax = false;
 		detectorParams.detect_dB = true;
 		detector.setParameters(detectorParams);
+
+		// --- size the look-ahead delay for the longest setting; only reallocate when the length changes
+		sampleRate = _sampleRate;
+		unsigned int length = 1;
+		while (length < (unsigned int)(kMaxDynamicsLookAhead_mSec * sampleRate / 1000.0) + 1)
+			length <<= 1;
+		if (length != lookAheadWrapMask + 1 || !lookAheadBuffer)
+		{
+			lookAheadBuffer.reset(new double[length]);
+			lookAheadWrapMask = length - 1;
+		}
+		memset(&lookAheadBuffer[0], 0, length * sizeof(double));
+		lookAheadWriteIndex = 0;
+		updateLookAhead();
 		return true;
 	}
 
@@ -2088,14 +3195,24 @@ public:
 	*/
 	void setParameters(const DynamicsProcessorParameters& _parameters)
 	{
+		// --- makeup gain only changes with the parameters so there is no need to re-calculate it per-sample
+		if (_parameters.outputGain_dB != parameters.outputGain_dB)
+			makeupGain = dB2Raw(_parameters.outputGain_dB);
+
 		parameters = _parameters;
 
 		AudioDetectorParameters detectorParams = detector.getParameters();
 		detectorParams.attackTime_mSec = parameters.attackTime_mSec;
 		detectorParams.releaseTime_mSec = parameters.releaseTime_mSec;
+		detectorParams.useFastMath = parameters.useFastMath;
 		detector.setParameters(detectorParams);
+
+		updateLookAhead();
 	}
 
+	/** the main path delay in samples; plugins using look-ahead should report this as their latency */
+	uint32_t getLookAheadSamples() const { return lookAheadSamples; }
+
 	/** process audio using feed-forward dynamics processor flowchart */
 	/*
 		1. detect input signal
@@ -2113,27 +3230,158 @@ public:
 
 		// --- if using the sidechain, process the aux input
 		if(parameters.enableSidechain)
-			detect_dB = detector.processAudioSample(sidechainInputSample);
+			detector.processAudioFrame(&sidechainInputSample, &detect_dB);
 		else
-			detect_dB = detector.processAudioSample(xn);
+			detector.processAudioFrame(&xn, &detect_dB);
 
 		// --- compute gain
 		double gr = computeGain(detect_dB);
 
-		// --- makeup gain
-		double makeupGain = pow(10.0, parameters.outputGain_dB / 20.0);
+		// --- delay the main path for look-ahead
+		if (lookAheadSamples > 0)
+			xn = delayLookAhead(xn);
 
 		// --- do DCA + makeup gain
 		return xn * gr * makeupGain;
 	}
 
+	/** process a block of mono samples; makeup gain is calculated once per block
+		with enableSidechain set the block is keyed from the held processAuxInputAudioSample( ) value;
+		pass a sidechain signal with the aux input versions below */
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples, (const float* const*)nullptr, 0, 0);
+	}
+
+	/** process a block of 64-bit samples (VST3 kSample64); keyed like the float version above */
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples, (const double* const*)nullptr, 0, 0);
+	}
+
+	/** process a block of mono samples keyed by the host's aux inputs */
+	/**
+	\param sidechainInputs the aux input channel pointers, e.g. ProcessBlockInfo::auxInputs
+	\param numSidechainChannels number of aux channels; more than one are averaged, none uses the processAuxInputAudioSample( ) value
+	\param sidechainStartIndex first sample of this block in each aux channel, e.g. ProcessBlockInfo::blockStartIndex
+	\return true if processed
+	*/
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples,
+								   const float* const* sidechainInputs, uint32_t numSidechainChannels, uint32_t sidechainStartIndex = 0)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples, sidechainInputs, numSidechainChannels, sidechainStartIndex);
+	}
+
+	/** process a block of 64-bit samples keyed by the host's 64-bit aux inputs (ProcessBlockInfo::auxInputs64) */
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples,
+								   const double* const* sidechainInputs, uint32_t numSidechainChannels, uint32_t sidechainStartIndex = 0)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples, sidechainInputs, numSidechainChannels, sidechainStartIndex);
+	}
+
 protected:
 	DynamicsProcessorParameters parameters; ///< object parameters
-	AudioDetector detector; ///< the sidechain audio detector
+	AudioDetectorBank<1> detector; ///< the sidechain audio detector
+
+	// --- the block versions detect this many samples at a time, then compute the gains
+	static const uint32_t kEnvelopeBlockSize = 64;
 
 	// --- storage for sidechain audio input (mono only)
 	double sidechainInputSample = 0.0; ///< storage for sidechain sample
 
+	double makeupGain = 1.0; ///< raw makeup gain, from parameters.outputGain_dB
+
+	// --- look-ahead delay on the main path; power of 2 length, allocated in reset( )
+	std::unique_ptr<double[]> lookAheadBuffer = nullptr; ///< delay line
+	unsigned int lookAheadWrapMask = 0;		///< delay line length - 1
+	unsigned int lookAheadWriteIndex = 0;	///< delay line write position
+	uint32_t lookAheadSamples = 0;			///< current delay, from parameters.lookAhead_mSec
+	double sampleRate = 44100.0;			///< sample rate, for the look-ahead delay
+
+	/** convert parameters.lookAhead_mSec to samples; zero until reset( ) has sized the delay line */
+	void updateLookAhead()
+	{
+		const double lookAhead_mSec = parameters.lookAhead_mSec < kMaxDynamicsLookAhead_mSec ? parameters.lookAhead_mSec : kMaxDynamicsLookAhead_mSec;
+		const uint32_t samples = lookAhead_mSec > 0.0 ? (uint32_t)(lookAhead_mSec * sampleRate / 1000.0 + 0.5) : 0;
+		lookAheadSamples = !lookAheadBuffer ? 0 : (samples > lookAheadWrapMask ? lookAheadWrapMask : samples);
+	}
+
+	/** write xn into the look-ahead delay and return the sample from lookAheadSamples ago */
+	inline double delayLookAhead(double xn)
+	{
+		lookAheadBuffer[lookAheadWriteIndex] = xn;
+		const double yn = lookAheadBuffer[(lookAheadWriteIndex - lookAheadSamples) & lookAheadWrapMask];
+		lookAheadWriteIndex = (lookAheadWriteIndex + 1) & lookAheadWrapMask;
+		return yn;
+	}
+
+	/** block loop shared by the processAudioBlock( ) versions; the key is the input, the aux channels or the held sidechain sample */
+	template <typename BlockType, typename KeyType>
+	bool processBlock(const BlockType* inputBlock, BlockType* outputBlock, uint32_t numSamples,
+					  const KeyType* const* keyInputs, uint32_t numKeyChannels, uint32_t keyStartIndex)
+	{
+		double sidechain[kEnvelopeBlockSize];
+		double detect_dB[kEnvelopeBlockSize];
+		double* envelope = &detect_dB[0];
+
+		if (!keyInputs)
+			numKeyChannels = 0;
+
+		for (uint32_t start = 0; start < numSamples; start += kEnvelopeBlockSize)
+		{
+			const uint32_t count = numSamples - start < kEnvelopeBlockSize ? numSamples - start : kEnvelopeBlockSize;
+
+			// --- detect input, the aux inputs or the (held) sidechain sample
+			if (parameters.enableSidechain && numKeyChannels == 1)
+			{
+				const KeyType* key = &keyInputs[0][keyStartIndex + start];
+				detector.processAudioBlock(&key, &envelope, count);
+				sidechainInputSample = key[count - 1];
+			}
+			else if (parameters.enableSidechain && numKeyChannels > 1)
+			{
+				// --- average the aux channels to a mono key
+				const double scale = 1.0 / numKeyChannels;
+				for (uint32_t i = 0; i < count; i++)
+					sidechain[i] = keyInputs[0][keyStartIndex + start + i];
+				for (uint32_t channel = 1; channel < numKeyChannels; channel++)
+					for (uint32_t i = 0; i < count; i++)
+						sidechain[i] += keyInputs[channel][keyStartIndex + start + i];
+				for (uint32_t i = 0; i < count; i++)
+					sidechain[i] *= scale;
+
+				const double* sidechainInput = &sidechain[0];
+				detector.processAudioBlock(&sidechainInput, &envelope, count);
+				sidechainInputSample = sidechain[count - 1];
+			}
+			else if (parameters.enableSidechain)
+			{
+				const double* sidechainInput = &sidechain[0];
+				for (uint32_t i = 0; i < count; i++)
+					sidechain[i] = sidechainInputSample;
+				detector.processAudioBlock(&sidechainInput, &envelope, count);
+			}
+			else
+			{
+				const BlockType* input = &inputBlock[start];
+				detector.processAudioBlock(&input, &envelope, count);
+			}
+
+			// --- do DCA + makeup gain, on the delayed main path when looking ahead
+			if (lookAheadSamples > 0)
+			{
+				for (uint32_t i = 0; i < count; i++)
+					outputBlock[start + i] = (BlockType)(delayLookAhead(inputBlock[start + i]) * computeGain(detect_dB[i]) * makeupGain);
+			}
+			else
+			{
+				for (uint32_t i = 0; i < count; i++)
+					outputBlock[start + i] = (BlockType)(inputBlock[start + i] * computeGain(detect_dB[i]) * makeupGain);
+			}
+		}
+		return true;
+	}
+
 	/** compute (and save) the current gain value based on detected input (dB) */
 	inline double computeGain(double detect_dB)
 	{
@@ -2212,7 +3460,7 @@ protected:
 
 		// --- convert gain; store values for user meters
 		parameters.gainReduction_dB = output_dB - detect_dB;
-		parameters.gainReduction = pow(10.0, (parameters.gainReduction_dB) / 20.0);
+		parameters.gainReduction = parameters.useFastMath ? fastDB2Raw(parameters.gainReduction_dB) : pow(10.0, (parameters.gainReduction_dB) / 20.0);
 
 		// --- the current gain coefficient value
 		return parameters.gainReduction;
@@ -2373,7 +3621,7 @@ public:
 		double fraction = delayInFractionalSamples - (int)delayInFractionalSamples;
 
 		// --- do the interpolation (you could try different types here)
-		return doLinearInterpolation(y1, y2, fraction);
+		return static_cast<T>(doLinearInterpolation(y1, y2, fraction));
 	}
 
 	/** enable or disable interpolation; usually used for diagnostics or in algorithms that require strict integer samples times */
@@ -2395,6 +3643,9 @@ private:
 The ImpulseConvolver object implements a linear conovlver. NOTE: compile in Release mode or you may experice stuttering,
 glitching or other sample-drop activity.
 
+setImpulseResponse( ) switches IRs instantly; crossfadeImpulseResponse( ) fades to the new IR by running both
+convolutions for the length of the fade.
+
 Audio I/O:
 - Processes mono input to mono output.
 
@@ -2403,10 +3654,10 @@ Control I/F:
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\version Revision : 1.1 crossfaded IR changes (Steve Dwyer)
+\date Date : 2026 / 10 / 17
 */
-class ImpulseConvolver : public IAudioSignalProcessor
+class ImpulseConvolver : public BlockProcessorMixin<ImpulseConvolver>
 {
 public:
 	ImpulseConvolver() {
@@ -2435,8 +3686,31 @@ public:
 		//     this is the only time we do not read before write!
 		signalBuffer.writeBuffer(xn);
 
-		// --- do the convolution
-		for (unsigned int i = 0; i < length; i++)
+		// --- crossfading: convolve with both IRs and mix, see crossfadeImpulseResponse( )
+		if (crossfadeCounter > 0)
+		{
+			LinearBuffer<double>& nextIRBuffer = irBuffers[1 - currentIR];
+			double nextOutput = 0.0;
+			for (unsigned int i = 0; i < length; i++)
+			{
+				double signal = signalBuffer.readBuffer((int)i);
+				output += signal*irBuffers[currentIR].readBuffer((int)i);
+				nextOutput += signal*nextIRBuffer.readBuffer((int)i);
+			}
+
+			// --- linear fade, the last sample of the fade is all new IR
+			double fadeIn = (double)(crossfadeLength - crossfadeCounter + 1) / (double)crossfadeLength;
+			output += fadeIn*(nextOutput - output);
+
+			if (--crossfadeCounter == 0)
+				currentIR = 1 - currentIR;
+
+			return output;
+		}
+
+		// --- do the convolution
+		LinearBuffer<double>& irBuffer = irBuffers[currentIR];
+		for (unsigned int i = 0; i < length; i++)
 		{
 			// --- y(n) += x(n)h(n)
 			//     for signalBuffer.readBuffer(0) -> x(n)
@@ -2460,33 +3734,66 @@ public:
 		length = lengthPowerOfTwo;
 		// --- create (and clear out) the buffers
 		signalBuffer.createCircularBufferPowerOfTwo(lengthPowerOfTwo);
-		irBuffer.createLinearBuffer(lengthPowerOfTwo);
+		irBuffers[0].createLinearBuffer(lengthPowerOfTwo);
+		irBuffers[1].createLinearBuffer(lengthPowerOfTwo);
+		currentIR = 0;
+		crossfadeCounter = 0;
 	}
 
 	/** set the impulse response */
 	void setImpulseResponse(double* irArray, unsigned int lengthPowerOfTwo)
 	{
 		if (lengthPowerOfTwo != length)
+			init(lengthPowerOfTwo);
+
+		// --- an instant change cancels any crossfade
+		crossfadeCounter = 0;
+
+		// --- load up the IR buffer
+		for (unsigned int i = 0; i < length; i++)
+		{
+			irBuffers[currentIR].writeBuffer(i, irArray[i]);
+		}
+	}
+
+	/** crossfade from the current impulse response to a new one of the same length over _crossfadeLength samples;
+	    the IR is copied, so the array may be reused as soon as this returns. A crossfade in progress is completed
+	    first. Real-time safe. */
+	void crossfadeImpulseResponse(const double* irArray, unsigned int _crossfadeLength)
+	{
+		if (crossfadeCounter > 0)
 		{
-			length = lengthPowerOfTwo;
-			// --- create (and clear out) the buffers
-			signalBuffer.createCircularBufferPowerOfTwo(lengthPowerOfTwo);
-			irBuffer.createLinearBuffer(lengthPowerOfTwo);
+			currentIR = 1 - currentIR;
+			crossfadeCounter = 0;
 		}
 
-		// --- load up the IR buffer
+		LinearBuffer<double>& nextIRBuffer = irBuffers[1 - currentIR];
 		for (unsigned int i = 0; i < length; i++)
+			nextIRBuffer.writeBuffer(i, irArray[i]);
+
+		// --- no fade: just switch
+		if (_crossfadeLength == 0)
 		{
-			irBuffer.writeBuffer(i, irArray[i]);
+			currentIR = 1 - currentIR;
+			return;
 		}
+
+		crossfadeLength = _crossfadeLength;
+		crossfadeCounter = _crossfadeLength;
 	}
 
+	/** true while crossfadeImpulseResponse( ) is fading */
+	bool isCrossfading() { return crossfadeCounter > 0; }
+
 protected:
 	// --- delay buffer of doubles
 	CircularBuffer<double> signalBuffer; ///< circulat buffer for the signal
-	LinearBuffer<double> irBuffer;	///< linear buffer for the IR
+	LinearBuffer<double> irBuffers[2];	///< linear buffers for the current IR and the IR being crossfaded to
+	unsigned int currentIR = 0;			///< index of the current IR in irBuffers
 
 	unsigned int length = 0;	///< length of convolution (buffer)
+	unsigned int crossfadeLength = 0;	///< length of the crossfade in progress
+	unsigned int crossfadeCounter = 0;	///< samples left in the crossfade in progress
 
 };
 
@@ -2534,6 +3841,13 @@ The AnalogFIRFilter object implements a somewhat silly algorithm that implaments
 magnitude response as a FIR filter. NOT DESIGNED to replace virtual analog; rather it is intended to show the
 frequency sampling method in an easy (and fun) way.
 
+The IR is designed with an inverse FFT (freqSampleFFT( )). reset( ) designs the IR for the current parameters
+synchronously, then starts a worker thread owned by the object: setParameters( ) only posts the request, the
+worker publishes each new IR with a lock-free buffer swap and processAudioSample( ) crossfades the convolver to
+it over IR_LEN samples, so sweeping fc or Q never stalls the audio thread on a design. Call
+enableBackgroundDesign(false) before reset( ) to design synchronously in setParameters( ) (offline rendering,
+deterministic output).
+
 Audio I/O:
 - Processes mono input to mono output.
 
@@ -2542,19 +3856,23 @@ Control I/F:
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\version Revision : 1.1 FFT design on a worker thread, crossfaded IR updates (Steve Dwyer)
+\date Date : 2026 / 10 / 17
 */
-class AnalogFIRFilter : public IAudioSignalProcessor
+class AnalogFIRFilter : public BlockProcessorMixin<AnalogFIRFilter>
 {
 public:
 	AnalogFIRFilter() {}	/* C-TOR */
-	~AnalogFIRFilter() {}	/* D-TOR */
+	~AnalogFIRFilter() { stopDesignThread(); }	/* D-TOR */
 
 public:
-	/** reset members to initialized state */
+	/** reset members to initialized state; designs the IR for the current parameters and (re)starts the design thread
+	//	   do NOT call from realtime audio thread */
 	virtual bool reset(double _sampleRate)
 	{
+		// --- the worker reads sampleRate and analogMagArray; stop it while they change
+		stopDesignThread();
+
 		sampleRate = _sampleRate;
 		convolver.reset(_sampleRate);
 		convolver.init(IR_LEN);
@@ -2562,6 +3880,21 @@ public:
 		memset(&analogMagArray[0], 0, sizeof(double) * IR_LEN);	///< clear
 		memset(&irArray[0], 0, sizeof(double) * IR_LEN);	///< clear
 
+		// --- drop any IR the worker published for the old sample rate
+		backIR = 0;
+		frontIR = 1;
+		sharedIR.store(2);
+
+		// --- the first IR is designed here, so the filter is not silent until the worker catches up
+		if (parameters.fc > 0.0)
+		{
+			designImpulseResponse(parameters.filterType, parameters.fc, parameters.Q, irArray);
+			convolver.setImpulseResponse(irArray, IR_LEN);
+		}
+
+		if (backgroundDesign)
+			startDesignThread();
+
 		return true;
 	}
 
@@ -2572,6 +3905,13 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
+		// --- pick up a new IR from the design thread; a fade in progress finishes first
+		if (!convolver.isCrossfading() && (sharedIR.load(std::memory_order_relaxed) & kNewIRFlag))
+		{
+			frontIR = sharedIR.exchange(frontIR, std::memory_order_acq_rel) & ~kNewIRFlag;
+			convolver.crossfadeImpulseResponse(&designedIRs[frontIR][0], IR_LEN);
+		}
+
 		// --- do the linear convolution
 		return convolver.processAudioSample(xn);
 	}
@@ -2579,6 +3919,15 @@ public:
 	/** return false: this object only processes samples */
 	virtual bool canProcessAudioFrame() { return false; }
 
+	/** design on a worker thread (default) or synchronously in setParameters( ); call before reset( )
+	//	   do NOT call from realtime audio thread */
+	void enableBackgroundDesign(bool enable)
+	{
+		backgroundDesign = enable;
+		if (!enable)
+			stopDesignThread();
+	}
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return AnalogFIRFilterParameters custom data structure
@@ -2595,36 +3944,131 @@ public:
 			_parameters.Q != parameters.Q ||
 			_parameters.filterType != parameters.filterType)
 		{
-			// --- set the filter IR for the convolver
-			AnalogMagData analogFilterData;
-			analogFilterData.sampleRate = sampleRate;
-			analogFilterData.magArray = &analogMagArray[0];
-			analogFilterData.dftArrayLen = IR_LEN;
-			analogFilterData.mirrorMag = false;
+			if (designThread.joinable())
+			{
+				// --- post the request under the lock, so the worker cannot check for it and then miss the
+				//     notify; the worker only holds the lock to check, never while designing
+				{
+					std::lock_guard<std::mutex> lock(designMutex);
+					requestedFilterType.store((int)_parameters.filterType, std::memory_order_relaxed);
+					requestedFc.store(_parameters.fc, std::memory_order_relaxed);
+					requestedQ.store(_parameters.Q, std::memory_order_relaxed);
+					requestCount.fetch_add(1, std::memory_order_release);
+				}
+				designCondition.notify_one();
+			}
+			else
+			{
+				// --- set the filter IR for the convolver
+				designImpulseResponse(_parameters.filterType, _parameters.fc, _parameters.Q, irArray);
 
-			analogFilterData.filterType = _parameters.filterType;
-			analogFilterData.fc = _parameters.fc; // 1000.0;
-			analogFilterData.Q = _parameters.Q;
+				// --- update new frequency response
+				convolver.setImpulseResponse(irArray, IR_LEN);
+			}
+		}
+
+		parameters = _parameters;
+	}
 
-			// --- calculate the analog mag array
-			calculateAnalogMagArray(analogFilterData);
+private:
+	/** frequency sample the analog magnitude response into an IR_LEN IR */
+	void designImpulseResponse(analogFilter filterType, double fc, double Q, double* ir)
+	{
+		AnalogMagData analogFilterData;
+		analogFilterData.sampleRate = sampleRate;
+		analogFilterData.magArray = &analogMagArray[0];
+		analogFilterData.dftArrayLen = IR_LEN;
+		analogFilterData.mirrorMag = false;
 
-			// --- frequency sample the mag array
-			freqSample(IR_LEN, analogMagArray, irArray, POSITIVE);
+		analogFilterData.filterType = filterType;
+		analogFilterData.fc = fc;
+		analogFilterData.Q = Q;
 
-			// --- update new frequency response
-			convolver.setImpulseResponse(irArray, IR_LEN);
+		// --- calculate the analog mag array
+		calculateAnalogMagArray(analogFilterData);
+
+		// --- frequency sample the mag array
+		freqSampleFFT(IR_LEN, analogMagArray, ir, designScratch);
+	}
+
+	/** start the design thread if it is not running */
+	void startDesignThread()
+	{
+		if (designThread.joinable())
+			return;
+
+		// --- read the count here, not on the new thread, so a request posted right after reset( ) is not missed
+		stopDesign.store(false);
+		const uint32_t designedCount = requestCount.load(std::memory_order_acquire);
+		designThread = std::thread([this, designedCount]() { designThreadLoop(designedCount); });
+	}
+
+	/** stop and join the design thread */
+	void stopDesignThread()
+	{
+		if (!designThread.joinable())
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(designMutex);
+			stopDesign.store(true);
 		}
+		designCondition.notify_all();
+		designThread.join();
+	}
 
-		parameters = _parameters;
+	/** the design thread: design the latest request into the back IR, then swap it with the shared IR */
+	void designThreadLoop(uint32_t designedCount)
+	{
+		while (!stopDesign.load())
+		{
+			{
+				// --- requests are posted under the lock, see setParameters( )
+				std::unique_lock<std::mutex> lock(designMutex);
+				designCondition.wait(lock, [&]()
+				{
+					return stopDesign.load() || requestCount.load(std::memory_order_acquire) != designedCount;
+				});
+			}
+
+			const uint32_t count = requestCount.load(std::memory_order_acquire);
+			if (stopDesign.load() || count == designedCount)
+				continue;
+
+			designedCount = count;
+			designImpulseResponse((analogFilter)requestedFilterType.load(std::memory_order_relaxed),
+								  requestedFc.load(std::memory_order_relaxed),
+								  requestedQ.load(std::memory_order_relaxed), &designedIRs[backIR][0]);
+
+			// --- publish: the previous shared IR (taken or not) becomes the next back IR
+			backIR = sharedIR.exchange(backIR | kNewIRFlag, std::memory_order_acq_rel) & ~kNewIRFlag;
+		}
 	}
 
-private:
 	AnalogFIRFilterParameters parameters; ///< object parameters
 	ImpulseConvolver convolver; ///< convolver object to perform FIR convolution
 	double analogMagArray[IR_LEN]; ///< array for analog magnitude response
 	double irArray[IR_LEN]; ///< array to hold calcualted IR
+	double designScratch[2 * IR_LEN]; ///< FFT working memory for freqSampleFFT( )
 	double sampleRate = 0.0; ///< storage for sample rate
+
+	// --- background design: three IRs so that neither thread ever waits; the design thread owns
+	//     backIR, the audio thread owns frontIR and they swap through sharedIR
+	static const unsigned int kNewIRFlag = 4;		///< set in sharedIR when it holds an IR the audio thread has not taken
+	double designedIRs[3][IR_LEN];					///< the IRs designed by the design thread
+	unsigned int backIR = 0;						///< IR the design thread writes (design thread only)
+	unsigned int frontIR = 1;						///< IR the convolver last took (audio thread only)
+	std::atomic<unsigned int> sharedIR{ 2 };		///< the IR in between, plus kNewIRFlag
+
+	bool backgroundDesign = true;					///< design on the worker thread
+	std::thread designThread;						///< the worker
+	std::mutex designMutex;							///< guards posting a request against the worker's check, for designCondition
+	std::condition_variable designCondition;		///< wakes the worker
+	std::atomic<bool> stopDesign{ false };			///< tells the worker to exit
+	std::atomic<uint32_t> requestCount{ 0 };		///< incremented for every posted request
+	std::atomic<int> requestedFilterType{ 0 };		///< latest requested filter type
+	std::atomic<double> requestedFc{ 0.0 };			///< latest requested fc
+	std::atomic<double> requestedQ{ 0.0 };			///< latest requested Q
 };
 
 /**
@@ -2705,11 +4149,14 @@ struct AudioDelayParameters
 };
 
 /**
-\class AudioDelay
+\class AudioDelayT
 \ingroup FX-Objects
 \brief
 The AudioDelay object implements a stereo audio delay with multiple delay algorithms.
 
+SampleType (float or double) sets the type of the delay buffers and the mix arithmetic; the delay times
+keep their fractional part in double. AudioDelay is the double precision version.
+
 Audio I/O:
 - Processes mono input to mono output OR stereo output.
 
@@ -2721,11 +4168,14 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class AudioDelay : public IAudioSignalProcessor
+template <typename SampleType>
+class AudioDelayT : public IAudioSignalProcessor
 {
+	static_assert(std::is_floating_point<SampleType>::value, "AudioDelayT requires float or double");
+
 public:
-	AudioDelay() {}		/* C-TOR */
-	~AudioDelay() {}	/* D-TOR */
+	AudioDelayT() {}	/* C-TOR */
+	~AudioDelayT() {}	/* D-TOR */
 
 public:
 	/** reset members to initialized state */
@@ -2753,21 +4203,35 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
+		const SampleType x = static_cast<SampleType>(xn);
+
 		// --- read delay
-		double yn = delayBuffer_L.readBuffer(delayInSamples_L);
+		SampleType yn = delayBuffer_L.readBuffer(delayInSamples_L);
 
 		// --- create input for delay buffer
-		double dn = xn + (parameters.feedback_Pct / 100.0) * yn;
+		SampleType dn = x + static_cast<SampleType>(parameters.feedback_Pct / 100.0) * yn;
 
 		// --- write to delay buffer
 		delayBuffer_L.writeBuffer(dn);
 
 		// --- form mixture out = dry*xn + wet*yn
-		double output = dryMix*xn + wetMix*yn;
+		SampleType output = dryMix*x + wetMix*yn;
 
 		return output;
 	}
 
+	/** process a block of MONO audio delay */
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples);
+	}
+
+	/** process a block of 64-bit samples (VST3 kSample64) */
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples);
+	}
+
 	/** return true: this object can also process frames */
 	virtual bool canProcessAudioFrame() { return true; }
 
@@ -2799,22 +4263,23 @@ public:
 		// --- pick up inputs
 		//
 		// --- LEFT channel
-		double xnL = inputFrame[0];
+		SampleType xnL = inputFrame[0];
 
 		// --- RIGHT channel (duplicate left input if mono-in)
-		double xnR = inputChannels > 1 ? inputFrame[1] : xnL;
+		SampleType xnR = inputChannels > 1 ? inputFrame[1] : xnL;
 
 		// --- read delay LEFT
-		double ynL = delayBuffer_L.readBuffer(delayInSamples_L);
+		SampleType ynL = delayBuffer_L.readBuffer(delayInSamples_L);
 
 		// --- read delay RIGHT
-		double ynR = delayBuffer_R.readBuffer(delayInSamples_R);
+		SampleType ynR = delayBuffer_R.readBuffer(delayInSamples_R);
 
 		// --- create input for delay buffer with LEFT channel info
-		double dnL = xnL + (parameters.feedback_Pct / 100.0) * ynL;
+		const SampleType feedback = static_cast<SampleType>(parameters.feedback_Pct / 100.0);
+		SampleType dnL = xnL + feedback * ynL;
 
 		// --- create input for delay buffer with RIGHT channel info
-		double dnR = xnR + (parameters.feedback_Pct / 100.0) * ynR;
+		SampleType dnR = xnR + feedback * ynR;
 
 		// --- decode
 		if (parameters.algorithm == delayAlgorithm::kNormal)
@@ -2835,10 +4300,10 @@ public:
 		}
 
 		// --- form mixture out = dry*xn + wet*yn
-		double outputL = dryMix*xnL + wetMix*ynL;
+		SampleType outputL = dryMix*xnL + wetMix*ynL;
 
 		// --- form mixture out = dry*xn + wet*yn
-		double outputR = dryMix*xnR + wetMix*ynR;
+		SampleType outputR = dryMix*xnR + wetMix*ynR;
 
 		// --- set left channel
 		outputFrame[0] = outputL;
@@ -2863,9 +4328,9 @@ public:
 	{
 		// --- check mix in dB for calc
 		if (_parameters.dryLevel_dB != parameters.dryLevel_dB)
-			dryMix = pow(10.0, _parameters.dryLevel_dB / 20.0);
+			dryMix = static_cast<SampleType>(pow(10.0, _parameters.dryLevel_dB / 20.0));
 		if (_parameters.wetLevel_dB != parameters.wetLevel_dB)
-			wetMix = pow(10.0, _parameters.wetLevel_dB / 20.0);
+			wetMix = static_cast<SampleType>(pow(10.0, _parameters.wetLevel_dB / 20.0));
 
 		// --- save; rest of updates are cheap on CPU
 		parameters = _parameters;
@@ -2922,14 +4387,39 @@ private:
 	double delayInSamples_R = 0.0;	///< double includes fractional part
 	double bufferLength_mSec = 0.0;	///< buffer length in mSec
 	unsigned int bufferLength = 0;	///< buffer length in samples
-	double wetMix = 0.707; ///< wet output default = -3dB
-	double dryMix = 0.707; ///< dry output default = -3dB
+	SampleType wetMix = SampleType(0.707); ///< wet output default = -3dB
+	SampleType dryMix = SampleType(0.707); ///< dry output default = -3dB
 
-	// --- delay buffer of doubles
-	CircularBuffer<double> delayBuffer_L;	///< LEFT delay buffer of doubles
-	CircularBuffer<double> delayBuffer_R;	///< RIGHT delay buffer of doubles
+	// --- delay buffers of SampleType
+	CircularBuffer<SampleType> delayBuffer_L;	///< LEFT delay buffer
+	CircularBuffer<SampleType> delayBuffer_R;	///< RIGHT delay buffer
+
+	/** block loop shared by the float and double processAudioBlock( ) versions */
+	template <typename BlockType>
+	bool processBlock(const BlockType* inputBlock, BlockType* outputBlock, uint32_t numSamples)
+	{
+		const SampleType feedback = static_cast<SampleType>(parameters.feedback_Pct / 100.0);
+
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			SampleType xn = inputBlock[i];
+
+			// --- read delay
+			SampleType yn = delayBuffer_L.readBuffer(delayInSamples_L);
+
+			// --- write to delay buffer
+			delayBuffer_L.writeBuffer(xn + feedback * yn);
+
+			// --- form mixture out = dry*xn + wet*yn
+			outputBlock[i] = (BlockType)(dryMix*xn + wetMix*yn);
+		}
+		return true;
+	}
 };
 
+/** the double precision AudioDelay used throughout the FX objects */
+using AudioDelay = AudioDelayT<double>;
+
 
 /**
 \enum generatorWaveform
@@ -2977,12 +4467,15 @@ struct OscillatorParameters
 };
 
 /**
-\class LFO
+\class LFOT
 \ingroup FX-Objects
 \brief
 The LFO object implements a mathematically perfect LFO generator for modulation uses only. It should not be used for
 audio frequencies except for the sinusoidal output which, though an approximation, has very low TDH.
 
+SampleType (float or double) sets the precision of the waveform calculations; the modulo counters stay double
+because a float phase increment is too coarse at low rates and high sample rates. LFO is the double precision version.
+
 Audio I/O:
 - Output only object: low frequency generator.
 
@@ -2994,11 +4487,14 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class LFO : public IAudioSignalGenerator
+template <typename SampleType>
+class LFOT : public IAudioSignalGenerator
 {
+	static_assert(std::is_floating_point<SampleType>::value, "LFOT requires float or double");
+
 public:
-	LFO() {	srand(time(NULL)); }	/* C-TOR */
-	virtual ~LFO() {}				/* D-TOR */
+	LFOT() {	srand(time(NULL)); }	/* C-TOR */
+	virtual ~LFOT() {}				/* D-TOR */
 
 	/** reset members to initialized state */
 	virtual bool reset(double _sampleRate)
@@ -3035,6 +4531,9 @@ public:
 	/** render a new audio output structure */
 	virtual const SignalGenData renderAudioOutput();
 
+	/** render a block of audio output structures; see fxobjects.cpp */
+	virtual void renderAudioBlock(SignalGenData* outputBlock, uint32_t numSamples);
+
 protected:
 	// --- parameters
 	OscillatorParameters lfoParameters; ///< obejcgt parameters
@@ -3093,18 +4592,25 @@ protected:
 	/** advanvce the modulo counter */
 	inline void advanceModulo(double& moduloCounter, double phaseInc) { moduloCounter += phaseInc; }
 
-	const double B = 4.0 / kPi;
-	const double C = -4.0 / (kPi* kPi);
-	const double P = 0.225;
+	const SampleType B = static_cast<SampleType>(4.0 / kPi);
+	const SampleType C = static_cast<SampleType>(-4.0 / (kPi* kPi));
+	const SampleType P = static_cast<SampleType>(0.225);
 	/** parabolic sinusoidal calcualtion; NOTE: input is -pi to +pi http://devmaster.net/posts/9648/fast-and-accurate-sine-cosine */
-	inline double parabolicSine(double angle)
+	inline SampleType parabolicSine(SampleType angle)
 	{
-		double y = B * angle + C * angle * fabs(angle);
+		SampleType y = B * angle + C * angle * fabs(angle);
 		y = P * (y * fabs(y) - y) + y;
 		return y;
 	}
 };
 
+// --- the out-of-line members are compiled for float and double in fxobjects.cpp
+extern template class LFOT<float>;
+extern template class LFOT<double>;
+
+/** the double precision LFO used throughout the FX objects */
+using LFO = LFOT<double>;
+
 /**
 \enum DFOscillatorCoeffs
 \ingroup Constants-Enums
@@ -3324,7 +4830,7 @@ Control I / F :
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class ModulatedDelay : public IAudioSignalProcessor
+class ModulatedDelay : public BlockProcessorMixin<ModulatedDelay>
 {
 public:
 	ModulatedDelay() {
@@ -3557,7 +5063,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class PhaseShifter : public IAudioSignalProcessor
+class PhaseShifter : public BlockProcessorMixin<PhaseShifter>
 {
 public:
 	PhaseShifter(void) {
@@ -3750,7 +5256,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class SimpleLPF : public IAudioSignalProcessor
+class SimpleLPF : public BlockProcessorMixin<SimpleLPF>
 {
 public:
 	SimpleLPF(void) {}	/* C-TOR */
@@ -3854,7 +5360,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class SimpleDelay : public IAudioSignalProcessor
+class SimpleDelay : public BlockProcessorMixin<SimpleDelay>
 {
 public:
 	SimpleDelay(void) {}	/* C-TOR */
@@ -4034,7 +5540,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class CombFilter : public IAudioSignalProcessor
+class CombFilter : public BlockProcessorMixin<CombFilter>
 {
 public:
 	CombFilter(void) {}		/* C-TOR */
@@ -4204,7 +5710,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class DelayAPF : public IAudioSignalProcessor
+class DelayAPF : public BlockProcessorMixin<DelayAPF>
 {
 public:
 	DelayAPF(void) {}	/* C-TOR */
@@ -4277,7 +5783,7 @@ public:
 		double yn = -apf_g*wn + wnD;
 
 		// underflow check
-		checkFloatUnderflow(yn);
+		checkOptionalFloatUnderflow(yn);
 
 		// write delay line
 		delay.writeDelay(wn);
@@ -4405,7 +5911,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class NestedDelayAPF : public DelayAPF
+class NestedDelayAPF : public BlockProcessorMixin<NestedDelayAPF, DelayAPF>
 {
 public:
 	NestedDelayAPF(void) { }	/* C-TOR */
@@ -4479,7 +5985,7 @@ public:
 		double yn = -apf_g*wn + wnD;
 
 		// --- underflow check
-		checkFloatUnderflow(yn);
+		checkOptionalFloatUnderflow(yn);
 
 		// --- write delay line
 		delay.writeDelay(ynInner);
@@ -4588,7 +6094,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class TwoBandShelvingFilter : public IAudioSignalProcessor
+class TwoBandShelvingFilter : public BlockProcessorMixin<TwoBandShelvingFilter>
 {
 public:
 	TwoBandShelvingFilter()
@@ -4765,10 +6271,13 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class ReverbTank : public IAudioSignalProcessor
+class ReverbTank : public BlockProcessorMixin<ReverbTank>
 {
 public:
-	ReverbTank() {}		/* C-TOR */
+	ReverbTank() {
+		dryMix = dB2Raw(parameters.dryLevel_dB);
+		wetMix = dB2Raw(parameters.wetLevel_dB);
+	}		/* C-TOR */
 	~ReverbTank() {}	/* D-TOR */
 
 	/** reset members to initialized state */
@@ -4781,7 +6290,7 @@ public:
 		preDelay.reset(_sampleRate);
 		preDelay.createDelayBuffer(_sampleRate, 100.0);
 
-		for (int i = 0; i < NUM_BRANCHES; i++)
+		for (uint32_t i = 0; i < NUM_BRANCHES; i++)
 		{
 			branchDelays[i].reset(_sampleRate);
 			branchDelays[i].createDelayBuffer(_sampleRate, 100.0);
@@ -4791,7 +6300,7 @@ public:
 
 			branchLPFs[i].reset(_sampleRate);
 		}
-		for (int i = 0; i < NUM_CHANNELS; i++)
+		for (uint32_t i = 0; i < NUM_CHANNELS; i++)
 		{
 			shelvingFilters[i].reset(_sampleRate);
 		}
@@ -4809,10 +6318,13 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
-		float inputs[2] = { 0.0, 0.0 };
-		float outputs[2] = { 0.0, 0.0 };
-		processAudioFrame(inputs, outputs, 1, 1);
-		return outputs[0];
+		// --- mono in, mono out in double precision: the same as processAudioFrame( ) with one channel each way
+		double tankOutL = 0.0;
+		double tankOutR = 0.0;
+		processTank(xn, tankOutL, tankOutR);
+
+		// --- sum with dry
+		return dryMix*xn + wetMix*(0.5*tankOutL + 0.5*tankOutR);
 	}
 
 	/** process stereo reverb tank */
@@ -4820,6 +6332,30 @@ public:
 		float* outputFrame,
 		uint32_t inputChannels,
 		uint32_t outputChannels)
+	{
+		// --- mono-ized input signal
+		double xnL = inputFrame[0];
+		double xnR = inputChannels > 1 ? inputFrame[1] : 0.0;
+		double monoXn = double(1.0 / inputChannels)*xnL + double(1.0 / inputChannels)*xnR;
+
+		double tankOutL = 0.0;
+		double tankOutR = 0.0;
+		processTank(monoXn, tankOutL, tankOutR);
+
+		// --- sum with dry
+		if (outputChannels == 1)
+			outputFrame[0] = (float)(dryMix*xnL + wetMix*(0.5*tankOutL + 0.5*tankOutR));
+		else
+		{
+			outputFrame[0] = (float)(dryMix*xnL + wetMix*tankOutL);
+			outputFrame[1] = (float)(dryMix*xnR + wetMix*tankOutR);
+		}
+
+		return true;
+	}
+
+	/** run the tank for one mono-ized input sample; returns the filtered (wet) stereo outputs */
+	void processTank(double monoXn, double& tankOutL, double& tankOutR)
 	{
 		// --- global feedback from delay in last branch
 		double globFB = branchDelays[NUM_BRANCHES-1].readDelay();
@@ -4827,17 +6363,12 @@ public:
 		// --- feedback value
 		double fb = parameters.kRT*(globFB);
 
-		// --- mono-ized input signal
-		double xnL = inputFrame[0];
-		double xnR = inputChannels > 1 ? inputFrame[1] : 0.0;
-		double monoXn = double(1.0 / inputChannels)*xnL + double(1.0 / inputChannels)*xnR;
-
 		// --- pre delay output
 		double preDelayOut = preDelay.processAudioSample(monoXn);
 
 		// --- input to first branch = preDalay + globFB
 		double input = preDelayOut + fb;
-		for (int i = 0; i < NUM_BRANCHES; i++)
+		for (uint32_t i = 0; i < NUM_BRANCHES; i++)
 		{
 			double apfOut = branchNestedAPFs[i].processAudioSample(input);
 			double lpfOut = branchLPFs[i].processAudioSample(apfOut);
@@ -4882,22 +6413,8 @@ public:
 		}
 
 		// ---  filter
-		double tankOutL = shelvingFilters[0].processAudioSample(outL);
-		double tankOutR = shelvingFilters[1].processAudioSample(outR);
-
-		// --- sum with dry
-		double dry = pow(10.0, parameters.dryLevel_dB / 20.0);
-		double wet = pow(10.0, parameters.wetLevel_dB / 20.0);
-
-		if (outputChannels == 1)
-			outputFrame[0] = dry*xnL + wet*(0.5*tankOutL + 0.5*tankOutR);
-		else
-		{
-			outputFrame[0] = dry*xnL + wet*tankOutL;
-			outputFrame[1] = dry*xnR + wet*tankOutR;
-		}
-
-		return true;
+		tankOutL = shelvingFilters[0].processAudioSample(outL);
+		tankOutR = shelvingFilters[1].processAudioSample(outR);
 	}
 
 	/** get parameters: note use of custom structure for passing param data */
@@ -4927,7 +6444,7 @@ public:
 		SimpleLPFParameters  lpfParams = branchLPFs[0].getParameters();
 		lpfParams.g = params.lpf_g;
 
-		for (int i = 0; i < NUM_BRANCHES; i++)
+		for (uint32_t i = 0; i < NUM_BRANCHES; i++)
 		{
 			branchLPFs[i].setParameters(lpfParams);
 		}
@@ -4951,7 +6468,7 @@ public:
 		apfParams.lfoMaxModulation_mSec = 0.3;
 		apfParams.lfoDepth = 1.0;
 
-		for (int i = 0; i < NUM_BRANCHES; i++)
+		for (uint32_t i = 0; i < NUM_BRANCHES; i++)
 		{
 			// --- setup APFs
 			apfParams.outerAPFdelayTime_mSec = globalAPFMaxDelay*apfDelayWeight[m++];
@@ -4974,6 +6491,12 @@ public:
 			branchDelays[i].setParameters(delayParams);
 		}
 
+		// --- the mix levels only change with the parameters so there is no need to re-calculate them per-frame
+		if (params.dryLevel_dB != parameters.dryLevel_dB)
+			dryMix = dB2Raw(params.dryLevel_dB);
+		if (params.wetLevel_dB != parameters.wetLevel_dB)
+			wetMix = dB2Raw(params.wetLevel_dB);
+
 		// --- save our copy
 		parameters = params;
 	}
@@ -4993,6 +6516,8 @@ private:
 	double apfDelayWeight[NUM_BRANCHES * 2] = { 0.317, 0.873, 0.477, 0.291, 0.993, 0.757, 0.179, 0.575 };///< weighting values to make various and low-correlated APF delay values easily
 	double fixedDelayWeight[NUM_BRANCHES] = { 1.0, 0.873, 0.707, 0.667 };	///< weighting values to make various and fixed delay values easily
 	double sampleRate = 0.0;	///< current sample rate
+	double dryMix = 1.0;		///< raw dry level, from parameters.dryLevel_dB
+	double wetMix = 1.0;		///< raw wet level, from parameters.wetLevel_dB
 };
 
 
@@ -5048,7 +6573,21 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
-		return dB2Raw(makeUpGain_dB)*xn*computeGain(detector.processAudioSample(xn));
+		double detect_dB = 0.0;
+		detector.processAudioFrame(&xn, &detect_dB);
+		return makeUpGain*xn*computeGain(detect_dB);
+	}
+
+	/** process a block of mono samples; the envelope is detected a block at a time, then the gains computed */
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples);
+	}
+
+	/** process a block of 64-bit samples (VST3 kSample64) */
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples);
 	}
 
 	/** compute the gain reductino value based on detected value in dB */
@@ -5085,6 +6624,9 @@ public:
 		}
 
 		// --- convert difference between threshold and detected to raw
+		if (useFastMath)
+			return fastDB2Raw(output_dB - detect_dB);
+
 		return  pow(10.0, (output_dB - detect_dB) / 20.0);
 	}
 
@@ -5092,12 +6634,46 @@ public:
 	void setThreshold_dB(double _threshold_dB) { threshold_dB = _threshold_dB; }
 
 	/** adjust makeup gain in dB*/
-	void setMakeUpGain_dB(double _makeUpGain_dB) { makeUpGain_dB = _makeUpGain_dB; }
+	void setMakeUpGain_dB(double _makeUpGain_dB) { makeUpGain_dB = _makeUpGain_dB; makeUpGain = dB2Raw(makeUpGain_dB); }
+
+	/** select fastRaw2dB( )/fastDB2Raw( ) (default) or log10( )/pow( ) for the detector and gain computer */
+	void setUseFastMath(bool _useFastMath)
+	{
+		useFastMath = _useFastMath;
+
+		AudioDetectorParameters detectorParams = detector.getParameters();
+		detectorParams.useFastMath = useFastMath;
+		detector.setParameters(detectorParams);
+	}
 
 protected:
-	AudioDetector detector;		///< the detector object
+	AudioDetectorBank<1> detector;	///< the detector object
 	double threshold_dB = 0.0;	///< stored threshold (dB)
 	double makeUpGain_dB = 0.0;	///< stored makeup gain (dB)
+	double makeUpGain = 1.0;	///< stored makeup gain (raw)
+	bool useFastMath = true;	///< fast dB conversions
+
+	// --- the block versions detect this many samples at a time, then compute the gains
+	static const uint32_t kEnvelopeBlockSize = 64;
+
+	/** block loop shared by the float and double processAudioBlock( ) versions */
+	template <typename BlockType>
+	bool processBlock(const BlockType* inputBlock, BlockType* outputBlock, uint32_t numSamples)
+	{
+		double detect_dB[kEnvelopeBlockSize];
+		double* envelope = &detect_dB[0];
+
+		for (uint32_t start = 0; start < numSamples; start += kEnvelopeBlockSize)
+		{
+			const uint32_t count = numSamples - start < kEnvelopeBlockSize ? numSamples - start : kEnvelopeBlockSize;
+			const BlockType* input = &inputBlock[start];
+			detector.processAudioBlock(&input, &envelope, count);
+
+			for (uint32_t i = 0; i < count; i++)
+				outputBlock[start + i] = (BlockType)(makeUpGain*inputBlock[start + i]*computeGain(detect_dB[i]));
+		}
+		return true;
+	}
 };
 
 
@@ -5147,6 +6723,7 @@ struct ZVAFilterParameters
 		matchAnalogNyquistLPF = params.matchAnalogNyquistLPF;
 		selfOscillate = params.selfOscillate;
 		enableNLP = params.enableNLP;
+		useFastMath = params.useFastMath;
 		return *this;
 	}
 
@@ -5159,14 +6736,17 @@ struct ZVAFilterParameters
 	bool matchAnalogNyquistLPF = false;		///< match analog gain at Nyquist
 	bool selfOscillate = false;				///< enable selfOscillation
 	bool enableNLP = false;					///< enable non linear processing (use oversampling for best results)
+	bool useFastMath = true;				///< NLP with fastSoftClipWaveShaper( ); false for softClipWaveShaper( )
 };
 
 
 /**
-\class ZVAFilter
+\class ZVAFilterT
 \ingroup FX-Objects
 \brief
 The ZVAFilter object implements multpile Zavalishin VA Filters.
+SampleType (float or double) sets the precision of the integrators, the coefficients and the arithmetic;
+the coefficients are calculated in double. ZVAFilter is the double precision version.
 Audio I/O:
 - Processes mono input to mono output.
 
@@ -5178,11 +6758,14 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class ZVAFilter : public IAudioSignalProcessor
+template <typename SampleType>
+class ZVAFilterT : public IAudioSignalProcessor
 {
+	static_assert(std::is_floating_point<SampleType>::value, "ZVAFilterT requires float or double");
+
 public:
-	ZVAFilter() {}		/* C-TOR */
-	~ZVAFilter() {}		/* D-TOR */
+	ZVAFilterT() {}		/* C-TOR */
+	~ZVAFilterT() {}	/* D-TOR */
 
 	/** reset members to initialized state */
 	virtual bool reset(double _sampleRate)
@@ -5209,6 +6792,15 @@ public:
 	*/
 	void setParameters(const ZVAFilterParameters& params)
 	{
+		// --- these only change with the parameters so there is no need to re-calculate them per-sample
+		if (params.Q != zvaFilterParameters.Q)
+		{
+			double peak_dB = dBPeakGainFor_Q(params.Q);
+			gainCompScalar = static_cast<SampleType>(peak_dB > 0.0 ? dB2Raw(-peak_dB / 2.0) : 1.0);
+		}
+		if (params.filterOutputGain_dB != zvaFilterParameters.filterOutputGain_dB)
+			filterOutputGain = static_cast<SampleType>(pow(10.0, params.filterOutputGain_dB / 20.0));
+
 		if (params.fc != zvaFilterParameters.fc ||
 			params.Q != zvaFilterParameters.Q ||
 			params.selfOscillate != zvaFilterParameters.selfOscillate ||
@@ -5221,6 +6813,23 @@ public:
 			zvaFilterParameters = params;
 	}
 
+	/** fast path for per-sample fc modulation */
+	/**
+	Only the fc dependent coefficients are re-calculated and the prewarping uses fastTan( ) in place of tan( ).
+	No other parameters are checked so use setParameters( ) for the un-modulated parameter changes.
+	\param fc the modulated cutoff frequency
+	*/
+	void setModulatedFc(double fc)
+	{
+		if (fc == zvaFilterParameters.fc)
+			return;
+
+		zvaFilterParameters.fc = fc;
+
+		// --- g = wa*T/2 = tan(wd*T/2)
+		calculateFilterCoeffs(fastTan(kPi*fc / sampleRate));
+	}
+
 	/** return false: this object only processes samples */
 	virtual bool canProcessAudioFrame() { return false; }
 
@@ -5230,6 +6839,12 @@ public:
 	\return the processed sample
 	*/
 	virtual double processAudioSample(double xn)
+	{
+		return processSample(static_cast<SampleType>(xn));
+	}
+
+	/** process one sample in SampleType precision; see processAudioSample( ) */
+	inline SampleType processSample(SampleType xn)
 	{
 		// --- with gain comp enabled, we reduce the input by
 		//     half the gain in dB at resonant peak
@@ -5238,14 +6853,7 @@ public:
 		bool matchAnalogNyquistLPF = zvaFilterParameters.matchAnalogNyquistLPF;
 
 		if (zvaFilterParameters.enableGainComp)
-		{
-			double peak_dB = dBPeakGainFor_Q(zvaFilterParameters.Q);
-			if (peak_dB > 0.0)
-			{
-				double halfPeak_dBGain = dB2Raw(-peak_dB / 2.0);
-				xn *= halfPeak_dBGain;
-			}
-		}
+			xn *= gainCompScalar;
 
 		// --- for 1st order filters:
 		if (filterAlgorithm == vaFilterAlgorithm::kLPF1 ||
@@ -5253,10 +6861,10 @@ public:
 			filterAlgorithm == vaFilterAlgorithm::kAPF1)
 		{
 			// --- create vn node
-			double vn = (xn - integrator_z[0])*alpha;
+			SampleType vn = (xn - integrator_z[0])*alpha;
 
 			// --- form LP output
-			double lpf = ((xn - integrator_z[0])*alpha) + integrator_z[0];
+			SampleType lpf = ((xn - integrator_z[0])*alpha) + integrator_z[0];
 
 			// double sn = integrator_z[0];
 
@@ -5264,10 +6872,10 @@ public:
 			integrator_z[0] = vn + lpf;
 
 			// --- form the HPF = INPUT = LPF
-			double hpf = xn - lpf;
+			SampleType hpf = xn - lpf;
 
 			// --- form the APF = LPF - HPF
-			double apf = lpf - hpf;
+			SampleType apf = lpf - hpf;
 
 			// --- set the outputs
 			if (filterAlgorithm == vaFilterAlgorithm::kLPF1)
@@ -5288,28 +6896,26 @@ public:
 		}
 
 		// --- form the HP output first
-		double hpf = alpha0*(xn - rho*integrator_z[0] - integrator_z[1]);
+		SampleType hpf = alpha0*(xn - rho*integrator_z[0] - integrator_z[1]);
 
 		// --- BPF Out
-		double bpf = alpha*hpf + integrator_z[0];
+		SampleType bpf = alpha*hpf + integrator_z[0];
 		if (zvaFilterParameters.enableNLP)
-			bpf = softClipWaveShaper(bpf, 1.0);
+			bpf = static_cast<SampleType>(zvaFilterParameters.useFastMath ? fastSoftClipWaveShaper(bpf, 1.0) : softClipWaveShaper(bpf, 1.0));
 
 		// --- LPF Out
-		double lpf = alpha*bpf + integrator_z[1];
+		SampleType lpf = alpha*bpf + integrator_z[1];
 
 		// --- BSF Out
-		double bsf = hpf + lpf;
+		SampleType bsf = hpf + lpf;
 
 		// --- finite gain at Nyquist; slight error at VHF
-		double sn = integrator_z[0];
+		SampleType sn = integrator_z[0];
 
 		// update memory
 		integrator_z[0] = alpha*hpf + bpf;
 		integrator_z[1] = alpha*bpf + lpf;
 
-		double filterOutputGain = pow(10.0, zvaFilterParameters.filterOutputGain_dB / 20.0);
-
 		// return our selected type
 		if (filterAlgorithm == vaFilterAlgorithm::kSVF_LP)
 		{
@@ -5328,12 +6934,28 @@ public:
 		return filterOutputGain*lpf;
 	}
 
+	/** process a block of mono samples */
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+			outputBlock[i] = (float)processSample(inputBlock[i]);
+
+		return true;
+	}
+
+	/** process a block of 64-bit samples (VST3 kSample64); same as the float version, without the conversions */
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+			outputBlock[i] = processSample(inputBlock[i]);
+
+		return true;
+	}
+
 	/** recalculate the filter coefficients*/
 	void calculateFilterCoeffs()
 	{
 		double fc = zvaFilterParameters.fc;
-		double Q = zvaFilterParameters.Q;
-		vaFilterAlgorithm filterAlgorithm = zvaFilterParameters.filterAlgorithm;
 
 		// --- normal Zavalishin SVF calculations here
 		//     prewarp the cutoff- these are bilinear-transform filters
@@ -5342,25 +6964,38 @@ public:
 		double wa = (2.0 / T)*tan(wd*T / 2.0);
 		double g = wa*T / 2.0;
 
+		calculateFilterCoeffs(g);
+	}
+
+	/** recalculate the filter coefficients from the prewarped g value */
+	/**
+	\param g the prewarped gain wa*T/2
+	*/
+	void calculateFilterCoeffs(double g)
+	{
+		double fc = zvaFilterParameters.fc;
+		double Q = zvaFilterParameters.Q;
+		vaFilterAlgorithm filterAlgorithm = zvaFilterParameters.filterAlgorithm;
+
 		// --- for 1st order filters:
 		if (filterAlgorithm == vaFilterAlgorithm::kLPF1 ||
 			filterAlgorithm == vaFilterAlgorithm::kHPF1 ||
 			filterAlgorithm == vaFilterAlgorithm::kAPF1)
 		{
 			// --- calculate alpha
-			alpha = g / (1.0 + g);
+			alpha = static_cast<SampleType>(g / (1.0 + g));
 		}
 		else // state variable variety
 		{
 			// --- note R is the traditional analog damping factor zeta
 			double R = zvaFilterParameters.selfOscillate ? 0.0 : 1.0 / (2.0*Q);
-			alpha0 = 1.0 / (1.0 + 2.0*R*g + g*g);
-			alpha = g;
-			rho = 2.0*R + g;
+			alpha0 = static_cast<SampleType>(1.0 / (1.0 + 2.0*R*g + g*g));
+			alpha = static_cast<SampleType>(g);
+			rho = static_cast<SampleType>(2.0*R + g);
 
 			// --- sigma for analog matching version
 			double f_o = (sampleRate / 2.0) / fc;
-			analogMatchSigma = 1.0 / (alpha*f_o*f_o);
+			analogMatchSigma = static_cast<SampleType>(1.0 / (alpha*f_o*f_o));
 		}
 	}
 
@@ -5375,20 +7010,27 @@ protected:
 	double sampleRate = 44100.0;				///< current sample rate
 
 	// --- state storage
-	double integrator_z[2];						///< state variables
+	SampleType integrator_z[2];					///< state variables
 
 	// --- filter coefficients
-	double alpha0 = 0.0;		///< input scalar, correct delay-free loop
-	double alpha = 0.0;			///< alpha is (wcT/2)
-	double rho = 0.0;			///< p = 2R + g (feedback)
+	SampleType alpha0 = 0.0;	///< input scalar, correct delay-free loop
+	SampleType alpha = 0.0;		///< alpha is (wcT/2)
+	SampleType rho = 0.0;		///< p = 2R + g (feedback)
 
 	double beta = 0.0;			///< beta value, not used
 
 	// --- for analog Nyquist matching
-	double analogMatchSigma = 0.0; ///< analog matching Sigma value (see book)
+	SampleType analogMatchSigma = 0.0; ///< analog matching Sigma value (see book)
+
+	// --- gains, updated in setParameters( )
+	SampleType gainCompScalar = 1.0;	///< input scalar for gain compensation (half the peak gain in dB)
+	SampleType filterOutputGain = 1.0;	///< raw output gain
 
 };
 
+/** the double precision ZVAFilter used throughout the FX objects */
+using ZVAFilter = ZVAFilterT<double>;
+
 /**
 \struct EnvelopeFollowerParameters
 \ingroup FX-Objects
@@ -5415,6 +7057,7 @@ struct EnvelopeFollowerParameters
 		releaseTime_mSec = params.releaseTime_mSec;
 		threshold_dB = params.threshold_dB;
 		sensitivity = params.sensitivity;
+		useFastMath = params.useFastMath;
 
 		return *this;
 	}
@@ -5426,6 +7069,7 @@ struct EnvelopeFollowerParameters
 	double releaseTime_mSec = 10.0;	///< detector release time
 	double threshold_dB = 0.0;		///< detector threshold in dB
 	double sensitivity = 1.0;		///< detector sensitivity
+	bool useFastMath = true;		///< fast dB conversions and NLP in the detector and filter; false for the <math.h> versions
 };
 
 /**
@@ -5433,7 +7077,8 @@ struct EnvelopeFollowerParameters
 \ingroup FX-Objects
 \brief
 The EnvelopeFollower object implements a traditional envelope follower effect modulating a LPR fc value
-using the strength of the detected input.
+using the strength of the detected input. The block versions detect the envelope a block at a time with
+an AudioDetectorBank<1>, then modulate and run the filter per sample.
 
 Audio I/O:
 - Processes mono input to mono output.
@@ -5443,8 +7088,8 @@ Control I/F:
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\version Revision : 1.1 block envelope detection (Steve Dwyer)
+\date Date : 2026 / 10 / 17
 */
 class EnvelopeFollower : public IAudioSignalProcessor
 {
@@ -5501,12 +7146,24 @@ public:
 			filter.setParameters(filterParams);
 		}
 		if (params.attackTime_mSec != parameters.attackTime_mSec ||
-			params.releaseTime_mSec != parameters.releaseTime_mSec)
+			params.releaseTime_mSec != parameters.releaseTime_mSec ||
+			params.useFastMath != parameters.useFastMath)
 		{
 			adParams.attackTime_mSec = params.attackTime_mSec;
 			adParams.releaseTime_mSec = params.releaseTime_mSec;
+			adParams.useFastMath = params.useFastMath;
 			detector.setParameters(adParams);
 		}
+		if (params.useFastMath != parameters.useFastMath)
+		{
+			filterParams = filter.getParameters();
+			filterParams.useFastMath = params.useFastMath;
+			filter.setParameters(filterParams);
+		}
+
+		// --- the threshold only changes with the parameters so there is no need to re-calculate it per-sample
+		if (params.threshold_dB != parameters.threshold_dB)
+			threshValue = dB2Raw(params.threshold_dB);
 
 		// --- save
 		parameters = params;
@@ -5522,12 +7179,42 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
-		// --- calc threshold
-		double threshValue = pow(10.0, parameters.threshold_dB / 20.0);
-
 		// --- detect the signal
-		double detect_dB = detector.processAudioSample(xn);
-		double detectValue = pow(10.0, detect_dB / 20.0);
+		double detect_dB = 0.0;
+		detector.processAudioFrame(&xn, &detect_dB);
+
+		// --- perform the filtering operation
+		return modulateAndFilter(xn, detect_dB);
+	}
+
+	/** process a block of mono samples; the envelope is detected a block at a time, then the filter modulated per sample */
+	virtual bool processAudioBlock(const float* inputBlock, float* outputBlock, uint32_t numSamples)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples);
+	}
+
+	/** process a block of 64-bit samples (VST3 kSample64) */
+	virtual bool processAudioBlock(const double* inputBlock, double* outputBlock, uint32_t numSamples)
+	{
+		return processBlock(inputBlock, outputBlock, numSamples);
+	}
+
+protected:
+	EnvelopeFollowerParameters parameters; ///< object parameters
+
+	// --- 1 filter and 1 detector
+	ZVAFilter filter;		///< filter to modulate
+	AudioDetectorBank<1> detector; ///< detector to track input signal
+
+	double threshValue = 1.0; ///< detector threshold as a raw value
+
+	// --- the block versions detect this many samples at a time, then modulate the filter
+	static const uint32_t kEnvelopeBlockSize = 64;
+
+	/** modulate the filter fc from the detected value and filter x(n) */
+	inline double modulateAndFilter(double xn, double detect_dB)
+	{
+		double detectValue = parameters.useFastMath ? fastDB2Raw(detect_dB) : pow(10.0, detect_dB / 20.0);
 		double deltaValue = detectValue - threshValue;
 
 		ZVAFilterParameters filterParams = filter.getParameters();
@@ -5549,16 +7236,27 @@ public:
 		// --- update with new modulated frequency
 		filter.setParameters(filterParams);
 
-		// --- perform the filtering operation
 		return filter.processAudioSample(xn);
 	}
 
-protected:
-	EnvelopeFollowerParameters parameters; ///< object parameters
+	/** block loop shared by the float and double processAudioBlock( ) versions */
+	template <typename BlockType>
+	bool processBlock(const BlockType* inputBlock, BlockType* outputBlock, uint32_t numSamples)
+	{
+		double detect_dB[kEnvelopeBlockSize];
+		double* envelope = &detect_dB[0];
 
-	// --- 1 filter and 1 detector
-	ZVAFilter filter;		///< filter to modulate
-	AudioDetector detector; ///< detector to track input signal
+		for (uint32_t start = 0; start < numSamples; start += kEnvelopeBlockSize)
+		{
+			const uint32_t count = numSamples - start < kEnvelopeBlockSize ? numSamples - start : kEnvelopeBlockSize;
+			const BlockType* input = &inputBlock[start];
+			detector.processAudioBlock(&input, &envelope, count);
+
+			for (uint32_t i = 0; i < count; i++)
+				outputBlock[start + i] = (BlockType)modulateAndFilter(inputBlock[start + i], detect_dB[i]);
+		}
+		return true;
+	}
 };
 
 /**
@@ -5608,6 +7306,7 @@ struct TriodeClassAParameters
 		hpf_Fc = params.hpf_Fc;
 		lsf_Fshelf = params.lsf_Fshelf;
 		lsf_BoostCut_dB = params.lsf_BoostCut_dB;
+		useFastMath = params.useFastMath;
 
 		return *this;
 	}
@@ -5626,6 +7325,8 @@ struct TriodeClassAParameters
 	double hpf_Fc = 1.0;		///< fc of DC blocking cap
 	double lsf_Fshelf = 80.0;	///< shelf fc from self bias cap
 	double lsf_BoostCut_dB = 0.0;///< boost/cut due to cathode self biasing
+
+	bool useFastMath = true;	///< fastSoftClipWaveShaper( ) etc. (error < 1e-7); false for the <math.h> versions
 };
 
 /**
@@ -5646,7 +7347,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class TriodeClassA : public IAudioSignalProcessor
+class TriodeClassA : public BlockProcessorMixin<TriodeClassA>
 {
 public:
 	TriodeClassA() {
@@ -5710,7 +7411,16 @@ public:
 		// --- perform waveshaping
 		double output = 0.0;
 
-		if (parameters.waveshaper == distortionModel::kSoftClip)
+		if (parameters.useFastMath)
+		{
+			if (parameters.waveshaper == distortionModel::kSoftClip)
+				output = fastSoftClipWaveShaper(xn, parameters.saturation);
+			else if (parameters.waveshaper == distortionModel::kArcTan)
+				output = fastAtanWaveShaper(xn, parameters.saturation);
+			else if (parameters.waveshaper == distortionModel::kFuzzAsym)
+				output = fastFuzzExp1WaveShaper(xn, parameters.saturation, parameters.asymmetry);
+		}
+		else if (parameters.waveshaper == distortionModel::kSoftClip)
 			output = softClipWaveShaper(xn, parameters.saturation);
 		else if (parameters.waveshaper == distortionModel::kArcTan)
 			output = atanWaveShaper(xn, parameters.saturation);
@@ -5807,7 +7517,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class ClassATubePre : public IAudioSignalProcessor
+class ClassATubePre : public BlockProcessorMixin<ClassATubePre>
 {
 public:
 	ClassATubePre() {}		/* C-TOR */
@@ -5952,7 +7662,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class BitCrusher : public IAudioSignalProcessor
+class BitCrusher : public BlockProcessorMixin<BitCrusher>
 {
 public:
 	BitCrusher() {}		/* C-TOR */
@@ -6017,6 +7727,9 @@ Use this interface for objects in the WDF Ladder Filter library; see book for mo
 class IComponentAdaptor
 {
 public:
+	/** virtual destructor; WdfAdaptorBase destroys its component through this interface */
+	virtual ~IComponentAdaptor() {}
+
 	/** initialize with source resistor R1 */
 	virtual void initialize(double _R1) {}
 
@@ -7139,7 +8852,12 @@ class WdfAdaptorBase : public IComponentAdaptor
 {
 public:
 	WdfAdaptorBase() {}
-	virtual ~WdfAdaptorBase() {}
+	virtual ~WdfAdaptorBase() { destroyComponent(); }
+
+	// --- the component lives in componentStorage and the ports point at it and at other adaptors,
+	//     so adaptors (and the ladder filters built from them) can not be copied
+	WdfAdaptorBase(const WdfAdaptorBase&) = delete;
+	WdfAdaptorBase& operator=(const WdfAdaptorBase&) = delete;
 
 	/** set the termainal (load) resistance for terminating adaptors */
 	void setTerminalResistance(double _terminalResistance) { terminalResistance = _terminalResistance; }
@@ -7171,61 +8889,68 @@ public:
 			wdfComponent->reset(_sampleRate);
 	}
 
-	/** creates a new WDF component and connects it to Port 3 */
+	/** creates a new WDF component and connects it to Port 3; the component is constructed in the
+	    adaptor's own storage, replacing any previous one, so this never allocates */
 	void setComponent(wdfComponent componentType, double value1 = 0.0, double value2 = 0.0)
 	{
+		// --- keep a description for WdfSeriesParallelKernel::compile( )
+		componentInfo = WdfComponentInfo(componentType, value1, value2);
+
+		// --- release the old one
+		destroyComponent();
+
 		// --- decode and set
 		if (componentType == wdfComponent::R)
 		{
-			wdfComponent = new WdfResistor;
+			wdfComponent = new (&componentStorage) WdfResistor;
 			wdfComponent->setComponentValue(value1);
 			port3CompAdaptor = wdfComponent;
 		}
 		else if (componentType == wdfComponent::L)
 		{
-			wdfComponent = new WdfInductor;
+			wdfComponent = new (&componentStorage) WdfInductor;
 			wdfComponent->setComponentValue(value1);
 			port3CompAdaptor = wdfComponent;
 		}
 		else if (componentType == wdfComponent::C)
 		{
-			wdfComponent = new WdfCapacitor;
+			wdfComponent = new (&componentStorage) WdfCapacitor;
 			wdfComponent->setComponentValue(value1);
 			port3CompAdaptor = wdfComponent;
 		}
 		else if (componentType == wdfComponent::seriesLC)
 		{
-			wdfComponent = new WdfSeriesLC;
+			wdfComponent = new (&componentStorage) WdfSeriesLC;
 			wdfComponent->setComponentValue_LC(value1, value2);
 			port3CompAdaptor = wdfComponent;
 		}
 		else if (componentType == wdfComponent::parallelLC)
 		{
-			wdfComponent = new WdfParallelLC;
+			wdfComponent = new (&componentStorage) WdfParallelLC;
 			wdfComponent->setComponentValue_LC(value1, value2);
 			port3CompAdaptor = wdfComponent;
 		}
 		else if (componentType == wdfComponent::seriesRL)
 		{
-			wdfComponent = new WdfSeriesRL;
+			wdfComponent = new (&componentStorage) WdfSeriesRL;
 			wdfComponent->setComponentValue_RL(value1, value2);
 			port3CompAdaptor = wdfComponent;
 		}
 		else if (componentType == wdfComponent::parallelRL)
 		{
-			wdfComponent = new WdfParallelRL;
+			wdfComponent = new (&componentStorage) WdfParallelRL;
 			wdfComponent->setComponentValue_RL(value1, value2);
 			port3CompAdaptor = wdfComponent;
 		}
 		else if (componentType == wdfComponent::seriesRC)
 		{
-			wdfComponent = new WdfSeriesRC;
+			wdfComponent = new (&componentStorage) WdfSeriesRC;
 			wdfComponent->setComponentValue_RC(value1, value2);
 			port3CompAdaptor = wdfComponent;
 		}
 		else if (componentType == wdfComponent::parallelRC)
 		{
-			wdfComponent = new WdfParallelRC;
+			wdfComponent = new (&componentStorage) WdfParallelRC;
 			wdfComponent->setComponentValue_RC(value1, value2);
 			port3CompAdaptor = wdfComponent;
 		}
@@ -7248,30 +8973,45 @@ public:
 	virtual void setComponentValue(double _componentValue)
 	{
 		if (wdfComponent)
+		{
 			wdfComponent->setComponentValue(_componentValue);
+			componentInfo = WdfComponentInfo(componentInfo.componentType, _componentValue);
+		}
 	}
 
 	/** set LC value of mjulti-component adaptor */
 	virtual void setComponentValue_LC(double componentValue_L, double componentValue_C)
 	{
 		if (wdfComponent)
+		{
 			wdfComponent->setComponentValue_LC(componentValue_L, componentValue_C);
+			componentInfo = WdfComponentInfo(componentInfo.componentType, componentValue_L, componentValue_C);
+		}
 	}
 
 	/** set RL value of mjulti-component adaptor */
 	virtual void setComponentValue_RL(double componentValue_R, double componentValue_L)
 	{
 		if (wdfComponent)
+		{
 			wdfComponent->setComponentValue_RL(componentValue_R, componentValue_L);
+			componentInfo = WdfComponentInfo(componentInfo.componentType, componentValue_R, componentValue_L);
+		}
 	}
 
 	/** set RC value of mjulti-component adaptor */
 	virtual void setComponentValue_RC(double componentValue_R, double componentValue_C)
 	{
 		if (wdfComponent)
+		{
 			wdfComponent->setComponentValue_RC(componentValue_R, componentValue_C);
+			componentInfo = WdfComponentInfo(componentInfo.componentType, componentValue_R, componentValue_C);
+		}
 	}
 
+	/** get the type and value(s) of the component created with setComponent( ) */
+	const WdfComponentInfo& getComponentInfo() { return componentInfo; }
+
 	/** get adaptor connected at port 1: for extended functionality; not used in WDF ladder filter library */
 	IComponentAdaptor* getPort1_CompAdaptor() { return port1CompAdaptor; }
 
@@ -7282,12 +9022,30 @@ public:
 	IComponentAdaptor* getPort3_CompAdaptor() { return port3CompAdaptor; }
 
 protected:
+	/** destroy the component created with setComponent( ) and disconnect it from Port 3 */
+	void destroyComponent()
+	{
+		if (!wdfComponent)
+			return;
+
+		if (port3CompAdaptor == wdfComponent)
+			port3CompAdaptor = nullptr;
+
+		wdfComponent->~IComponentAdaptor();
+		wdfComponent = nullptr;
+	}
+
 	// --- can in theory connect any port to a component OR adaptor;
 	//     though this library is setup with a convention R3 = component
 	IComponentAdaptor* port1CompAdaptor = nullptr;	///< componant or adaptor connected to port 1
 	IComponentAdaptor* port2CompAdaptor = nullptr;	///< componant or adaptor connected to port 2
 	IComponentAdaptor* port3CompAdaptor = nullptr;	///< componant or adaptor connected to port 3
 	IComponentAdaptor* wdfComponent = nullptr;		///< WDF componant connected to port 3 (default operation)
+	WdfComponentInfo componentInfo;					///< type and value(s) of wdfComponent
+
+	// --- in-place storage for wdfComponent, large enough for any of the component types
+	std::aligned_union<0, WdfResistor, WdfCapacitor, WdfInductor, WdfSeriesLC, WdfParallelLC,
+		WdfSeriesRL, WdfParallelRL, WdfSeriesRC, WdfParallelRC>::type componentStorage; ///< storage for wdfComponent
 
 	// --- These hold the input (R1), component (R3) and output (R2) resistances
 	double R1 = 0.0; ///< input port resistance
@@ -7416,6 +9174,9 @@ public:
 	/** get OUT3 always connects to component */
 	virtual double getOutput3() { return out3; }
 
+	/** get the B coefficient; valid after initialize( ) */
+	double getB() { return B; }
+
 private:
 	double N1 = 0.0;	///< node 1 value, internal use only
 	double N2 = 0.0;	///< node 2 value, internal use only
@@ -7733,6 +9494,12 @@ public:
 	/** get OUT3 always connects to component */
 	virtual double getOutput3() { return out3; }
 
+	/** get the A1 coefficient; valid after initialize( ) */
+	double getA1() { return A1; }
+
+	/** get the A3 coefficient; valid after initialize( ) */
+	double getA3() { return A3; }
+
 private:
 	double N1 = 0.0;	///< node 1 value, internal use only
 	double N2 = 0.0;	///< node 2 value, internal use only
@@ -7740,6 +9507,212 @@ private:
 	double A3 = 0.0;	///< A3 coefficient value
 };
 
+/**
+\class WdfFlatComponent
+\ingroup WDF-Objects
+\brief
+The WdfFlatComponent object is the non-virtual counterpart of the WDF component objects above, with the
+component type fixed at compile time. It holds only the reflection coefficient and the two storage
+registers; the port resistance lives in the adaptor coefficients. getOutput( ) and setInput( ) repeat
+the arithmetic of the matching WdfResistor, WdfInductor ... WdfParallelRC object operation for operation.
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+template <wdfComponent componentType>
+struct WdfFlatComponent
+{
+	/** recalculate the coefficient for the component values and sample rate */
+	void update(const WdfComponentInfo& info, double sampleRate)
+	{
+		double RR = info.R;
+		double RL = 2.0*info.L*sampleRate;
+		double RC = componentType == wdfComponent::seriesLC || componentType == wdfComponent::parallelLC ||
+			componentType == wdfComponent::seriesRC || componentType == wdfComponent::parallelRC ? 1.0 / (2.0*info.C*sampleRate) : 0.0;
+
+		switch (componentType)
+		{
+		case wdfComponent::seriesLC:
+		{
+			double YC = 1.0 / RC;
+			K = (1.0 - RL*YC) / (1.0 + RL*YC);
+			break;
+		}
+		case wdfComponent::parallelLC:
+		{
+			double YL = 1.0 / RL;
+			K = (YL*RC - 1.0) / (YL*RC + 1.0);
+			break;
+		}
+		case wdfComponent::seriesRL:
+			K = RR / (RR + RL);
+			break;
+		case wdfComponent::parallelRL:
+			K = (1.0 / ((1.0 / RR) + (1.0 / RL))) / RR;
+			break;
+		case wdfComponent::seriesRC:
+			K = RR / (RR + RC);
+			break;
+		case wdfComponent::parallelRC:
+			K = (1.0 / ((1.0 / RR) + (1.0 / RC))) / RR;
+			break;
+		default:
+			K = 0.0;
+			break;
+		}
+	}
+
+	/** flush the storage registers */
+	void reset() { zRegister_L = 0.0; zRegister_C = 0.0; }
+
+	/** get the reflected output; NOTE: updates the state of the RL and RC components like their getOutput( ) */
+	inline double getOutput()
+	{
+		switch (componentType)
+		{
+		case wdfComponent::R:
+			return 0.0;
+		case wdfComponent::L:
+			return -zRegister_L;
+		case wdfComponent::C:
+			return zRegister_C;
+		case wdfComponent::seriesLC:
+			return zRegister_L;
+		case wdfComponent::parallelLC:
+			return -zRegister_L;
+		case wdfComponent::seriesRL:
+		{
+			double out = -zRegister_L*(1.0 - K) - K*zRegister_C;
+			zRegister_C = out;
+			return out;
+		}
+		case wdfComponent::parallelRL:
+		{
+			double out = -zRegister_L*(1.0 - K) + K*zRegister_C;
+			zRegister_C = out;
+			return out;
+		}
+		case wdfComponent::seriesRC:
+		{
+			double out = zRegister_L*(1.0 - K) + K*zRegister_C;
+			zRegister_C = out;
+			return out;
+		}
+		case wdfComponent::parallelRC:
+		{
+			double out = zRegister_L*(1.0 - K) - K*zRegister_C;
+			zRegister_C = out;
+			return out;
+		}
+		}
+		return 0.0;
+	}
+
+	/** set the incident input */
+	inline void setInput(double in)
+	{
+		switch (componentType)
+		{
+		case wdfComponent::R:
+			break;
+		case wdfComponent::C:
+			zRegister_C = in;
+			break;
+		case wdfComponent::seriesLC:
+		case wdfComponent::parallelLC:
+		{
+			double N1 = K*(in - zRegister_L);
+			zRegister_L = N1 + zRegister_C;
+			zRegister_C = in;
+			break;
+		}
+		default:
+			zRegister_L = in;
+			break;
+		}
+	}
+
+	double K = 0.0;				///< reflection coefficient (two-element components)
+	double zRegister_L = 0.0;	///< storage register for L
+	double zRegister_C = 0.0;	///< storage register for C
+};
+
+/**
+\class WdfSeriesParallelKernel
+\ingroup WDF-Objects
+\brief
+The WdfSeriesParallelKernel object flattens a WdfSeriesAdaptor --> WdfParallelTerminatedAdaptor chain,
+the topology of the WDFIdealRLC filters, into one non-virtual scattering function. The adaptor chain
+is still used to design the filter: after initializeAdaptorChain( ), compile( ) copies its coefficients
+and component descriptions into contiguous members. processSample( ) then does the same arithmetic, in
+the same order, as seriesAdaptor.setInput1( ) followed by parallelAdaptor.getOutput2( ), without the ten
+virtual calls and pointer chasing per sample, so the results are bit-exact with the adaptor chain.
+
+The component types are template arguments and must match the components given to setComponent( ).
+
+Audio I/O:
+- Processes mono input to mono output.
+
+Control I/F:
+- compile( ) after any change to the adaptor chain; the storage registers are kept.
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+template <wdfComponent seriesComponentType, wdfComponent parallelComponentType>
+class WdfSeriesParallelKernel
+{
+public:
+	WdfSeriesParallelKernel() {}	/* C-TOR */
+	~WdfSeriesParallelKernel() {}	/* D-TOR */
+
+	/** copy the coefficients of an initialized chain; call after initializeAdaptorChain( ) */
+	void compile(WdfSeriesAdaptor& seriesAdaptor, WdfParallelTerminatedAdaptor& parallelTerminatedAdaptor, double sampleRate)
+	{
+		B = seriesAdaptor.getB();
+		A1 = parallelTerminatedAdaptor.getA1();
+		A3 = parallelTerminatedAdaptor.getA3();
+		seriesComponent.update(seriesAdaptor.getComponentInfo(), sampleRate);
+		parallelComponent.update(parallelTerminatedAdaptor.getComponentInfo(), sampleRate);
+	}
+
+	/** flush the storage registers */
+	void reset()
+	{
+		seriesComponent.reset();
+		parallelComponent.reset();
+	}
+
+	/** process x(n) through the chain; returns the output of the terminated adaptor (out2) */
+	inline double processSample(double xn)
+	{
+		// --- series adaptor, forward: the incident wave into the parallel adaptor
+		double N2s = seriesComponent.getOutput();
+		double in1p = -(xn + N2s);
+
+		// --- parallel terminated adaptor: scatter
+		double N2p = parallelComponent.getOutput();
+		double N1p = -A1*(-in1p + N2p) + N2p - A3*N2p;
+		double in2s = -in1p + N2p + N1p;
+
+		// --- series adaptor, reflected wave back into its component
+		seriesComponent.setInput(-(xn - B*(xn + N2s + in2s) + in2s));
+
+		// --- parallel component state and y(n)
+		parallelComponent.setInput(N1p);
+		return N2p + N1p;
+	}
+
+protected:
+	double B = 0.0;		///< series adaptor B coefficient
+	double A1 = 0.0;	///< parallel adaptor A1 coefficient
+	double A3 = 0.0;	///< parallel adaptor A3 coefficient
+	WdfFlatComponent<seriesComponentType> seriesComponent;		///< component at port 3 of the series adaptor
+	WdfFlatComponent<parallelComponentType> parallelComponent;	///< component at port 3 of the parallel adaptor
+};
+
 // ------------------------------------------------------------------------------ //
 // --- WDF Ladder Filter Design  Examples --------------------------------------- //
 // ------------------------------------------------------------------------------ //
@@ -7786,7 +9759,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class WDFButterLPF3 : public IAudioSignalProcessor
+class WDFButterLPF3 : public BlockProcessorMixin<WDFButterLPF3>
 {
 public:
 	WDFButterLPF3(void) { createWDF(); }	/* C-TOR */
@@ -7872,7 +9845,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class WDFTunableButterLPF3 : public IAudioSignalProcessor
+class WDFTunableButterLPF3 : public BlockProcessorMixin<WDFTunableButterLPF3>
 {
 public:
 	WDFTunableButterLPF3(void) { createWDF(); }	/* C-TOR */
@@ -7977,7 +9950,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class WDFBesselBSF3 : public IAudioSignalProcessor
+class WDFBesselBSF3 : public BlockProcessorMixin<WDFBesselBSF3>
 {
 public:
 	WDFBesselBSF3(void) { createWDF(); }	/* C-TOR */
@@ -8061,7 +10034,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class WDFConstKBPF6 : public IAudioSignalProcessor
+class WDFConstKBPF6 : public BlockProcessorMixin<WDFConstKBPF6>
 {
 public:
 	WDFConstKBPF6(void) { createWDF(); }	/* C-TOR */
@@ -8196,7 +10169,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class WDFIdealRLCLPF : public IAudioSignalProcessor
+class WDFIdealRLCLPF : public BlockProcessorMixin<WDFIdealRLCLPF>
 {
 public:
 	WDFIdealRLCLPF(void) { createWDF(); }	/* C-TOR */
@@ -8213,6 +10186,10 @@ public:
 
 		// --- intialize the chain of adapters
 		seriesAdaptor_RL.initializeAdaptorChain();
+
+		// --- flatten it
+		wdfKernel.compile(seriesAdaptor_RL, parallelTerminatedAdaptor_C, sampleRate);
+		wdfKernel.reset();
 		return true;
 	}
 
@@ -8226,13 +10203,10 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
-		// --- push audio sample into series L1
-		seriesAdaptor_RL.setInput1(xn);
-
-		// --- output is at terminated L2's output2
+		// --- run the flattened series --> parallel terminated chain
 		//     note compensation scaling by -6dB = 0.5
 		//     because of WDF assumption about Rs and Rload
-		return 0.5*parallelTerminatedAdaptor_C.getOutput2();
+		return 0.5*wdfKernel.processSample(xn);
 	}
 
 	/** create the WDF structure; may be called more than once */
@@ -8287,6 +10261,7 @@ public:
 
 			seriesAdaptor_RL.setComponentValue_RL(resistorValue, inductorValue);
 			seriesAdaptor_RL.initializeAdaptorChain();
+			wdfKernel.compile(seriesAdaptor_RL, parallelTerminatedAdaptor_C, sampleRate);
 		}
 	}
 
@@ -8296,6 +10271,7 @@ protected:
 	// --- adapters
 	WdfSeriesAdaptor				seriesAdaptor_RL;				///< adaptor for series RL
 	WdfParallelTerminatedAdaptor	parallelTerminatedAdaptor_C;	///< adaptopr for parallel C
+	WdfSeriesParallelKernel<wdfComponent::seriesRL, wdfComponent::C> wdfKernel; ///< flattened copy of the adaptor chain, used for processing
 
 	double sampleRate = 1.0;
 
@@ -8318,7 +10294,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class WDFIdealRLCHPF : public IAudioSignalProcessor
+class WDFIdealRLCHPF : public BlockProcessorMixin<WDFIdealRLCHPF>
 {
 public:
 	WDFIdealRLCHPF(void) { createWDF(); }	/* C-TOR */
@@ -8334,6 +10310,10 @@ public:
 
 		// --- intialize the chain of adapters
 		seriesAdaptor_RC.initializeAdaptorChain();
+
+		// --- flatten it
+		wdfKernel.compile(seriesAdaptor_RC, parallelTerminatedAdaptor_L, sampleRate);
+		wdfKernel.reset();
 		return true;
 	}
 
@@ -8347,13 +10327,10 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
-		// --- push audio sample into series L1
-		seriesAdaptor_RC.setInput1(xn);
-
-		// --- output is at terminated L2's output2
+		// --- run the flattened series --> parallel terminated chain
 		//     note compensation scaling by -6dB = 0.5
 		//     because of WDF assumption about Rs and Rload
-		return 0.5*parallelTerminatedAdaptor_L.getOutput2();
+		return 0.5*wdfKernel.processSample(xn);
 	}
 
 	/** create WDF structure; may be called more than once */
@@ -8409,6 +10386,7 @@ public:
 			seriesAdaptor_RC.setComponentValue_RC(resistorValue, 1.0e-6);
 			parallelTerminatedAdaptor_L.setComponentValue(inductorValue);
 			seriesAdaptor_RC.initializeAdaptorChain();
+			wdfKernel.compile(seriesAdaptor_RC, parallelTerminatedAdaptor_L, sampleRate);
 		}
 	}
 
@@ -8419,6 +10397,7 @@ protected:
 	// --- three
 	WdfSeriesAdaptor				seriesAdaptor_RC;				///< adaptor for RC
 	WdfParallelTerminatedAdaptor	parallelTerminatedAdaptor_L;	///< adaptor for L
+	WdfSeriesParallelKernel<wdfComponent::seriesRC, wdfComponent::L> wdfKernel; ///< flattened copy of the adaptor chain, used for processing
 
 	double sampleRate = 1.0;	///< sample rate storage
 };
@@ -8440,7 +10419,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class WDFIdealRLCBPF : public IAudioSignalProcessor
+class WDFIdealRLCBPF : public BlockProcessorMixin<WDFIdealRLCBPF>
 {
 public:
 	WDFIdealRLCBPF(void) { createWDF(); }	/* C-TOR */
@@ -8456,6 +10435,10 @@ public:
 
 		// --- intialize the chain of adapters
 		seriesAdaptor_LC.initializeAdaptorChain();
+
+		// --- flatten it
+		wdfKernel.compile(seriesAdaptor_LC, parallelTerminatedAdaptor_R, sampleRate);
+		wdfKernel.reset();
 		return true;
 	}
 
@@ -8469,13 +10452,10 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
-		// --- push audio sample into series L1
-		seriesAdaptor_LC.setInput1(xn);
-
-		// --- output is at terminated L2's output2
+		// --- run the flattened series --> parallel terminated chain
 		//     note compensation scaling by -6dB = 0.5
 		//     because of WDF assumption about Rs and Rload
-		return 0.5*parallelTerminatedAdaptor_R.getOutput2();
+		return 0.5*wdfKernel.processSample(xn);
 	}
 
 	/** create the WDF structure*/
@@ -8531,6 +10511,7 @@ public:
 			seriesAdaptor_LC.setComponentValue_LC(inductorValue, 1.0e-6);
 			parallelTerminatedAdaptor_R.setComponentValue(resistorValue);
 			seriesAdaptor_LC.initializeAdaptorChain();
+			wdfKernel.compile(seriesAdaptor_LC, parallelTerminatedAdaptor_R, sampleRate);
 		}
 	}
 
@@ -8540,6 +10521,7 @@ protected:
 	// --- adapters
 	WdfSeriesAdaptor				seriesAdaptor_LC; ///< adaptor for LC
 	WdfParallelTerminatedAdaptor	parallelTerminatedAdaptor_R; ///< adaptor for R
+	WdfSeriesParallelKernel<wdfComponent::seriesLC, wdfComponent::R> wdfKernel; ///< flattened copy of the adaptor chain, used for processing
 
 	double sampleRate = 1.0;
 };
@@ -8562,7 +10544,7 @@ Control I/F:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class WDFIdealRLCBSF : public IAudioSignalProcessor
+class WDFIdealRLCBSF : public BlockProcessorMixin<WDFIdealRLCBSF>
 {
 public:
 	WDFIdealRLCBSF(void) { createWDF(); }	/* C-TOR */
@@ -8578,6 +10560,10 @@ public:
 
 		// --- intialize the chain of adapters
 		seriesAdaptor_R.initializeAdaptorChain();
+
+		// --- flatten it
+		wdfKernel.compile(seriesAdaptor_R, parallelTerminatedAdaptor_LC, sampleRate);
+		wdfKernel.reset();
 		return true;
 	}
 
@@ -8591,13 +10577,10 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
-		// --- push audio sample into series L1
-		seriesAdaptor_R.setInput1(xn);
-
-		// --- output is at terminated L2's output2
+		// --- run the flattened series --> parallel terminated chain
 		//     note compensation scaling by -6dB = 0.5
 		//     because of WDF assumption about Rs and Rload
-		return 0.5*parallelTerminatedAdaptor_LC.getOutput2();
+		return 0.5*wdfKernel.processSample(xn);
 	}
 
 	/** create WDF structure */
@@ -8653,6 +10636,7 @@ public:
 			seriesAdaptor_R.setComponentValue(resistorValue);
 			parallelTerminatedAdaptor_LC.setComponentValue_LC(inductorValue, 1.0e-6);
 			seriesAdaptor_R.initializeAdaptorChain();
+			wdfKernel.compile(seriesAdaptor_R, parallelTerminatedAdaptor_LC, sampleRate);
 		}
 	}
 
@@ -8662,6 +10646,7 @@ protected:
 	// --- adapters
 	WdfSeriesAdaptor				seriesAdaptor_R; ///< adaptor for series R
 	WdfParallelTerminatedAdaptor	parallelTerminatedAdaptor_LC; ///< adaptor for parallel LC
+	WdfSeriesParallelKernel<wdfComponent::R, wdfComponent::seriesLC> wdfKernel; ///< flattened copy of the adaptor chain, used for processing
 
 	double sampleRate = 1.0; ///< sample rate storage
 };
@@ -9078,8 +11063,256 @@ protected:
 	unsigned int filterImpulseLength = 0;///< IR length
 };
 
+/**
+\class PartitionedConvolver
+\ingroup FFTW-Objects
+\brief
+The PartitionedConvolver object implements zero-latency convolution for long impulse responses.
+The first partition of the IR (the head) is convolved directly in the time domain; the rest of
+the IR is split into uniform partitions that are convolved with the FastFFT using overlap-save
+and a frequency domain delay line, so the per-sample cost grows with the IR length / partition
+length rather than with the IR length.
+
+Audio I/O:
+- Processes mono input to mono output.
+
+Control I/F:
+- call initialize( ) with the partition length (power of 2); this is also the direct-form head length
+- call setImpulseResponse( ) to load the IR; the IR may be any length
+
+\author Steve Dwyer
+\remark The FFT work for the tail partitions is done once every partition length samples
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+class PartitionedConvolver : public BlockProcessorMixin<PartitionedConvolver>
+{
+public:
+	PartitionedConvolver() {
+		initialize(64);
+	}		/* C-TOR */
+	~PartitionedConvolver() {}		/* D-TOR */
+
+	/** reset members to initialized state */
+	virtual bool reset(double _sampleRate)
+	{
+		// --- flush signal history and FDL; IR is static
+		memset(&history[0], 0, sizeof(double) * partitionLength * 2);
+		memset(&tailOutput[0], 0, sizeof(double) * partitionLength);
+		if (numPartitions > 0)
+		{
+			memset(&fdlReal[0], 0, sizeof(double) * numPartitions * numBins);
+			memset(&fdlImag[0], 0, sizeof(double) * numPartitions * numBins);
+		}
+		inputCount = 0;
+		fdlIndex = 0;
+		return true;
+	}
+
+	/** process one input through the head and tail partitions */
+	/**
+	\param xn input
+	\return the processed sample
+	*/
+	virtual double processAudioSample(double xn)
+	{
+		// --- history = [previous block | current block]
+		history[partitionLength + inputCount] = xn;
+
+		// --- direct-form head: y(n) = h(0)x(n) + h(1)x(n-1) + ...
+		const double* x = &history[partitionLength + inputCount];
+		double yn = 0.0;
+		for (unsigned int i = 0; i < headLength; i++)
+			yn += headIR[i] * x[-(int)i];
+
+		// --- add the tail partitions, calculated at the end of the last block
+		yn += tailOutput[inputCount];
+
+		if (++inputCount == partitionLength)
+		{
+			processTailPartitions();
+			inputCount = 0;
+		}
+
+		return yn;
+	}
+
+	/** return false: this object only processes samples */
+	virtual bool canProcessAudioFrame() { return false; }
+
+	/** setup the partition length; clears the IR */
+	/**
+	\param _partitionLength the partition and head length, MUST be a power of 2; the FFT length is twice this
+	*/
+	void initialize(unsigned int _partitionLength)
+	{
+		partitionLength = _partitionLength;
+		numBins = partitionLength + 1;
+		fastFFT.initialize(partitionLength * 2, windowType::kNoWindow);
+
+		history.reset(new double[partitionLength * 2]);
+		tailOutput.reset(new double[partitionLength]);
+		headIR.reset(new double[partitionLength]);
+		accumReal.reset(new double[partitionLength * 2]);
+		accumImag.reset(new double[partitionLength * 2]);
+		memset(&headIR[0], 0, sizeof(double) * partitionLength);
+
+		headLength = 0;
+		numPartitions = 0;
+		reset(0.0);
+	}
+
+	/** set the impulse response; the IR is copied so the caller may discard irArray */
+	/**
+	\param irArray the impulse response
+	\param irLength the length of the impulse response, any length
+	*/
+	void setImpulseResponse(double* irArray, unsigned int irLength)
+	{
+		// --- head
+		headLength = std::min(irLength, partitionLength);
+		memset(&headIR[0], 0, sizeof(double) * partitionLength);
+		memcpy(&headIR[0], &irArray[0], sizeof(double) * headLength);
+
+		// --- tail partitions; the FDL only needs to be re-created if the number of partitions changes
+		unsigned int tailLength = irLength - headLength;
+		unsigned int _numPartitions = (tailLength + partitionLength - 1) / partitionLength;
+		if (_numPartitions != numPartitions)
+		{
+			numPartitions = _numPartitions;
+			irReal.reset(numPartitions > 0 ? new double[numPartitions * numBins] : nullptr);
+			irImag.reset(numPartitions > 0 ? new double[numPartitions * numBins] : nullptr);
+			fdlReal.reset(numPartitions > 0 ? new double[numPartitions * numBins] : nullptr);
+			fdlImag.reset(numPartitions > 0 ? new double[numPartitions * numBins] : nullptr);
+			reset(0.0);
+		}
+
+		// --- FFT of each zero-padded partition; accumReal is used as scratch
+		for (unsigned int j = 0; j < numPartitions; j++)
+		{
+			unsigned int offset = headLength + j * partitionLength;
+			unsigned int count = std::min(partitionLength, irLength - offset);
+
+			memset(&accumReal[0], 0, sizeof(double) * partitionLength * 2);
+			memcpy(&accumReal[0], &irArray[offset], sizeof(double) * count);
+
+			fftw_complex* irFFT = fastFFT.doFFT(&accumReal[0]);
+			for (unsigned int k = 0; k < numBins; k++)
+			{
+				irReal[j * numBins + k] = irFFT[k][0];
+				irImag[j * numBins + k] = irFFT[k][1];
+			}
+		}
+	}
+
+	/** get current partition length, which is also the head length */
+	unsigned int getPartitionLength() { return partitionLength; }
+
+	/** get current number of FFT partitions, not including the head */
+	unsigned int getNumPartitions() { return numPartitions; }
+
+protected:
+	/** FFT the last two input blocks into the FDL, multiply-accumulate with the IR partitions and IFFT into tailOutput */
+	void processTailPartitions()
+	{
+		if (numPartitions == 0)
+		{
+			// --- head only; just slide the history
+			memcpy(&history[0], &history[partitionLength], sizeof(double) * partitionLength);
+			return;
+		}
+
+		// --- newest spectrum goes into the FDL, overwriting the oldest
+		fdlIndex = fdlIndex == 0 ? numPartitions - 1 : fdlIndex - 1;
+		fftw_complex* signalFFT = fastFFT.doFFT(&history[0]);
+		double* xReal = &fdlReal[fdlIndex * numBins];
+		double* xImag = &fdlImag[fdlIndex * numBins];
+		for (unsigned int k = 0; k < numBins; k++)
+		{
+			xReal[k] = signalFFT[k][0];
+			xImag[k] = signalFFT[k][1];
+		}
+
+		// --- slide the history: current block becomes the previous block
+		memcpy(&history[0], &history[partitionLength], sizeof(double) * partitionLength);
+
+		// --- Y = sum of X(b - j)H(j + 1); partition j + 1 is delayed by j blocks in the FDL
+		memset(&accumReal[0], 0, sizeof(double) * numBins);
+		memset(&accumImag[0], 0, sizeof(double) * numBins);
+		unsigned int slot = fdlIndex;
+		for (unsigned int j = 0; j < numPartitions; j++)
+		{
+			const double* hReal = &irReal[j * numBins];
+			const double* hImag = &irImag[j * numBins];
+			xReal = &fdlReal[slot * numBins];
+			xImag = &fdlImag[slot * numBins];
+
+			for (unsigned int k = 0; k < numBins; k++)
+			{
+				accumReal[k] += xReal[k] * hReal[k] - xImag[k] * hImag[k];
+				accumImag[k] += xReal[k] * hImag[k] + xImag[k] * hReal[k];
+			}
+
+			if (++slot == numPartitions)
+				slot = 0;
+		}
+
+		// --- real signal: upper half of the spectrum is the complex conjugate of the lower half
+		unsigned int fftLength = partitionLength * 2;
+		for (unsigned int k = 1; k < partitionLength; k++)
+		{
+			accumReal[fftLength - k] = accumReal[k];
+			accumImag[fftLength - k] = -accumImag[k];
+		}
+
+		// --- overlap-save: the last half of the IFFT is the valid output; FFTW does not normalize
+		fftw_complex* ifft = fastFFT.doInverseFFT(&accumReal[0], &accumImag[0]);
+		double scalar = 1.0 / fftLength;
+		for (unsigned int i = 0; i < partitionLength; i++)
+			tailOutput[i] = ifft[partitionLength + i][0] * scalar;
+	}
+
+	FastFFT fastFFT;							///< FFT object for both directions
+	unsigned int partitionLength = 0;			///< partition length = head length = 1/2 FFT length
+	unsigned int numBins = 0;					///< non-redundant bins of the real FFT
+	unsigned int headLength = 0;				///< number of taps in the direct-form head
+	unsigned int numPartitions = 0;				///< number of FFT partitions after the head
+	unsigned int inputCount = 0;				///< input sample counter within the block
+	unsigned int fdlIndex = 0;					///< FDL slot holding the newest spectrum
+
+	std::unique_ptr<double[]> history;			///< last two input blocks
+	std::unique_ptr<double[]> tailOutput;		///< tail partition output for the current block
+	std::unique_ptr<double[]> headIR;			///< direct-form head of the IR
+	std::unique_ptr<double[]> irReal;			///< IR partition spectra, real parts
+	std::unique_ptr<double[]> irImag;			///< IR partition spectra, imaginary parts
+	std::unique_ptr<double[]> fdlReal;			///< frequency domain delay line, real parts
+	std::unique_ptr<double[]> fdlImag;			///< frequency domain delay line, imaginary parts
+	std::unique_ptr<double[]> accumReal;		///< spectrum accumulator, real parts
+	std::unique_ptr<double[]> accumImag;		///< spectrum accumulator, imaginary parts
+};
+
 // --- PSM Vocoder
 const unsigned int PSM_FFT_LEN = 4096;
+const unsigned int PSM_NUM_BINS = PSM_FFT_LEN / 2 + 1;	///< unique bins of the real FFT
+const unsigned int PSM_HOP_SIZE = PSM_FFT_LEN / 4;		///< 75% overlap
+const unsigned int PSM_INPUT_LEN = PSM_FFT_LEN * 2;		///< input timeline; holds the frame while the next hop comes in
+const unsigned int PSM_HALF_LEN = PSM_FFT_LEN / 2;		///< the real FFT runs as a complex FFT of N/2 points (even samples real, odd samples imaginary)
+const unsigned int PSM_FFT_SPLIT = 8;					///< the N/2 point FFT is split into this many sub-FFTs (decimation in time), one per step
+const unsigned int PSM_SUB_FFT_LEN = PSM_HALF_LEN / PSM_FFT_SPLIT;	///< length of each sub-FFT
+const unsigned int PSM_OUTPUT_LEN = PSM_FFT_LEN * 8;		///< output timeline; holds the added hop and the longest (pitched down) overlap-add
+const unsigned int PSM_BINS_PER_STEP = 64;				///< work per sample when the hop is spread: bins, FFT points or output samples per step
+
+// --- steps per hop when the work is spread: each FFT is a pack, PSM_FFT_SPLIT sub-FFTs and a combine over N/2 points,
+//     the forward FFT adds the real unpacking over the bins, and there are five stages over the bins; the rest of
+//     the hop is left for the resampling
+const unsigned int PSM_STEPS_PER_BIN_STAGE = (PSM_NUM_BINS + PSM_BINS_PER_STEP - 1) / PSM_BINS_PER_STEP;
+const unsigned int PSM_FIXED_HOP_STEPS = 4 * (PSM_HALF_LEN / PSM_BINS_PER_STEP) + 2 * PSM_FFT_SPLIT + 6 * PSM_STEPS_PER_BIN_STAGE;
+
+/// longest resampled frame: it must fit in the output timeline with the added hop (about -35.5 semitones), and
+/// its steps must fit in the hop with the others, so that each hop is finished before the next one starts
+const unsigned int PSM_MAX_RESAMPLE_LEN = (PSM_HOP_SIZE - PSM_FIXED_HOP_STEPS) * PSM_BINS_PER_STEP < PSM_OUTPUT_LEN - PSM_HOP_SIZE ?
+										  (PSM_HOP_SIZE - PSM_FIXED_HOP_STEPS) * PSM_BINS_PER_STEP : PSM_OUTPUT_LEN - PSM_HOP_SIZE;
+static_assert(PSM_FIXED_HOP_STEPS + (PSM_MAX_RESAMPLE_LEN + PSM_BINS_PER_STEP - 1) / PSM_BINS_PER_STEP <= PSM_HOP_SIZE, "PSMVocoder: the steps for one hop must fit in the hop");
 
 /**
 \struct BinData
@@ -9160,6 +11393,7 @@ struct PSMVocoderParameters
 		pitchShiftSemitones = params.pitchShiftSemitones;
 		enablePeakPhaseLocking = params.enablePeakPhaseLocking;
 		enablePeakTracking = params.enablePeakTracking;
+		amortizeHopProcessing = params.amortizeHopProcessing;
 
 		return *this;
 	}
@@ -9168,6 +11402,7 @@ struct PSMVocoderParameters
 	double pitchShiftSemitones = 0.0;	///< pitch shift in half-steps
 	bool enablePeakPhaseLocking = false;///< flag to enable phase lock
 	bool enablePeakTracking = false;	///< flag to enable peak tracking
+	bool amortizeHopProcessing = true;	///< spread the work for each hop over the hop, for one hop of added latency
 };
 
 /**
@@ -9177,6 +11412,22 @@ struct PSMVocoderParameters
 The PSMVocoder object implements a phase vocoder pitch shifter. Phase locking and peak tracking
 are optional.
 
+The FFT is real-valued, so only the N/2 + 1 unique bins are analyzed and resynthesized. The work for each
+hop (FFT, bin analysis, peak picking, phase propagation, IFFT, resampling and overlap-add) is split into
+steps of PSM_BINS_PER_STEP bins or samples and one step runs per input sample, so the cost is spread evenly
+over the next hop instead of landing on a single sample. This adds one hop (N/4) of latency; set
+amortizeHopProcessing = false in the parameters to do all of the work when the frame is ready, with no
+added latency.
+
+The real FFT and IFFT are done as a complex FFT of N/2 points, and that is split into PSM_FFT_SPLIT sub-FFTs
+(decimation in time) with the packing, the twiddle combine and the real unpacking spread over the bins, so
+no single step runs a whole FFT. The pitch shift is limited to PSM_MAX_RESAMPLE_LEN (about -35.5 semitones),
+where all of the steps still fit in one hop.
+
+The frames are captured N/4 samples apart at every pitch shift, so the phase increments are measured over
+N/4 and then scaled by the stretch ratio. Measuring them over N/4 / alpha, as the original did, leaves steady
+tones off pitch on downward and non-octave shifts, most of all with peak phase locking.
+
 Audio I/O:
 - Processes mono input to mono output.
 
@@ -9185,30 +11436,68 @@ Control I/F:
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\version Revision : 1.1 real FFT, per-hop work spread across the hop (Steve Dwyer)
+\date Date : 2026 / 10 / 17
 */
-class PSMVocoder : public IAudioSignalProcessor
+class PSMVocoder : public BlockProcessorMixin<PSMVocoder>
 {
 public:
 	PSMVocoder() {
-		vocoder.initialize(PSM_FFT_LEN, PSM_FFT_LEN/4, windowType::kHannWindow);  // 75% overlap
+		// --- real FFT: N samples <-> N/2 + 1 bins, through PSM_FFT_SPLIT sub-FFTs of the N/2 point complex FFT
+		ifftOutput = (double*)fftw_malloc(sizeof(double) * PSM_FFT_LEN);
+		fftData = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * PSM_NUM_BINS);
+		halfData = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * PSM_HALF_LEN);
+		subInput = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * PSM_HALF_LEN);
+		subOutput = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * PSM_HALF_LEN);
+		for (uint32_t r = 0; r < PSM_FFT_SPLIT; r++)
+		{
+			plan_forward[r] = fftw_plan_dft_1d(PSM_SUB_FFT_LEN, &subInput[r * PSM_SUB_FFT_LEN], &subOutput[r * PSM_SUB_FFT_LEN], FFTW_FORWARD, FFTW_ESTIMATE);
+			plan_backward[r] = fftw_plan_dft_1d(PSM_SUB_FFT_LEN, &subInput[r * PSM_SUB_FFT_LEN], &subOutput[r * PSM_SUB_FFT_LEN], FFTW_BACKWARD, FFTW_ESTIMATE);
+		}
+
+		// --- twiddles: e^(-j2pi k/(N/2)) for the sub-FFT combine, e^(-j2pi k/N) for the real (un)packing
+		for (uint32_t k = 0; k < PSM_HALF_LEN; k++)
+		{
+			halfTwiddleReal[k] = cos(kTwoPi*k / PSM_HALF_LEN);
+			halfTwiddleImag[k] = -sin(kTwoPi*k / PSM_HALF_LEN);
+		}
+		for (uint32_t k = 0; k < PSM_NUM_BINS; k++)
+		{
+			realTwiddleReal[k] = cos(kTwoPi*k / PSM_FFT_LEN);
+			realTwiddleImag[k] = -sin(kTwoPi*k / PSM_FFT_LEN);
+		}
+
+		// --- analysis window (periodic Hann) and its gain correction, see PhaseVocoder::initialize( )
+		double windowSum = 0.0;
+		for (unsigned int n = 0; n < PSM_FFT_LEN; n++)
+		{
+			analysisWindow[n] = 0.5 * (1.0 - cos((n*2.0*kPi) / PSM_FFT_LEN));
+			windowSum += analysisWindow[n];
+		}
+		windowHopCorrection = ((double)PSM_HOP_SIZE / (double)PSM_FFT_LEN) / windowSum;
+
+		reset(0.0);
 	}		/* C-TOR */
 	~PSMVocoder() {
-		if (windowBuff) delete[] windowBuff;
-		if (outputBuff) delete[] outputBuff;
-
+		for (uint32_t r = 0; r < PSM_FFT_SPLIT; r++)
+		{
+			if (plan_forward[r]) fftw_destroy_plan(plan_forward[r]);
+			if (plan_backward[r]) fftw_destroy_plan(plan_backward[r]);
+		}
+		if (ifftOutput) fftw_free(ifftOutput);
+		if (fftData) fftw_free(fftData);
+		if (halfData) fftw_free(halfData);
+		if (subInput) fftw_free(subInput);
+		if (subOutput) fftw_free(subOutput);
 	}	/* D-TOR */
 
 	/** reset members to initialized state */
 	virtual bool reset(double _sampleRate)
 	{
-		memset(&phi[0], 0, sizeof(double)*PSM_FFT_LEN);
-		memset(&psi[0], 0, sizeof(double)* PSM_FFT_LEN);
-		if(outputBuff)
-			memset(outputBuff, 0, sizeof(double)*outputBufferLength);
+		memset(&phi[0], 0, sizeof(double)*PSM_NUM_BINS);
+		memset(&psi[0], 0, sizeof(double)*PSM_NUM_BINS);
 
-		for (int i = 0; i < PSM_FFT_LEN; i++)
+		for (uint32_t i = 0; i < PSM_NUM_BINS; i++)
 		{
 			binData[i].reset();
 			binDataPrevious[i].reset();
@@ -9217,45 +11506,42 @@ public:
 			peakBinsPrevious[i] = -1;
 		}
 
+		// --- flush the timelines and drop any hop in progress
+		memset(&inputBuffer[0], 0, sizeof(double)*PSM_INPUT_LEN);
+		memset(&outputBuffer[0], 0, sizeof(double)*PSM_OUTPUT_LEN);
+		inputWriteIndex = 0;
+		outputReadIndex = 0;
+		fftCounter = 0;
+		hopStage = hopProcessingStage::kIdle;
+		stageIndex = 0;
+
 		return true;
 	}
 
 	/** return false: this object only processes samples */
 	virtual bool canProcessAudioFrame() { return false; }
 
-	/** set the pitch shift in semitones (note that this can be fractional too)*/
+	/** latency in samples: the frame length, plus one hop when amortizeHopProcessing is set */
+	unsigned int getLatencyInSamples() { return PSM_FFT_LEN + (parameters.amortizeHopProcessing ? PSM_HOP_SIZE : 0); }
+
+	/** set the pitch shift in semitones (note that this can be fractional too); real-time safe, the
+	    new ratio is picked up by the next hop and its window is filled in as that hop is resampled */
 	void setPitchShift(double semitones)
 	{
-		// --- this is costly so only update when things changed
+		// --- only update when things changed
 		double newAlpha = pow(2.0, semitones / 12.0);
 		double newOutputBufferLength = round((1.0/newAlpha)*(double)PSM_FFT_LEN);
 
 		// --- check for change
-		if (newOutputBufferLength == outputBufferLength)
+		if (newOutputBufferLength == nextOutputBufferLength)
 			return;
 
 		// --- new stuff
-		alphaStretchRatio = newAlpha;
-		ha = hs / alphaStretchRatio;
-
-		// --- set output resample buffer
-		outputBufferLength = newOutputBufferLength;
-
-		// --- create Hann window
-		if (windowBuff) delete[] windowBuff;
-		windowBuff = new double[outputBufferLength];
-		windowCorrection = 0.0;
-		for (unsigned int i = 0; i < outputBufferLength; i++)
-		{
-			windowBuff[i] = 0.5 * (1.0 - cos((i*2.0*kPi) / (outputBufferLength)));
-			windowCorrection += windowBuff[i];
-		}
-		windowCorrection = 1.0 / windowCorrection;
+		nextAlphaStretchRatio = newAlpha;
 
-		// --- create output buffer
-		if (outputBuff) delete[] outputBuff;
-		outputBuff = new double[outputBufferLength];
-		memset(outputBuff, 0, sizeof(double)*outputBufferLength);
+		// --- set output resample length; the overlap-add must fit in the output timeline with the added hop,
+		//     and its steps in the hop, see PSM_MAX_RESAMPLE_LEN
+		nextOutputBufferLength = std::min((unsigned int)newOutputBufferLength, PSM_MAX_RESAMPLE_LEN);
 	}
 
 	/** find bin index of nearest peak bin in previous FFT frame */
@@ -9266,7 +11552,7 @@ public:
 
 		int delta = -1;
 		int previousPeak = -1;
-		for (int i = 0; i < PSM_FFT_LEN; i++)
+		for (uint32_t i = 0; i < PSM_NUM_BINS; i++)
 		{
 			if (peakBinsPrevious[i] < 0)
 				break;
@@ -9290,15 +11576,15 @@ public:
 		return previousPeak;
 	}
 
-	/** identify peak bins and tag their respective regions of influence */
-	void findPeaksAndRegionsOfInfluence()
+	/** identify the peak bins in [first, end); the magnitudes of all bins must be ready, the peaks are listed
+	    in peakBins in order, numPeaks counts them */
+	void findPeaks(uint32_t first, uint32_t end)
 	{
 		// --- FIND PEAKS --- //
 		//
 		// --- find local maxima in 4-sample window
 		double localWindow[4] = { 0.0, 0.0, 0.0, 0.0 };
-		int m = 0;
-		for (int i = 0; i < PSM_FFT_LEN; i++)
+		for (uint32_t i = first; i < end; i++)
 		{
 			if (i == 0)
 			{
@@ -9314,14 +11600,14 @@ public:
 				localWindow[2] = binData[i + 1].magnitude;
 				localWindow[3] = binData[i + 2].magnitude;
 			}
-			else  if (i == PSM_FFT_LEN - 1)
+			else  if (i == PSM_NUM_BINS - 1)
 			{
 				localWindow[0] = binData[i - 2].magnitude;
 				localWindow[1] = binData[i - 1].magnitude;
 				localWindow[2] = 0.0;
 				localWindow[3] = 0.0;
 			}
-			else  if (i == PSM_FFT_LEN - 2)
+			else  if (i == PSM_NUM_BINS - 2)
 			{
 				localWindow[0] = binData[i - 2].magnitude;
 				localWindow[1] = binData[i - 1].magnitude;
@@ -9344,7 +11630,7 @@ public:
 				&& binData[i].magnitude > localWindow[3])
 			{
 				binData[i].isPeak = true;
-				peakBins[m++] = i;
+				peakBins[numPeaks++] = i;
 
 				// --- for peak bins, assume that it is part of a previous, moving peak
 				if (parameters.enablePeakTracking)
@@ -9353,39 +11639,48 @@ public:
 					binData[i].previousPeakBin = -1;
 			}
 		}
+	}
 
+	/** start tagging the regions of influence once all peaks are found
+	\return true if there are regions to tag (at least two peaks)
+	*/
+	bool startRegionsOfInfluence()
+	{
 		// --- assign peak bosses
-		if (m > 0)
-		{
-			int n = 0;
-			int bossPeakBin = peakBins[n];
-			double nextPeak = peakBins[++n];
-			int midBoundary = (nextPeak - (double)bossPeakBin) / 2.0 + bossPeakBin;
+		if (numPeaks == 0)
+			return false;
+
+		bossPeakIndex = 0;
+		bossPeakBin = peakBins[bossPeakIndex];
+		nextPeak = peakBins[++bossPeakIndex];
+		midBoundary = (nextPeak - (double)bossPeakBin) / 2.0 + bossPeakBin;
 
-			if (nextPeak >= 0)
+		return nextPeak >= 0;
+	}
+
+	/** tag the regions of influence of the bins in [first, end), continuing from the bins before first */
+	void findRegionsOfInfluence(uint32_t first, uint32_t end)
+	{
+		for (uint32_t i = first; i < end; i++)
+		{
+			if (i <= bossPeakBin)
 			{
-				for (int i = 0; i < PSM_FFT_LEN; i++)
-				{
-					if (i <= bossPeakBin)
-					{
-						binData[i].localPeakBin = bossPeakBin;
-					}
-					else if (i < midBoundary)
-					{
-						binData[i].localPeakBin = bossPeakBin;
-					}
-					else // > boundary, calc next set
-					{
-						bossPeakBin = nextPeak;
-						nextPeak = peakBins[++n];
-						if (nextPeak > bossPeakBin)
-							midBoundary = (nextPeak - (double)bossPeakBin) / 2.0 + bossPeakBin;
-						else // nextPeak == -1
-							midBoundary = PSM_FFT_LEN;
-
-						binData[i].localPeakBin = bossPeakBin;
-					}
-				}
+				binData[i].localPeakBin = bossPeakBin;
+			}
+			else if (i < midBoundary)
+			{
+				binData[i].localPeakBin = bossPeakBin;
+			}
+			else // > boundary, calc next set
+			{
+				bossPeakBin = nextPeak;
+				nextPeak = peakBins[++bossPeakIndex];
+				if (nextPeak > bossPeakBin)
+					midBoundary = (nextPeak - (double)bossPeakBin) / 2.0 + bossPeakBin;
+				else // nextPeak == -1
+					midBoundary = PSM_NUM_BINS;
+
+				binData[i].localPeakBin = bossPeakBin;
 			}
 		}
 	}
@@ -9397,54 +11692,230 @@ public:
 	*/
 	virtual double processAudioSample(double input)
 	{
-			bool fftReady = false;
-			double output = 0.0;
+		// --- get the current output sample first, and clear it for the next overlap-add
+		double output = outputBuffer[outputReadIndex];
+		outputBuffer[outputReadIndex++] = 0.0;
+		outputReadIndex &= PSM_OUTPUT_LEN - 1;
 
-			// --- normal processing
-			output = vocoder.processAudioSample(input, fftReady);
+		// --- push into the input timeline
+		inputBuffer[inputWriteIndex++] = input;
+		inputWriteIndex &= PSM_INPUT_LEN - 1;
 
-			// --- if FFT is here, GO!
-			if (fftReady)
-			{
-			// --- get the FFT data
-			fftw_complex* fftData = vocoder.getFFTData();
+		// --- one step of the hop in progress
+		if (hopStage != hopProcessingStage::kIdle)
+			doHopProcessingStep();
 
-			if (parameters.enablePeakPhaseLocking)
-			{
-				// --- get the magnitudes for searching
-				for (int i = 0; i < PSM_FFT_LEN; i++)
-				{
-					binData[i].reset();
-					peakBins[i] = -1;
+		// --- new frame every hop, once the first frame is full
+		if (++fftCounter == PSM_FFT_LEN)
+		{
+			fftCounter = PSM_FFT_LEN - PSM_HOP_SIZE;
+			startHopProcessing();
+		}
 
-					// --- store mag and phase
-					binData[i].magnitude = getMagnitude(fftData[i][0], fftData[i][1]);
-					binData[i].phi = getPhase(fftData[i][0], fftData[i][1]);
-				}
+		return output;
+	}
 
-				findPeaksAndRegionsOfInfluence();
+	/** get parameters: note use of custom structure for passing param data */
+	/**
+	\return PSMVocoderParameters custom data structure
+	*/
+	PSMVocoderParameters getParameters()
+	{
+		return parameters;
+	}
 
+	/** set parameters: note use of custom structure for passing param data */
+	/**
+	\param PSMVocoderParameters custom data structure
+	*/
+	void setParameters(const PSMVocoderParameters& params)
+	{
+		if (params.pitchShiftSemitones != parameters.pitchShiftSemitones)
+		{
+			setPitchShift(params.pitchShiftSemitones);
+		}
+
+		// --- save
+		parameters = params;
+	}
+
+protected:
+	/** the stages of the work for one hop, in order */
+	enum class hopProcessingStage { kIdle, kFFTPack, kFFT, kFFTCombine, kFFTUnpack, kAnalysis, kPeaks, kRegionsOfInfluence,
+									kPhaseLocking, kLockNonPeaks, kIFFTPack, kIFFT, kIFFTCombine, kResample };
+
+	/** capture the frame and start the work for the hop */
+	void startHopProcessing()
+	{
+		// --- should never happen; the steps fit in a hop, see PSM_MAX_RESAMPLE_LEN
+		finishHopProcessing();
+
+		// --- the frame is the last N samples; the input timeline is 2N long so the frame is still there while
+		//     it is windowed and packed during the hop
+		frameStartIndex = (inputWriteIndex - PSM_FFT_LEN) & (PSM_INPUT_LEN - 1);
+		numPeaks = 0;
+
+		// --- latch the pitch shift for this hop; frames are always ha apart, the stretch only scales the
+		//     phase increments (a synthesis hop of alpha * ha, undone by the resampling)
+		alphaStretchRatio = nextAlphaStretchRatio;
+		outputBufferLength = nextOutputBufferLength;
+
+		// --- new length: the Hann window is recomputed as this hop is resampled; sum(w) = L/2 for a periodic Hann
+		if (outputBufferLength != windowLength)
+		{
+			windowLength = outputBufferLength;
+			windowValidCount = 0;
+			windowCorrection = windowLength > 0 ? 2.0 / windowLength : 0.0;
+		}
+
+		// --- overlap-add from the next output sample, one hop later when the work is spread over the hop
+		overlapAddIndex = parameters.amortizeHopProcessing ? (outputReadIndex + PSM_HOP_SIZE) & (PSM_OUTPUT_LEN - 1) : outputReadIndex;
+		hopStage = hopProcessingStage::kFFTPack;
+		stageIndex = 0;
+
+		if (!parameters.amortizeHopProcessing)
+			finishHopProcessing();
+	}
+
+	/** run the rest of the hop in progress */
+	void finishHopProcessing()
+	{
+		while (hopStage != hopProcessingStage::kIdle)
+			doHopProcessingStep();
+	}
+
+	/** do one step of the hop in progress: one sub-FFT, or up to PSM_BINS_PER_STEP bins, FFT points or output
+	    samples of the other stages */
+	void doHopProcessingStep()
+	{
+		const uint32_t first = stageIndex;
+		const uint32_t binsEnd = std::min(first + PSM_BINS_PER_STEP, PSM_NUM_BINS);
+		const uint32_t pointsEnd = std::min(first + PSM_BINS_PER_STEP, PSM_HALF_LEN);
+
+		switch (hopStage)
+		{
+			case hopProcessingStage::kFFTPack:
+			{
+				// --- window the frame into z(n) = x(2n) + jx(2n + 1), split by n mod PSM_FFT_SPLIT for the sub-FFTs
+				for (uint32_t n = first; n < pointsEnd; n++)
+				{
+					fftw_complex& z = subInput[(n % PSM_FFT_SPLIT) * PSM_SUB_FFT_LEN + n / PSM_FFT_SPLIT];
+					z[0] = inputBuffer[(frameStartIndex + 2 * n) & (PSM_INPUT_LEN - 1)] * analysisWindow[2 * n];
+					z[1] = inputBuffer[(frameStartIndex + 2 * n + 1) & (PSM_INPUT_LEN - 1)] * analysisWindow[2 * n + 1];
+				}
+				nextStageAt(pointsEnd, PSM_HALF_LEN, hopProcessingStage::kFFT);
+				return;
+			}
+			case hopProcessingStage::kFFT:
+			{
+				fftw_execute(plan_forward[first]);
+				nextStageAt(first + 1, PSM_FFT_SPLIT, hopProcessingStage::kFFTCombine);
+				return;
+			}
+			case hopProcessingStage::kFFTCombine:
+			{
+				// --- Z(k) = sum over r of W^rk Zr(k mod N/2/PSM_FFT_SPLIT), W = e^(-j2pi/(N/2))
+				for (uint32_t k = first; k < pointsEnd; k++)
+				{
+					double re = 0.0;
+					double im = 0.0;
+					for (uint32_t r = 0; r < PSM_FFT_SPLIT; r++)
+					{
+						const fftw_complex& zr = subOutput[r * PSM_SUB_FFT_LEN + (k & (PSM_SUB_FFT_LEN - 1))];
+						const uint32_t w = (r * k) & (PSM_HALF_LEN - 1);
+						re += zr[0] * halfTwiddleReal[w] - zr[1] * halfTwiddleImag[w];
+						im += zr[0] * halfTwiddleImag[w] + zr[1] * halfTwiddleReal[w];
+					}
+					halfData[k][0] = re;
+					halfData[k][1] = im;
+				}
+				nextStageAt(pointsEnd, PSM_HALF_LEN, hopProcessingStage::kFFTUnpack);
+				return;
+			}
+			case hopProcessingStage::kFFTUnpack:
+			{
+				// --- split Z into the spectra of the even and odd samples, X(k) = Xe(k) + e^(-j2pi k/N) Xo(k)
+				for (uint32_t k = first; k < binsEnd; k++)
+				{
+					const fftw_complex& zk = halfData[k & (PSM_HALF_LEN - 1)];
+					const fftw_complex& zm = halfData[(PSM_HALF_LEN - k) & (PSM_HALF_LEN - 1)];
+					const double evenRe = 0.5 * (zk[0] + zm[0]);
+					const double evenIm = 0.5 * (zk[1] - zm[1]);
+					const double oddRe = 0.5 * (zk[1] + zm[1]);
+					const double oddIm = -0.5 * (zk[0] - zm[0]);
+					fftData[k][0] = evenRe + oddRe * realTwiddleReal[k] - oddIm * realTwiddleImag[k];
+					fftData[k][1] = evenIm + oddRe * realTwiddleImag[k] + oddIm * realTwiddleReal[k];
+				}
+				nextStageAt(binsEnd, PSM_NUM_BINS, hopProcessingStage::kAnalysis);
+				return;
+			}
+			case hopProcessingStage::kAnalysis:
+			{
+				if (parameters.enablePeakPhaseLocking)
+				{
+					// --- get the magnitudes for searching
+					for (uint32_t i = first; i < binsEnd; i++)
+					{
+						binData[i].reset();
+						peakBins[i] = -1;
+
+						// --- store mag and phase
+						binData[i].magnitude = getMagnitude(fftData[i][0], fftData[i][1]);
+						binData[i].phi = getPhase(fftData[i][0], fftData[i][1]);
+					}
+				}
+				else // ---> old school
+				{
+					for (uint32_t i = first; i < binsEnd; i++)
+					{
+						double mag_k = getMagnitude(fftData[i][0], fftData[i][1]);
+						double phi_k = getPhase(fftData[i][0], fftData[i][1]);
+
+						// --- horizontal phase propagation
+						double deltaPhi = getPhaseIncrement(i, phi_k);
+
+						// --- save for next frame
+						phi[i] = phi_k;
+
+						// --- calculate new phase based on stretch factor; save phase for next time
+						psi[i] = principalArg(psi[i] + deltaPhi * alphaStretchRatio);
+
+						// --- convert back
+						fftData[i][0] = mag_k*cos(psi[i]);
+						fftData[i][1] = mag_k*sin(psi[i]);
+					}
+				}
+				nextStageAt(binsEnd, PSM_NUM_BINS, parameters.enablePeakPhaseLocking ? hopProcessingStage::kPeaks : hopProcessingStage::kIFFTPack);
+				return;
+			}
+			case hopProcessingStage::kPeaks:
+			{
+				findPeaks(first, binsEnd);
+				if (binsEnd < PSM_NUM_BINS)
+					stageIndex = binsEnd;
+				else
+					nextStage(startRegionsOfInfluence() ? hopProcessingStage::kRegionsOfInfluence : hopProcessingStage::kPhaseLocking);
+				return;
+			}
+			case hopProcessingStage::kRegionsOfInfluence:
+			{
+				findRegionsOfInfluence(first, binsEnd);
+				nextStageAt(binsEnd, PSM_NUM_BINS, hopProcessingStage::kPhaseLocking);
+				return;
+			}
+			case hopProcessingStage::kPhaseLocking:
+			{
 				// --- each bin data should now know its local boss-peak
 				//
 				// --- now propagate phases accordingly
 				//
 				//     FIRST: set PSI angles of bosses
-				for (int i = 0; i < PSM_FFT_LEN; i++)
+				for (uint32_t i = first; i < binsEnd; i++)
 				{
-					double mag_k = binData[i].magnitude;
 					double phi_k = binData[i].phi;
 
 					// --- horizontal phase propagation
-					//
-					// --- omega_k = bin frequency(k)
-					double omega_k = kTwoPi*i / PSM_FFT_LEN;
-
-					// --- phase deviation is actual - expected phase
-					//     = phi_k -(phi(last frame) + wk*ha
-					double phaseDev = phi_k - phi[i] - omega_k*ha;
-
-					// --- unwrapped phase increment
-					double deltaPhi = omega_k*ha + principalArg(phaseDev);
+					double deltaPhi = getPhaseIncrement(i, phi_k);
 
 					// --- save for next frame
 					phi[i] = phi_k;
@@ -9465,9 +11936,13 @@ public:
 					// --- for IFFT
 					binData[i].updatedPhase = binData[i].psi;
 				}
-
-				// --- now set non-peaks
-				for (int i = 0; i < PSM_FFT_LEN; i++)
+				nextStageAt(binsEnd, PSM_NUM_BINS, hopProcessingStage::kLockNonPeaks);
+				return;
+			}
+			case hopProcessingStage::kLockNonPeaks:
+			{
+				// --- now set non-peaks, then convert back
+				for (uint32_t i = first; i < binsEnd; i++)
 				{
 					if (!binData[i].isPeak)
 					{
@@ -9476,17 +11951,11 @@ public:
 						double PSI_kp = binData[myPeakBin].psi;
 						double phi_kp = binData[myPeakBin].phi;
 
-						// --- save for next frame
-						// phi[i] = binData[myPeakBin].phi;
-
 						// --- calculate new phase, locked to boss peak
 						psi[i] = principalArg(PSI_kp - phi_kp - binData[i].phi);
-						binData[i].updatedPhase = psi[i];// principalArg(PSI_kp - phi_kp - binData[i].phi);
+						binData[i].updatedPhase = psi[i];
 					}
-				}
 
-				for (int i = 0; i < PSM_FFT_LEN; i++)
-				{
 					double mag_k = binData[i].magnitude;
 
 					// --- convert back
@@ -9496,111 +11965,195 @@ public:
 					// --- save for next frame
 					binDataPrevious[i] = binData[i];
 					peakBinsPrevious[i] = peakBins[i];
-
 				}
-			}// end if peak locking
-
-			else // ---> old school
+				nextStageAt(binsEnd, PSM_NUM_BINS, hopProcessingStage::kIFFTPack);
+				return;
+			}
+			case hopProcessingStage::kIFFTPack:
 			{
-				for (int i = 0; i < PSM_FFT_LEN; i++)
+				// --- fold the N/2 + 1 bins into the N/2 point spectrum of z(n) = x(2n) + jx(2n + 1):
+				//     Z(k) = Xe(k) + jXo(k), with Xe and Xo from X(k) and X(N/2 - k)* (doubled, for the unnormalized
+				//     IFFT); the imaginary parts of DC and Nyquist are dropped, as a real IFFT does
+				for (uint32_t k = first; k < pointsEnd; k++)
 				{
-					double mag_k = getMagnitude(fftData[i][0], fftData[i][1]);
-					double phi_k = getPhase(fftData[i][0], fftData[i][1]);
-
-					// --- horizontal phase propagation
-					//
-					// --- omega_k = bin frequency(k)
-					double omega_k = kTwoPi*i / PSM_FFT_LEN;
+					const double xkRe = fftData[k][0];
+					const double xkIm = k == 0 ? 0.0 : fftData[k][1];
+					const double xmRe = fftData[PSM_HALF_LEN - k][0];
+					const double xmIm = k == 0 ? 0.0 : -fftData[PSM_HALF_LEN - k][1];
+					const double evenRe = xkRe + xmRe;
+					const double evenIm = xkIm + xmIm;
+					const double diffRe = xkRe - xmRe;
+					const double diffIm = xkIm - xmIm;
+					const double oddRe = diffRe * realTwiddleReal[k] + diffIm * realTwiddleImag[k];
+					const double oddIm = diffIm * realTwiddleReal[k] - diffRe * realTwiddleImag[k];
+
+					fftw_complex& z = subInput[(k % PSM_FFT_SPLIT) * PSM_SUB_FFT_LEN + k / PSM_FFT_SPLIT];
+					z[0] = evenRe - oddIm;
+					z[1] = evenIm + oddRe;
+				}
+				nextStageAt(pointsEnd, PSM_HALF_LEN, hopProcessingStage::kIFFT);
+				return;
+			}
+			case hopProcessingStage::kIFFT:
+			{
+				fftw_execute(plan_backward[first]);
+				nextStageAt(first + 1, PSM_FFT_SPLIT, hopProcessingStage::kIFFTCombine);
+				return;
+			}
+			case hopProcessingStage::kIFFTCombine:
+			{
+				// --- z(n) = sum over r of W^-rn zr(n mod N/2/PSM_FFT_SPLIT); x(2n) and x(2n + 1) are its real and imaginary parts
+				for (uint32_t n = first; n < pointsEnd; n++)
+				{
+					double re = 0.0;
+					double im = 0.0;
+					for (uint32_t r = 0; r < PSM_FFT_SPLIT; r++)
+					{
+						const fftw_complex& zr = subOutput[r * PSM_SUB_FFT_LEN + (n & (PSM_SUB_FFT_LEN - 1))];
+						const uint32_t w = (r * n) & (PSM_HALF_LEN - 1);
+						re += zr[0] * halfTwiddleReal[w] + zr[1] * halfTwiddleImag[w];
+						im += zr[1] * halfTwiddleReal[w] - zr[0] * halfTwiddleImag[w];
+					}
+					ifftOutput[2 * n] = re;
+					ifftOutput[2 * n + 1] = im;
+				}
+				nextStageAt(pointsEnd, PSM_HALF_LEN, hopProcessingStage::kResample);
+				return;
+			}
+			case hopProcessingStage::kResample:
+			{
+				// --- no pitch shift set yet: plain overlap-add of the IFFT, as PhaseVocoder::doOverlapAdd( )
+				if (outputBufferLength == 0)
+				{
+					const uint32_t samplesEnd = std::min(first + PSM_BINS_PER_STEP, PSM_FFT_LEN);
+					for (uint32_t i = first; i < samplesEnd; i++)
+						outputBuffer[(overlapAddIndex + i) & (PSM_OUTPUT_LEN - 1)] += windowHopCorrection * ifftOutput[i];
 
-					// --- phase deviation is actual - expected phase
-					//     = phi_k -(phi(last frame) + wk*ha
-					double phaseDev = phi_k - phi[i] - omega_k*ha;
+					nextStageAt(samplesEnd, PSM_FFT_LEN, hopProcessingStage::kIdle);
+					return;
+				}
 
-					// --- unwrapped phase increment
-					double deltaPhi = omega_k*ha + principalArg(phaseDev);
+				// --- resample the audio as if it were stretched (linear interpolation, see resample( )),
+				//     window it and overlap-add it straight into the output timeline
+				const uint32_t samplesEnd = std::min(first + PSM_BINS_PER_STEP, outputBufferLength);
+				const double inc = (double)(PSM_FFT_LEN - 1) / (double)(outputBufferLength - 1);
 
-					// --- save for next frame
-					phi[i] = phi_k;
+				// --- first hop at this length: fill in the cached window
+				for (uint32_t i = windowValidCount; i < samplesEnd; i++)
+					windowBuff[i] = 0.5 * (1.0 - cos((i*2.0*kPi) / (windowLength)));
+				windowValidCount = std::max(windowValidCount, samplesEnd);
 
-					// --- calculate new phase based on stretch factor; save phase for next time
-					psi[i] = principalArg(psi[i] + deltaPhi * alphaStretchRatio);
+				for (uint32_t i = first; i < samplesEnd; i++)
+				{
+					double xInterp = i*inc;
+					uint32_t x1 = (uint32_t)xInterp;
+					uint32_t x2 = std::min(x1 + 1, PSM_FFT_LEN - 1);
+					double yn = windowBuff[i] * windowCorrection * doLinearInterpolation(ifftOutput[x1], ifftOutput[x2], xInterp - x1);
 
-					// --- convert back
-					fftData[i][0] = mag_k*cos(psi[i]);
-					fftData[i][1] = mag_k*sin(psi[i]);
+					outputBuffer[(overlapAddIndex + i) & (PSM_OUTPUT_LEN - 1)] += yn;
 				}
+				nextStageAt(samplesEnd, outputBufferLength, hopProcessingStage::kIdle);
+				return;
 			}
+			case hopProcessingStage::kIdle:
+			default:
+				return;
+		}
+	}
 
+	/** horizontal phase propagation: the unwrapped phase increment of bin k since the last frame */
+	inline double getPhaseIncrement(uint32_t k, double phi_k)
+	{
+		// --- omega_k = bin frequency(k)
+		double omega_k = kTwoPi*k / PSM_FFT_LEN;
 
-			// --- manually so the IFFT (OPTIONAL)
-			vocoder.doInverseFFT();
-
-			// --- can get the iFFT buffers
-			fftw_complex* inv_fftData = vocoder.getIFFTData();
-
-			// --- make copy (can speed this up)
-			double ifft[PSM_FFT_LEN] = { 0.0 };
-			for (int i = 0; i < PSM_FFT_LEN; i++)
-				ifft[i] = inv_fftData[i][0];
-
-			// --- resample the audio as if it were stretched
-			resample(&ifft[0], outputBuff, PSM_FFT_LEN, outputBufferLength, interpolation::kLinear, windowCorrection, windowBuff);
-
-			// --- overlap-add the interpolated buffer to complete the operation
-			vocoder.doOverlapAdd(&outputBuff[0], outputBufferLength);
-			}
+		// --- phase deviation is actual - expected phase
+		//     = phi_k -(phi(last frame) + wk*ha
+		double phaseDev = phi_k - phi[k] - omega_k*ha;
 
-			return output;
+		// --- unwrapped phase increment
+		return omega_k*ha + principalArg(phaseDev);
 	}
 
-	/** get parameters: note use of custom structure for passing param data */
-	/**
-	\return PSMVocoderParameters custom data structure
-	*/
-	PSMVocoderParameters getParameters()
+	/** move to the next stage */
+	inline void nextStage(hopProcessingStage stage)
 	{
-		return parameters;
+		hopStage = stage;
+		stageIndex = 0;
 	}
 
-	/** set parameters: note use of custom structure for passing param data */
-	/**
-	\param PSMVocoderParameters custom data structure
-	*/
-	void setParameters(const PSMVocoderParameters& params)
+	/** move to the next stage once the current one has reached its end */
+	inline void nextStageAt(uint32_t index, uint32_t end, hopProcessingStage stage)
 	{
-		if (params.pitchShiftSemitones != parameters.pitchShiftSemitones)
-		{
-			setPitchShift(params.pitchShiftSemitones);
-		}
-
-		// --- save
-		parameters = params;
+		if (index >= end)
+			nextStage(stage);
+		else
+			stageIndex = index;
 	}
 
-protected:
 	PSMVocoderParameters parameters;	///< object parameters
-	PhaseVocoder vocoder;				///< vocoder to perform PSM
 	double alphaStretchRatio = 1.0;		///< alpha stretch ratio = hs/ha
 
 	// --- FFT is 4096 with 75% overlap
-	const double hs = PSM_FFT_LEN / 4;	///< hs = N/4 --- 75% overlap
-	double ha = PSM_FFT_LEN / 4;		///< ha = N/4 --- 75% overlap
-	double phi[PSM_FFT_LEN] = { 0.0 };	///< array of phase values for classic algorithm
-	double psi[PSM_FFT_LEN] = { 0.0 };	///< array of phase correction values for classic algorithm
+	const double ha = PSM_HOP_SIZE;		///< ha = N/4 --- 75% overlap; the analysis hop, the frames are captured ha samples apart
+	double phi[PSM_NUM_BINS] = { 0.0 };	///< array of phase values for classic algorithm
+	double psi[PSM_NUM_BINS] = { 0.0 };	///< array of phase correction values for classic algorithm
 
 	// --- for peak-locking
-	BinData binData[PSM_FFT_LEN];			///< array of BinData structures for current FFT frame
-	BinData binDataPrevious[PSM_FFT_LEN];	///< array of BinData structures for previous FFT frame
+	BinData binData[PSM_NUM_BINS];			///< array of BinData structures for current FFT frame
+	BinData binDataPrevious[PSM_NUM_BINS];	///< array of BinData structures for previous FFT frame
 
-	int peakBins[PSM_FFT_LEN] = { -1 };		///< array of current peak bin index values (-1 = not peak)
-	int peakBinsPrevious[PSM_FFT_LEN] = { -1 }; ///< array of previous peak bin index values (-1 = not peak)
+	int peakBins[PSM_NUM_BINS] = { -1 };		///< array of current peak bin index values (-1 = not peak)
+	int peakBinsPrevious[PSM_NUM_BINS] = { -1 }; ///< array of previous peak bin index values (-1 = not peak)
 
-	double* windowBuff = nullptr;			///< buffer for window
-	double* outputBuff = nullptr;			///< buffer for resampled output
+	double windowBuff[PSM_MAX_RESAMPLE_LEN];	///< buffer for window (cached for windowLength)
+	unsigned int windowLength = 0;			///< length of the window in windowBuff
+	uint32_t windowValidCount = 0;			///< number of windowBuff entries computed so far for windowLength
 	double windowCorrection = 0.0;			///< window correction value
-	unsigned int outputBufferLength = 0;	///< lenght of resampled output array
+	unsigned int outputBufferLength = 0;	///< lenght of resampled output array (for the hop in progress)
+
+	// --- set by setPitchShift( ), latched at the start of each hop
+	double nextAlphaStretchRatio = 1.0;			///< alpha stretch ratio for the next hop
+	unsigned int nextOutputBufferLength = 0;	///< resampled length for the next hop
+
+	// --- real FFT, as PSM_FFT_SPLIT sub-FFTs of the N/2 point complex FFT
+	fftw_complex* fftData = nullptr;		///< the N/2 + 1 bins (FFT output, IFFT input)
+	double* ifftOutput = nullptr;			///< IFFT output
+	fftw_complex* halfData = nullptr;		///< N/2 point spectrum of the packed frame, before the real unpacking
+	fftw_complex* subInput = nullptr;		///< sub-FFT inputs, PSM_SUB_FFT_LEN points each
+	fftw_complex* subOutput = nullptr;		///< sub-FFT outputs, PSM_SUB_FFT_LEN points each
+	fftw_plan plan_forward[PSM_FFT_SPLIT] = { nullptr };	///< FFTW plans for the forward sub-FFTs
+	fftw_plan plan_backward[PSM_FFT_SPLIT] = { nullptr };	///< FFTW plans for the inverse sub-FFTs
+	double halfTwiddleReal[PSM_HALF_LEN];	///< e^(-j2pi k/(N/2)), real part
+	double halfTwiddleImag[PSM_HALF_LEN];	///< e^(-j2pi k/(N/2)), imaginary part
+	double realTwiddleReal[PSM_NUM_BINS];	///< e^(-j2pi k/N), real part
+	double realTwiddleImag[PSM_NUM_BINS];	///< e^(-j2pi k/N), imaginary part
+	double analysisWindow[PSM_FFT_LEN];		///< periodic Hann window
+	double windowHopCorrection = 1.0;		///< window correction including hop/overlap (no pitch shift set)
+
+	// --- timelines
+	double inputBuffer[PSM_INPUT_LEN];		///< input timeline (x), circular
+	double outputBuffer[PSM_OUTPUT_LEN];	///< output timeline (y), circular; overlap-add accumulator
+	unsigned int inputWriteIndex = 0;		///< input write index
+	unsigned int frameStartIndex = 0;		///< oldest sample of the frame for the hop in progress
+	unsigned int outputReadIndex = 0;		///< output read index
+	unsigned int fftCounter = 0;			///< FFT sample counter
+
+	// --- the hop in progress
+	hopProcessingStage hopStage = hopProcessingStage::kIdle;	///< current stage
+	uint32_t stageIndex = 0;				///< next bin or output sample of the current stage
+	unsigned int overlapAddIndex = 0;		///< where the resampled frame lands in the output timeline
+
+	// --- peak search state, carried from step to step
+	uint32_t numPeaks = 0;					///< peaks found so far in peakBins
+	uint32_t bossPeakIndex = 0;				///< peakBins index of the current boss peak
+	int bossPeakBin = 0;					///< current boss peak bin
+	double nextPeak = -1.0;					///< next peak bin, or -1 after the last one
+	int midBoundary = 0;					///< first bin of the next boss peak's region of influence
 };
 
+#endif
+
 // --- sample rate conversion
 //
 // --- supported conversion ratios - you can EASILY add more to this
@@ -9639,80 +12192,179 @@ inline unsigned int countForRatio(rateConversionRatio ratio)
 	return 0;
 }
 
-// --- get table pointer for built-in anti-aliasing LPFs
 /**
-@getFilterIRTable
+@besselI0
 \ingroup FX-Functions
 
-@brief returns the up or downsample ratio as a numeric value
+@brief returns the zeroth order modified Bessel function of the first kind, I0(x), for the Kaiser window
 
-\param FIRLength - lenght of FIR
-\param ratio - the conversinon ratio
-\param sampleRate - the sample rate
-\return a pointer to the appropriate FIR coefficient table in filters.h or nullptr if not found
+\param x - the argument
+\return I0(x)
 */
-inline double* getFilterIRTable(unsigned int FIRLength, rateConversionRatio ratio, unsigned int sampleRate)
+inline double besselI0(double x)
 {
-	// --- we only have built in filters for 44.1 and 48 kHz
-	if (sampleRate != 44100 && sampleRate != 48000) return nullptr;
+	// --- power series; the terms fall off quickly for the beta values of audio filters
+	double sum = 1.0;
+	double term = 1.0;
+	const double halfX = 0.5 * x;
+	for (unsigned int k = 1; k < 64; k++)
+	{
+		term *= (halfX / k) * (halfX / k);
+		sum += term;
+		if (term < sum * 1.0e-17) break;
+	}
+	return sum;
+}
 
-	// --- choose 2xtable
-	if (ratio == rateConversionRatio::k2x)
+/**
+@designKaiserLowpass
+\ingroup FX-Functions
+
+@brief designs a linear phase, Kaiser windowed-sinc lowpass FIR with unity gain at DC
+
+The Kaiser beta comes from the stopband attenuation; for a given length the transition band is then
+about (attenuation_dB - 7.95) / (14.36 * (length - 1)) of the sample rate, centred on fc.
+
+\param filterIR - array of length values to receive the IR
+\param length - the filter length
+\param fc - the cutoff frequency as a fraction of the sample rate (0.0 to 0.5)
+\param attenuation_dB - the stopband attenuation in dB (positive)
+*/
+inline void designKaiserLowpass(double* filterIR, unsigned int length, double fc, double attenuation_dB)
+{
+	double beta = 0.0;
+	if (attenuation_dB > 50.0)
+		beta = 0.1102 * (attenuation_dB - 8.7);
+	else if (attenuation_dB > 21.0)
+		beta = 0.5842 * pow(attenuation_dB - 21.0, 0.4) + 0.07886 * (attenuation_dB - 21.0);
+
+	const double centre = 0.5 * (length - 1);
+	const double windowScale = 1.0 / besselI0(beta);
+	double sum = 0.0;
+	for (unsigned int i = 0; i < length; i++)
 	{
-		if (sampleRate == 44100)
-		{
-			if (FIRLength == 128)
-				return &LPF128_882[0];
-			else if (FIRLength == 256)
-				return &LPF256_882[0];
-			else if (FIRLength == 512)
-				return &LPF512_882[0];
-			else if (FIRLength == 1024)
-				return &LPF1024_882[0];
-		}
-		if (sampleRate == 48000)
-		{
-			if (FIRLength == 128)
-				return &LPF128_96[0];
-			else if (FIRLength == 256)
-				return &LPF256_96[0];
-			else if (FIRLength == 512)
-				return &LPF512_96[0];
-			else if (FIRLength == 1024)
-				return &LPF1024_96[0];
-		}
+		const double n = i - centre;
+		const double sinc = n == 0.0 ? 2.0 * fc : sin(kTwoPi * fc * n) / (kPi * n);
+		const double r = centre > 0.0 ? n / centre : 0.0;
+		const double window = besselI0(beta * sqrt(std::max(1.0 - r * r, 0.0))) * windowScale;
+		filterIR[i] = sinc * window;
+		sum += filterIR[i];
 	}
 
-	// --- choose 4xtable
-	if (ratio == rateConversionRatio::k4x)
+	// --- normalize to unity gain at DC
+	if (sum != 0.0)
 	{
-		if (sampleRate == 44100)
-		{
-			if (FIRLength == 128)
-				return &LPF128_1764[0];
-			else if (FIRLength == 256)
-				return &LPF256_1764[0];
-			else if (FIRLength == 512)
-				return &LPF512_1764[0];
-			else if (FIRLength == 1024)
-				return &LPF1024_1764[0];
-		}
-		if (sampleRate == 48000)
-		{
-			if (FIRLength == 128)
-				return &LPF128_192[0];
-			else if (FIRLength == 256)
-				return &LPF256_192[0];
-			else if (FIRLength == 512)
-				return &LPF512_192[0];
-			else if (FIRLength == 1024)
-				return &LPF1024_192[0];
-		}
+		for (unsigned int i = 0; i < length; i++)
+			filterIR[i] /= sum;
 	}
-	return nullptr;
 }
 
-// --- get table pointer for built-in anti-aliasing LPFs
+/**
+\struct OversamplingFilterTable
+\ingroup FX-Objects
+\brief
+An anti-aliasing filter for the Interpolator and Decimator, designed by getOversamplingFilterTable( ), along with
+its polyphase decomposition. The tables are immutable and shared by every converter with the same length, ratio
+and sample rate.
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+struct OversamplingFilterTable
+{
+	unsigned int FIRLength = 0;			///< length of the full filter
+	unsigned int count = 0;				///< conversion ratio as a number; the number of sub-bands
+	unsigned int subBandLength = 0;		///< FIRLength / count
+	double passbandEdge = 0.0;			///< top of the passband in Hz
+	double attenuation_dB = 0.0;		///< stopband attenuation above the base rate Nyquist frequency
+	std::vector<double> filterIR;		///< the full filter, FIRLength taps
+	std::vector<double> polyPhaseIR;	///< the sub-band filters one after the other; sub-band i holds taps i*count + (count - 1 - i)
+};
+
+/** stopband attenuation the oversampling filter designer aims for */
+const double kOversamplingAttenuation_dB = 96.0;
+
+/** upper limit for the oversampling filter passband */
+const double kOversamplingMaxPassband_Hz = 20000.0;
+
+/**
+@getOversamplingFilterTable
+\ingroup FX-Functions
+
+@brief returns the anti-aliasing filter for a sample rate converter, designing it on first use and caching it;
+call this at reset time, not from the realtime audio thread
+
+The filter is a Kaiser windowed sinc (see designKaiserLowpass( )) with its stopband starting at the Nyquist frequency
+of the base rate. The passband reaches 20 kHz when the length allows kOversamplingAttenuation_dB; shorter filters
+trade passband for attenuation, down to a quarter of the base rate, below which the attenuation gives way instead.
+
+\param FIRLength - length of the FIR; a multiple of the ratio
+\param ratio - the conversion ratio
+\param sampleRate - the base sample rate
+\return the shared table or nullptr if the arguments are invalid
+*/
+inline std::shared_ptr<const OversamplingFilterTable> getOversamplingFilterTable(unsigned int FIRLength, rateConversionRatio ratio, unsigned int sampleRate)
+{
+	const unsigned int count = countForRatio(ratio);
+	if (count == 0 || sampleRate == 0 || FIRLength < 2 * count || FIRLength % count != 0) return nullptr;
+
+	// --- one cache for the whole process
+	static std::mutex cacheMutex;
+	static std::map<std::tuple<unsigned int, unsigned int, unsigned int>, std::shared_ptr<const OversamplingFilterTable>> cache;
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	const std::tuple<unsigned int, unsigned int, unsigned int> key(FIRLength, count, sampleRate);
+	auto cached = cache.find(key);
+	if (cached != cache.end())
+		return cached->second;
+
+	std::shared_ptr<OversamplingFilterTable> table = std::make_shared<OversamplingFilterTable>();
+	table->FIRLength = FIRLength;
+	table->count = count;
+	table->subBandLength = FIRLength / count;
+
+	// --- band edges
+	const double oversampledRate = (double)sampleRate * count;
+	const double stopbandEdge = 0.5 * sampleRate;
+	const double transition = oversampledRate * (kOversamplingAttenuation_dB - 7.95) / (14.36 * (FIRLength - 1));
+	table->passbandEdge = std::max(std::min(stopbandEdge - transition, kOversamplingMaxPassband_Hz), 0.25 * sampleRate);
+	table->attenuation_dB = std::min(7.95 + 14.36 * (FIRLength - 1) * (stopbandEdge - table->passbandEdge) / oversampledRate, 140.0);
+
+	table->filterIR.resize(FIRLength);
+	designKaiserLowpass(&table->filterIR[0], FIRLength, 0.5 * (table->passbandEdge + stopbandEdge) / oversampledRate, table->attenuation_dB);
+
+	// --- polyphase decomposition, see decomposeFilter( )
+	table->polyPhaseIR.resize(FIRLength);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		for (unsigned int j = 0; j < table->subBandLength; j++)
+			table->polyPhaseIR[i * table->subBandLength + j] = table->filterIR[j * count + (count - 1 - i)];
+	}
+
+	cache[key] = table;
+	return table;
+}
+
+// --- get table pointer for anti-aliasing LPFs
+/**
+@getFilterIRTable
+\ingroup FX-Functions
+
+@brief returns the anti-aliasing filter for a sample rate converter; see getOversamplingFilterTable( )
+
+\param FIRLength - lenght of FIR
+\param ratio - the conversinon ratio
+\param sampleRate - the sample rate
+\return a pointer to the FIR coefficients, which stay valid for the life of the process, or nullptr if the arguments are invalid
+*/
+inline const double* getFilterIRTable(unsigned int FIRLength, rateConversionRatio ratio, unsigned int sampleRate)
+{
+	std::shared_ptr<const OversamplingFilterTable> table = getOversamplingFilterTable(FIRLength, ratio, sampleRate);
+	return table ? &table->filterIR[0] : nullptr;
+}
+
+// --- polyphase decomposition
 /**
 @decomposeFilter
 \ingroup FX-Functions
@@ -9747,9 +12399,251 @@ inline double** decomposeFilter(double* filterIR, unsigned int FIRLength, unsign
 	return polyFilterSet;
 }
 
+/**
+@dotProduct
+\ingroup FX-Functions
+
+@brief returns the dot product of two arrays; this is the inner loop of the direct form FIR filters and uses
+the SIMD instruction set where available (see FXOBJECTS_NO_SIMD)
+
+\param x - first array
+\param h - second array
+\param length - length of both arrays
+\return the sum of x[i]*h[i]
+*/
+inline double dotProduct(const double* x, const double* h, unsigned int length)
+{
+	unsigned int i = 0;
+	double sum = 0.0;
+
+#if defined(FXOBJECTS_AVX)
+	__m256d acc4 = _mm256_setzero_pd();
+	for (; i + 4 <= length; i += 4)
+		acc4 = _mm256_add_pd(acc4, _mm256_mul_pd(_mm256_loadu_pd(&x[i]), _mm256_loadu_pd(&h[i])));
+	__m128d acc2 = _mm_add_pd(_mm256_castpd256_pd128(acc4), _mm256_extractf128_pd(acc4, 1));
+	sum = _mm_cvtsd_f64(_mm_add_sd(acc2, _mm_unpackhi_pd(acc2, acc2)));
+#elif defined(FXOBJECTS_SSE2)
+	__m128d acc2a = _mm_setzero_pd();
+	__m128d acc2b = _mm_setzero_pd();
+	for (; i + 4 <= length; i += 4)
+	{
+		acc2a = _mm_add_pd(acc2a, _mm_mul_pd(_mm_loadu_pd(&x[i]), _mm_loadu_pd(&h[i])));
+		acc2b = _mm_add_pd(acc2b, _mm_mul_pd(_mm_loadu_pd(&x[i + 2]), _mm_loadu_pd(&h[i + 2])));
+	}
+	__m128d acc2 = _mm_add_pd(acc2a, acc2b);
+	sum = _mm_cvtsd_f64(_mm_add_sd(acc2, _mm_unpackhi_pd(acc2, acc2)));
+#elif defined(FXOBJECTS_NEON)
+	float64x2_t acc2a = vdupq_n_f64(0.0);
+	float64x2_t acc2b = vdupq_n_f64(0.0);
+	for (; i + 4 <= length; i += 4)
+	{
+		acc2a = vfmaq_f64(acc2a, vld1q_f64(&x[i]), vld1q_f64(&h[i]));
+		acc2b = vfmaq_f64(acc2b, vld1q_f64(&x[i + 2]), vld1q_f64(&h[i + 2]));
+	}
+	sum = vaddvq_f64(vaddq_f64(acc2a, acc2b));
+#endif
+	// --- scalar fallback for the remaining taps
+	for (; i < length; i++)
+		sum += x[i] * h[i];
+
+	return sum;
+}
+
+/**
+\class DirectFormFIR
+\ingroup FX-Objects
+\brief
+The DirectFormFIR object implements a direct form FIR filter with no latency beyond that of the filter itself;
+it is the sub-band filter of the polyphase Interpolator and Decimator.
+
+The signal history is written twice, into a buffer of twice the filter length, so that the most recent
+length samples are always contiguous and the convolution is a single dotProduct( ) over the coefficient table.
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+/** NOTE - this is NOT an IAudioSignalProcessor */
+class DirectFormFIR
+{
+public:
+	DirectFormFIR() { initialize(1); }	/* C-TOR */
+	~DirectFormFIR() {}		/* D-TOR */
+
+	/** create the buffers for a filter of length taps; the filter IR is all zeros until setFilterIR( ) is called
+	//	   do NOT call from realtime audio thread; do this prior to any processing */
+	void initialize(unsigned int _length)
+	{
+		length = _length > 0 ? _length : 1;
+		writeIndex = 0;
+
+		// --- create (and clear out) the buffers
+		filterIR.reset(new double[length]);
+		signalHistory.reset(new double[2 * length]);
+		memset(&filterIR[0], 0, length * sizeof(double));
+		sharedFilterIR.reset();
+		coefficients = &filterIR[0];
+		flushBuffer();
+	}
+
+	/** flush the signal history; the filter IR is static */
+	void flushBuffer() { memset(&signalHistory[0], 0, 2 * length * sizeof(double)); }
+
+	/** set the impulse response; the array must hold at least getLength( ) values */
+	void setFilterIR(const double* irArray)
+	{
+		memcpy(&filterIR[0], irArray, length * sizeof(double));
+		sharedFilterIR.reset();
+		coefficients = &filterIR[0];
+	}
+
+	/** use a shared, immutable impulse response instead of a private copy; the array must hold at least getLength( )
+	    values and the filter keeps it alive (see OversamplingFilterTable) */
+	void shareFilterIR(std::shared_ptr<const double> irArray)
+	{
+		sharedFilterIR = irArray;
+		coefficients = sharedFilterIR ? sharedFilterIR.get() : &filterIR[0];
+	}
+
+	/** process one input */
+	/**
+	\param xn input
+	\return the filtered sample
+	*/
+	inline double processAudioSample(double xn)
+	{
+		// --- signalHistory[writeIndex + i] = x(n - i) for i = 0 ... length - 1
+		writeIndex = writeIndex == 0 ? length - 1 : writeIndex - 1;
+		signalHistory[writeIndex] = xn;
+		signalHistory[writeIndex + length] = xn;
+
+		return dotProduct(&signalHistory[writeIndex], coefficients, length);
+	}
+
+	/** get the filter length */
+	unsigned int getLength() { return length; }
+
+protected:
+	std::unique_ptr<double[]> filterIR = nullptr;		///< filter coefficients, h(0) first
+	std::shared_ptr<const double> sharedFilterIR = nullptr;	///< shared filter coefficients, see shareFilterIR( )
+	const double* coefficients = nullptr;				///< the coefficients in use, filterIR or sharedFilterIR
+	std::unique_ptr<double[]> signalHistory = nullptr;	///< the last length samples, written twice
+	unsigned int length = 0;		///< filter length
+	unsigned int writeIndex = 0;	///< position of x(n) in signalHistory
+};
+
+/**
+\class HalfBandFilter
+\ingroup FX-Objects
+\brief
+The HalfBandFilter object implements a 2x interpolator or decimator with a half-band FIR filter, which is
+designed when the object is initialized (Blackman windowed sinc with the cutoff at half Nyquist of the
+higher rate).
+
+Every other coefficient of a half-band filter is zero, so the polyphase decomposition leaves one sub-band
+filter with half the taps and one sub-band that is a pure delay with a gain of 0.5: a 2x conversion costs
+roughly a quarter of the multiplies of the equivalent full FIR. Cascade them for 4x (see Interpolator and
+Decimator initializeHalfBand( )).
+
+Use one object per direction: the filter state is that of either the interpolator or the decimator.
+
+Audio I/O:
+- Processes one input sample to two output samples (interpolateAudio( )) or two input samples to one
+  output sample (decimateAudio( )).
+
+Control I/F:
+- none.
+
+\author Steve Dwyer
+\version Revision : 1.0
+\date Date : 2026 / 10 / 17
+*/
+class HalfBandFilter
+{
+public:
+	HalfBandFilter() { initialize(31); }	/* C-TOR */
+	~HalfBandFilter() {}					/* D-TOR */
+
+	/** design the half-band filter; the length is rounded to the nearest 4K - 1 taps (K >= 1)
+	//	   do NOT call from realtime audio thread; do this prior to any processing */
+	/**
+	\param numTaps the requested filter length
+	*/
+	void initialize(unsigned int numTaps)
+	{
+		// --- 4K - 1 taps: centre tap at 2K - 1, the non-zero taps are the centre and the 2K taps at an odd
+		//     distance from it, which are the even numbered taps
+		halfLength = std::max((numTaps + 1) / 4, 1u);
+		const unsigned int length = 4 * halfLength - 1;
+		const double centre = (double)(2 * halfLength - 1);
+
+		std::unique_ptr<double[]> evenTaps(new double[2 * halfLength]);
+		double sum = 0.0;
+		for (unsigned int i = 0; i < 2 * halfLength; i++)
+		{
+			const unsigned int n = 2 * i;
+			const double m = (double)n - centre;
+			const double sinc = sin(kPi * m / 2.0) / (kPi * m);
+			const double window = 0.42 - 0.5 * cos(kTwoPi * (n + 1) / (length + 1)) + 0.08 * cos(2.0 * kTwoPi * (n + 1) / (length + 1));
+			evenTaps[i] = sinc * window;
+			sum += evenTaps[i];
+		}
+
+		// --- normalize: the even taps sum to 0.5 and the centre tap is 0.5 for unity gain at DC
+		for (unsigned int i = 0; i < 2 * halfLength; i++)
+			evenTaps[i] *= 0.5 / sum;
+
+		evenFilter.initialize(2 * halfLength);
+		evenFilter.setFilterIR(&evenTaps[0]);
+
+		// --- delay branch
+		delayBranch.createCircularBuffer(halfLength + 1);
+		delayBranch.setInterpolate(false);
+	}
+
+	/** flush the filter state */
+	void reset()
+	{
+		evenFilter.flushBuffer();
+		delayBranch.flushBuffer();
+	}
+
+	/** interpolate one input sample to two output samples */
+	/**
+	\param xn input
+	\param output array of two output samples, in time order
+	*/
+	inline void interpolateAudio(double xn, double* output)
+	{
+		// --- 2x amp correction for the zero stuffing
+		delayBranch.writeBuffer(xn);
+		output[0] = 2.0 * evenFilter.processAudioSample(xn);
+		output[1] = delayBranch.readBuffer((int)halfLength - 1);
+	}
+
+	/** decimate two input samples to one output sample */
+	/**
+	\param input array of two input samples, in time order
+	\return the decimated sample
+	*/
+	inline double decimateAudio(const double* input)
+	{
+		delayBranch.writeBuffer(input[0]);
+		return evenFilter.processAudioSample(input[1]) + 0.5 * delayBranch.readBuffer((int)halfLength - 1);
+	}
+
+	/** the latency in samples at the higher rate */
+	unsigned int getLatencyInSamples() { return 2 * halfLength - 1; }
+
+protected:
+	DirectFormFIR evenFilter;				///< the even numbered taps
+	CircularBuffer<double> delayBranch;		///< the centre tap: a delay of K - 1 samples at the lower rate
+	unsigned int halfLength = 8;			///< K
+};
+
 /**
 \struct InterpolatorOutput
-\ingroup FFTW-Objects
+\ingroup FX-Objects
 \brief
 Custom output structure for interpolator; it holds an arry of interpolated output samples.
 
@@ -9765,13 +12659,19 @@ struct InterpolatorOutput
 	unsigned int count = maxSamplingRatio;			///< number of samples in output array
 };
 
+/** maximum number of cascaded 2x half-band stages */
+const unsigned int maxHalfBandStages = 2;
 
 /**
 \class Interpolator
-\ingroup FFTW-Objects
+\ingroup FX-Objects
 \brief
 The Interpolator object implements a sample rate interpolator. One input sample yields N output samples.
 
+The polyphase sub-band filters are direct form FIRs (DirectFormFIR), so there is no latency beyond the
+group delay of the anti-aliasing filter and no FFT; this object does not need FFTW. Alternatively,
+initializeHalfBand( ) sets up a cascade of 2x HalfBandFilter stages.
+
 Audio I/O:
 - Processes mono input to interpoalted (multi-sample) output.
 
@@ -9780,8 +12680,8 @@ Control I/F:
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\version Revision : 1.1 direct form polyphase FIR, half-band stages (Steve Dwyer)
+\date Date : 2026 / 10 / 17
 */
 class Interpolator
 {
@@ -9799,39 +12699,66 @@ public:
 	inline void initialize(unsigned int _FIRLength, rateConversionRatio _ratio, unsigned int _sampleRate, bool _polyphase = true)
 	{
 		polyphase = _polyphase;
+		halfBand = false;
 		sampleRate = _sampleRate;
 		FIRLength = _FIRLength;
 		ratio = _ratio;
 		unsigned int count = countForRatio(ratio);
 		unsigned int subBandLength = FIRLength / count;
 
-		// --- straight SRC, no polyphase
+		// --- create the filters; they are silent until they have an IR
 		convolver.initialize(FIRLength);
+		for (unsigned int i = 0; i < count; i++)
+			polyPhaseFilters[i].initialize(subBandLength);
 
-		// --- set filterIR from built-in set - user can always override this!
-		double* filterTable = getFilterIRTable(FIRLength, ratio, sampleRate);
+		// --- share the designed filter tables - user can always override this with setFilterIR( )!
+		std::shared_ptr<const OversamplingFilterTable> filterTable = getOversamplingFilterTable(FIRLength, ratio, sampleRate);
 		if (!filterTable) return;
-		convolver.setFilterIR(filterTable);
+		convolver.shareFilterIR(std::shared_ptr<const double>(filterTable, &filterTable->filterIR[0]));
+		for (unsigned int i = 0; i < count; i++)
+			polyPhaseFilters[i].shareFilterIR(std::shared_ptr<const double>(filterTable, &filterTable->polyPhaseIR[i * subBandLength]));
+	}
 
-		if (!polyphase) return;
+	/** setup the sample rate interpolator as a cascade of 2x half-band stages; the later stages run at the
+	    higher rates where the transition band is relatively wider, so they use half the taps of the one before */
+	/**
+	\param numTaps the length of the first half-band filter (see HalfBandFilter::initialize( ))
+	\param _ratio the conversion ratio (see rateConversionRatio)
+	*/
+	inline void initializeHalfBand(unsigned int numTaps, rateConversionRatio _ratio)
+	{
+		halfBand = true;
+		ratio = _ratio;
+		numHalfBandStages = countForRatio(ratio) == 4 ? 2 : 1;
+		for (unsigned int i = 0; i < numHalfBandStages; i++)
+			halfBandStages[i].initialize(numTaps >> i);
+	}
 
-		// --- decompose filter
-		double** polyPhaseFilters = decomposeFilter(filterTable, FIRLength, count);
-		if (!polyPhaseFilters)
-		{
-			polyphase = false;
-			return;
-		}
+	/** set the anti-aliasing filter IR, FIRLength taps long, and decompose it into the sub-band filters */
+	inline void setFilterIR(const double* filterIR)
+	{
+		unsigned int count = countForRatio(ratio);
+		convolver.setFilterIR(filterIR);
 
-		// --- set the individual polyphase filter IRs on the convolvers
+		// --- see decomposeFilter( ): sub-band i holds taps i*count + (count - 1 - i)
+		unsigned int subBandLength = FIRLength / count;
+		std::unique_ptr<double[]> subBandIR(new double[subBandLength]);
 		for (unsigned int i = 0; i < count; i++)
 		{
-			polyPhaseConvolvers[i].initialize(subBandLength);
-			polyPhaseConvolvers[i].setFilterIR(polyPhaseFilters[i]);
-			delete[] polyPhaseFilters[i];
+			for (unsigned int j = 0; j < subBandLength; j++)
+				subBandIR[j] = filterIR[j * count + (count - 1 - i)];
+			polyPhaseFilters[i].setFilterIR(&subBandIR[0]);
 		}
+	}
 
-		delete[] polyPhaseFilters;
+	/** flush the filter state */
+	inline void reset()
+	{
+		convolver.flushBuffer();
+		for (unsigned int i = 0; i < maxSamplingRatio; i++)
+			polyPhaseFilters[i].flushBuffer();
+		for (unsigned int i = 0; i < maxHalfBandStages; i++)
+			halfBandStages[i].reset();
 	}
 
 	/** perform the interpolation; the multiple outputs are in an array in the return structure */
@@ -9843,6 +12770,19 @@ public:
 		InterpolatorOutput output;
 		output.count = count;
 
+		if (halfBand)
+		{
+			// --- first stage: 1 -> 2, second stage: each of those -> 2
+			double stage1[2];
+			halfBandStages[0].interpolateAudio(xn, numHalfBandStages == 1 ? &output.audioData[0] : &stage1[0]);
+			if (numHalfBandStages > 1)
+			{
+				halfBandStages[1].interpolateAudio(stage1[0], &output.audioData[0]);
+				halfBandStages[1].interpolateAudio(stage1[1], &output.audioData[2]);
+			}
+			return output;
+		}
+
 		// --- interpolators need the amp correction
 		double ampCorrection = double(count);
 
@@ -9853,14 +12793,14 @@ public:
 			if (!polyphase)
 				output.audioData[i] = i == 0 ? ampCorrection*convolver.processAudioSample(xn) : ampCorrection*convolver.processAudioSample(0.0);
 			else
-				output.audioData[i] = ampCorrection*polyPhaseConvolvers[m--].processAudioSample(xn);
+				output.audioData[i] = ampCorrection*polyPhaseFilters[m--].processAudioSample(xn);
 		}
 		return output;
 	}
 
 protected:
 	// --- for straight, non-polyphase
-	FastConvolver convolver; ///< the convolver
+	DirectFormFIR convolver; ///< the full length filter
 
 	// --- we save these for future expansion, currently only sparsely used
 	unsigned int sampleRate = 44100;	///< sample rate
@@ -9869,12 +12809,17 @@ protected:
 
 	// --- polyphase: 4x is max right now
 	bool polyphase = true;									///< enable polyphase decomposition
-	FastConvolver polyPhaseConvolvers[maxSamplingRatio];	///< a set of sub-band convolvers for polyphase operation
+	DirectFormFIR polyPhaseFilters[maxSamplingRatio];		///< a set of sub-band filters for polyphase operation
+
+	// --- half-band cascade
+	bool halfBand = false;									///< use the half-band stages
+	unsigned int numHalfBandStages = 1;						///< 1 for 2x, 2 for 4x
+	HalfBandFilter halfBandStages[maxHalfBandStages];		///< the 2x stages, lowest rate first
 };
 
 /**
 \struct DecimatorInput
-\ingroup FFTW-Objects
+\ingroup FX-Objects
 \brief
 Custom input structure for DecimatorInput; it holds an arry of input samples that will be decimated down to just one sample.
 
@@ -9892,11 +12837,15 @@ struct DecimatorInput
 
 /**
 \class Decimator
-\ingroup FFTW-Objects
+\ingroup FX-Objects
 \brief
 The Decimator object implements a sample rate decimator. Ana array of M input samples is decimated
 to one output sample.
 
+The polyphase sub-band filters are direct form FIRs (DirectFormFIR), so there is no latency beyond the
+group delay of the anti-aliasing filter and no FFT; this object does not need FFTW. Alternatively,
+initializeHalfBand( ) sets up a cascade of 2x HalfBandFilter stages.
+
 Audio I/O:
 - Processes mono input to interpoalted (multi-sample) output.
 
@@ -9905,8 +12854,8 @@ Control I/F:
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\version Revision : 1.1 direct form polyphase FIR, half-band stages (Steve Dwyer)
+\date Date : 2026 / 10 / 17
 */
 class Decimator
 {
@@ -9924,39 +12873,66 @@ public:
 	inline void initialize(unsigned int _FIRLength, rateConversionRatio _ratio, unsigned int _sampleRate, bool _polyphase = true)
 	{
 		polyphase = _polyphase;
+		halfBand = false;
 		sampleRate = _sampleRate;
 		FIRLength = _FIRLength;
 		ratio = _ratio;
 		unsigned int count = countForRatio(ratio);
 		unsigned int subBandLength = FIRLength / count;
 
-		// --- straight SRC, no polyphase
+		// --- create the filters; they are silent until they have an IR
 		convolver.initialize(FIRLength);
+		for (unsigned int i = 0; i < count; i++)
+			polyPhaseFilters[i].initialize(subBandLength);
 
-		// --- set filterIR from built-in set - user can always override this!
-		double* filterTable = getFilterIRTable(FIRLength, ratio, sampleRate);
+		// --- share the designed filter tables - user can always override this with setFilterIR( )!
+		std::shared_ptr<const OversamplingFilterTable> filterTable = getOversamplingFilterTable(FIRLength, ratio, sampleRate);
 		if (!filterTable) return;
-		convolver.setFilterIR(filterTable);
+		convolver.shareFilterIR(std::shared_ptr<const double>(filterTable, &filterTable->filterIR[0]));
+		for (unsigned int i = 0; i < count; i++)
+			polyPhaseFilters[i].shareFilterIR(std::shared_ptr<const double>(filterTable, &filterTable->polyPhaseIR[i * subBandLength]));
+	}
 
-		if (!polyphase) return;
+	/** setup the sample rate decimator as a cascade of 2x half-band stages; the earlier stages run at the
+	    higher rates where the transition band is relatively wider, so they use half the taps of the one after */
+	/**
+	\param numTaps the length of the last (lowest rate) half-band filter (see HalfBandFilter::initialize( ))
+	\param _ratio the conversion ratio (see rateConversionRatio)
+	*/
+	inline void initializeHalfBand(unsigned int numTaps, rateConversionRatio _ratio)
+	{
+		halfBand = true;
+		ratio = _ratio;
+		numHalfBandStages = countForRatio(ratio) == 4 ? 2 : 1;
+		for (unsigned int i = 0; i < numHalfBandStages; i++)
+			halfBandStages[i].initialize(numTaps >> i);
+	}
 
-		// --- decompose filter
-		double** polyPhaseFilters = decomposeFilter(filterTable, FIRLength, count);
-		if (!polyPhaseFilters)
-		{
-			polyphase = false;
-			return;
-		}
+	/** set the anti-aliasing filter IR, FIRLength taps long, and decompose it into the sub-band filters */
+	inline void setFilterIR(const double* filterIR)
+	{
+		unsigned int count = countForRatio(ratio);
+		convolver.setFilterIR(filterIR);
 
-		// --- set the individual polyphase filter IRs on the convolvers
+		// --- see decomposeFilter( ): sub-band i holds taps i*count + (count - 1 - i)
+		unsigned int subBandLength = FIRLength / count;
+		std::unique_ptr<double[]> subBandIR(new double[subBandLength]);
 		for (unsigned int i = 0; i < count; i++)
 		{
-			polyPhaseConvolvers[i].initialize(subBandLength);
-			polyPhaseConvolvers[i].setFilterIR(polyPhaseFilters[i]);
-			delete[] polyPhaseFilters[i];
+			for (unsigned int j = 0; j < subBandLength; j++)
+				subBandIR[j] = filterIR[j * count + (count - 1 - i)];
+			polyPhaseFilters[i].setFilterIR(&subBandIR[0]);
 		}
+	}
 
-		delete[] polyPhaseFilters;
+	/** flush the filter state */
+	inline void reset()
+	{
+		convolver.flushBuffer();
+		for (unsigned int i = 0; i < maxSamplingRatio; i++)
+			polyPhaseFilters[i].flushBuffer();
+		for (unsigned int i = 0; i < maxHalfBandStages; i++)
+			halfBandStages[i].reset();
 	}
 
 	/** decimate audio input samples into one outut sample (return value) */
@@ -9964,6 +12940,18 @@ public:
 	{
 		unsigned int count = countForRatio(ratio);
 
+		if (halfBand)
+		{
+			// --- highest rate stage first: 4 -> 2, then 2 -> 1
+			if (numHalfBandStages == 1)
+				return halfBandStages[0].decimateAudio(&data.audioData[0]);
+
+			double stage1[2];
+			stage1[0] = halfBandStages[1].decimateAudio(&data.audioData[0]);
+			stage1[1] = halfBandStages[1].decimateAudio(&data.audioData[2]);
+			return halfBandStages[0].decimateAudio(&stage1[0]);
+		}
+
 		// --- setup output
 		double output = 0.0;
 
@@ -9973,14 +12961,14 @@ public:
 			if (!polyphase) // overwrites output; only the last output is saved
 				output = convolver.processAudioSample(data.audioData[i]);
 			else
-				output += polyPhaseConvolvers[i].processAudioSample(data.audioData[i]);
+				output += polyPhaseFilters[i].processAudioSample(data.audioData[i]);
 		}
 		return output;
 	}
 
 protected:
 	// --- for straight, non-polyphase
-	FastConvolver convolver;		 ///< fast convolver
+	DirectFormFIR convolver;		 ///< the full length filter
 
 	// --- we save these for future expansion, currently only sparsely used
 	unsigned int sampleRate = 44100;	///< sample rate
@@ -9989,7 +12977,10 @@ protected:
 
 	// --- polyphase: 4x is max right now
 	bool polyphase = true;									///< enable polyphase decomposition
-	FastConvolver polyPhaseConvolvers[maxSamplingRatio];	///< a set of sub-band convolvers for polyphase operation
-};
+	DirectFormFIR polyPhaseFilters[maxSamplingRatio];		///< a set of sub-band filters for polyphase operation
 
-#endif
+	// --- half-band cascade
+	bool halfBand = false;									///< use the half-band stages
+	unsigned int numHalfBandStages = 1;						///< 1 for 2x, 2 for 4x
+	HalfBandFilter halfBandStages[maxHalfBandStages];		///< the 2x stages, lowest rate first
+};
@@ -194,6 +194,7 @@ PluginParameter::PluginParameter(const PluginParameter& initGuiControl)
     displayPrecision = initGuiControl.displayPrecision;
     stringList = initGuiControl.stringList;
     useParameterSmoothing = initGuiControl.useParameterSmoothing;
+    useRampSmoothing = initGuiControl.useRampSmoothing;
     smoothingType = initGuiControl.smoothingType;
     smoothingTimeMsec = initGuiControl.smoothingTimeMsec;
     meterAttack_ms = initGuiControl.meterAttack_ms;
@@ -18,6 +18,7 @@
 #include <sstream>
 #include <atomic>
 #include <map>
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 
@@ -143,6 +144,9 @@ public:
 	bool getParameterSmoothing() { return useParameterSmoothing; }				///< query parameter smoothing flag
     void setParameterSmoothing(bool value) { useParameterSmoothing = value; }	///< set inverted meter flag
 
+	bool getRampSmoothing() { return useRampSmoothing; }				///< query ramp (block) smoothing flag
+	void setRampSmoothing(bool value) { useRampSmoothing = value; }		///< set ramp (block) smoothing flag; the plugin core pulls the ramp with smoothParameterBlock( )
+
     double getSmoothingTimeMsec() { return smoothingTimeMsec;}					///< query smoothing time
     void setSmoothingTimeMsec(double value) { smoothingTimeMsec = value; }		///< set inverted meter flag
 
@@ -178,12 +182,14 @@ public:
 			controlType == controlVariableType::kFloat)
 		{
 			if (useParameterSmoothing && !ignoreSmoothing)
+			{
 				setSmoothedTargetValue(actualParamValue);
-			else
-				setAtomicControlValueDouble(actualParamValue);
+				markDirty(dirtySmoothingSet);
+				return;
+			}
 		}
-		else
-			setAtomicControlValueDouble(actualParamValue);
+		setAtomicControlValueDouble(actualParamValue);
+		markDirty(dirtySet);
 	}
 
 	/**
@@ -202,12 +208,14 @@ public:
 			controlType == controlVariableType::kFloat)
 		{
 			if (useParameterSmoothing && !ignoreParameterSmoothing)
+			{
 				setSmoothedTargetValue(actualParamValue);
-			else
-				setAtomicControlValueDouble(actualParamValue);
+				markDirty(dirtySmoothingSet);
+				return actualParamValue;
+			}
 		}
-		else
-			setAtomicControlValueDouble(actualParamValue);
+		setAtomicControlValueDouble(actualParamValue);
+		markDirty(dirtySet);
 
 		return actualParamValue;
 	}
@@ -412,6 +420,25 @@ public:
 		return (kCTCorrFactorAntiUnity)*(-pow(10.0, (-aLogNormalizedValue / kCTCoefficient)) + 1.0);
     }
 
+	/**
+	\brief connect the parameter to its owner's change sets; setControlValue( ) and setControlValueNormalized( ) then mark
+	       the parameter index in dirtyParameters, or in dirtySmoothingParameters when the write sets a smoothing target.
+	       Meter parameters are not connected: they are outbound only.
+
+	\param _dirtySet set of parameters whose control value changed (nullptr to disconnect)
+	\param _dirtySmoothingSet set of parameters with a new smoothing target (nullptr to disconnect)
+	\param _parameterIndex index of this parameter in the owner's parameter array
+	*/
+	void setDirtySets(ParameterDirtySet* _dirtySet, ParameterDirtySet* _dirtySmoothingSet, uint32_t _parameterIndex)
+	{
+		dirtySet = _dirtySet;
+		dirtySmoothingSet = _dirtySmoothingSet;
+		parameterIndex = _parameterIndex;
+	}
+
+	/** \return the index set with setDirtySets( ) */
+	uint32_t getParameterIndex() { return parameterIndex; }
+
 	/**
 	\brief initialize or reset the parameter smoother object
 
@@ -440,18 +467,39 @@ public:
 	/**
 	\brief perform smoothing operation on data
 
+	\param stepFraction fraction of a full smoothing step; less than 1 for a short block when the smoother is clocked once per block
 	\return true if data was actually smoothed, false otherwise (data that has reached its terminal value will not be smoothed any further)
 	*/
-	bool smoothParameterValue()
+	bool smoothParameterValue(double stepFraction = 1.0)
     {
-        if(!useParameterSmoothing) return false;
+        if(!useParameterSmoothing || useRampSmoothing) return false;
         double smoothedValue = 0.0;
-        bool smoothed = paramSmoother.smoothParameter(getSmoothedTargetValue(), smoothedValue);
+        bool smoothed = paramSmoother.smoothParameter(getSmoothedTargetValue(), smoothedValue, stepFraction);
         if(smoothed)
 			setAtomicControlValueDouble(smoothedValue);
         return smoothed;
     }
 
+	/**
+	\brief perform the smoothing operation for a block of samples; for ramp smoothing parameters, which the
+	framework does not smooth, the plugin core calls this once per block and consumes the per-sample values
+	directly; the smoother runs at the audio sample rate
+
+	\param ramp array of at least numSamples values to receive the smoothed values
+	\param numSamples number of samples
+	\return the number of samples before the target was reached (see ParamSmoother::smoothParameterBlock( ))
+	*/
+	uint32_t smoothParameterBlock(double* ramp, uint32_t numSamples)
+	{
+		uint32_t moving = paramSmoother.smoothParameterBlock(getSmoothedTargetValue(), ramp, numSamples);
+		if (numSamples > 0)
+		{
+			setAtomicControlValueDouble(ramp[numSamples - 1]);
+			updateInBoundVariable();
+		}
+		return moving;
+	}
+
 	/**
 	\brief save the variable for binding operation
 
@@ -513,13 +561,19 @@ public:
 	}
 
 	/**
-	\brief perform the variable binding update on meter data
+	\brief perform the variable binding update on meter data; meter parameters publish their MeterAccumulator
+	       peak, which is the only atomic write per buffer; the meter view applies the detector mode
 
 	\return true if variable was udpated, false otherwise
 	*/
 	bool updateOutBoundVariable()
 	{
-		if (boundVariableUInt)
+		if (isMeterParam())
+		{
+			setControlValue(meterAccumulator.getMeterValue());
+			return true;
+		}
+		else if (boundVariableUInt)
 		{
 			setControlValue((double)*boundVariableUInt);
 			return true;
@@ -542,6 +596,41 @@ public:
 		return false;
 	}
 
+	/**
+	\brief feed the bound meter variable into the MeterAccumulator, held for numSamples; skipped when the plugin has
+	       fed the accumulator itself since the last call
+
+	\param numSamples number of samples the current value represents (1 per frame, or the block size)
+	*/
+	inline void accumulateOutBoundVariable(uint32_t numSamples = 1)
+	{
+		if (meterAccumulator.takeDirectInput())
+			return;
+
+		if (boundVariableFloat)
+			meterAccumulator.accumulateHeld(*boundVariableFloat, numSamples);
+		else if (boundVariableDouble)
+			meterAccumulator.accumulateHeld(*boundVariableDouble, numSamples);
+		else if (boundVariableInt)
+			meterAccumulator.accumulateHeld((double)*boundVariableInt, numSamples);
+		else if (boundVariableUInt)
+			meterAccumulator.accumulateHeld((double)*boundVariableUInt, numSamples);
+	}
+
+	/**
+	\brief get the meter accumulator for feeding it directly from processAudioBlock( ) or processAudioFrame( )
+
+	\return the accumulator, or nullptr if this is not a meter parameter
+	*/
+	MeterAccumulator* getMeterAccumulator() { return isMeterParam() ? &meterAccumulator : nullptr; }
+
+	/**
+	\brief reset the meter accumulator
+
+	\param sampleRate the audio sample rate
+	*/
+	void resetMeterAccumulator(double sampleRate) { meterAccumulator.reset(sampleRate); }
+
 	/**
 	\brief stores the update queue for VST3 sample accuate automation; note this is only used during actual DAW runs with automation engaged
 
@@ -575,6 +664,7 @@ public:
 		displayPrecision = aPluginParameter.displayPrecision;
 		stringList = aPluginParameter.stringList;
 		useParameterSmoothing = aPluginParameter.useParameterSmoothing;
+		useRampSmoothing = aPluginParameter.useRampSmoothing;
 		smoothingType = aPluginParameter.smoothingType;
 		smoothingTimeMsec = aPluginParameter.smoothingTimeMsec;
 		meterAttack_ms = aPluginParameter.meterAttack_ms;
@@ -637,10 +727,14 @@ protected:
 
     // --- parameter smoothing
     bool useParameterSmoothing = false;			///< enable param smoothing
+	bool useRampSmoothing = false;				///< smoothed per sample by the plugin core with smoothParameterBlock( )
     smoothingMethod smoothingType = smoothingMethod::kLPFSmoother;	///< param smoothing type
     double smoothingTimeMsec = 100.0;			///< param smoothing time
     ParamSmoother<double> paramSmoother;		///< param smoothing object
 
+	// --- meter ballistics for transients between GUI repaints
+	MeterAccumulator meterAccumulator;			///< peak/RMS accumulator for meter params
+
 	// --- variable binding
 	boundVariableType boundVariableDataType = boundVariableType::kFloat;	///< bound data type
 
@@ -650,6 +744,12 @@ protected:
     // --- default is enabled; you can disable this for controls that have a long postUpdate cooking time
     bool enableVSTSampleAccurateAutomation = true;							///< VST3 sample accurate flag
 
+	// --- change tracking; owned by PluginBase, never copied
+	ParameterDirtySet* dirtySet = nullptr;			///< marked when the control value is written
+	ParameterDirtySet* dirtySmoothingSet = nullptr;	///< marked when a smoothing target is written
+	uint32_t parameterIndex = 0;					///< our bit in both sets
+	void markDirty(ParameterDirtySet* set) { if (set) set->set(parameterIndex); }	///< mark our bit, if connected
+
     /**
 	\brief get volt/octave control value from a normalized value
 